@@ -56,11 +56,16 @@
 #include <librepcb/core/project/projectattributelookup.h>
 #include <librepcb/core/project/projectloader.h>
 #include <librepcb/core/project/schematic/schematicpainter.h>
+#include <librepcb/core/utils/scopeguard.h>
 #include <librepcb/core/utils/toolbox.h>
+#include <librepcb/core/utils/tracer.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 #include <algorithm>
+#include <atomic>
+#include <limits>
 
 /*******************************************************************************
  *  Namespace
@@ -68,6 +73,13 @@
 namespace librepcb {
 namespace cli {
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+thread_local CommandLineInterface::OutputBuffer*
+    CommandLineInterface::sCapturedOutput = nullptr;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -106,6 +118,11 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
   parser.addOption(versionOption);
   QCommandLineOption verboseOption({"v", "verbose"}, tr("Verbose output."));
   parser.addOption(verboseOption);
+  QCommandLineOption profileOption(
+      "profile",
+      tr("Write a profiling report (Chrome trace format) to a file."),
+      tr("file"));
+  parser.addOption(profileOption);
   parser.addPositionalArgument("command",
                                tr("The command to execute (see list below)."));
   positionalArgNames.append("command");
@@ -240,6 +257,16 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
       tr("Fail if the project files are not strictly canonical, i.e. "
          "there would be changes when saving the project. Note that "
          "this option is not available for *.lppz files."));
+  QCommandLineOption projectsFileOption(
+      "projects-file",
+      tr("Process all projects listed in the given file (one path per line, "
+         "relative to that file) in addition to the projects passed as "
+         "arguments."),
+      tr("file"));
+  QCommandLineOption prjParallelOption(
+      "parallel",
+      tr("Number of projects to process in parallel (default: 1)."),
+      tr("n"));
 
   // Define options for "open-library"
   QCommandLineOption libAllOption(
@@ -262,6 +289,12 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
       "strict",
       tr("Fail if the opened files are not strictly canonical, i.e. "
          "there would be changes when saving the library elements."));
+  QCommandLineOption libJobsOption(
+      "jobs",
+      tr("Number of library elements to process in parallel when '%1' is "
+         "given. Defaults to 1.")
+          .arg("--all"),
+      tr("n"));
 
   // Define options for "open-step"
   QCommandLineOption stepMinifyOption(
@@ -303,8 +336,10 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
   if (command == "open-project") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
-    parser.addPositionalArgument("project",
-                                 tr("Path to project file (*.lpp[z])."));
+    parser.addPositionalArgument(
+        "project",
+        tr("Path to project file (*.lpp[z]). Can be given multiple times to "
+           "process several projects in one run."));
     positionalArgNames.append("project");
     parser.addOption(ercOption);
     parser.addOption(drcOption);
@@ -330,6 +365,8 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     parser.addOption(setDefaultAssemblyVariantOption);
     parser.addOption(saveOption);
     parser.addOption(prjStrictOption);
+    parser.addOption(projectsFileOption);
+    parser.addOption(prjParallelOption);
   } else if (command == "open-library") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
@@ -341,6 +378,7 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     parser.addOption(libMinifyStepOption);
     parser.addOption(libSaveOption);
     parser.addOption(libStrictOption);
+    parser.addOption(libJobsOption);
   } else if (command == "open-step") {
     parser.addPositionalArgument(command, commands[command].first,
                                  commands[command].second);
@@ -379,6 +417,11 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     OccModel::setVerboseOutput(true);
   }
 
+  // --profile
+  if (parser.isSet(profileOption)) {
+    Tracer::setEnabled(true);
+  }
+
   // --help (also shown if no arguments supplied)
   if (parser.isSet(helpOption) || (args.count() <= 1)) {
     print(helpText);
@@ -403,9 +446,15 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     return 0;
   }
 
-  // Check number of passed positional command arguments.
+  // Check number of passed positional command arguments. Note that the
+  // "open-project" command accepts any number of projects (batch mode), or
+  // even none if they are provided by a file.
   const QStringList positionalArgs = parser.positionalArguments();
-  if (positionalArgs.count() < positionalArgNames.count()) {
+  if ((command == "open-project") &&
+      ((positionalArgs.count() >= positionalArgNames.count()) ||
+       parser.isSet(projectsFileOption))) {
+    // Number of projects is valid.
+  } else if (positionalArgs.count() < positionalArgNames.count()) {
     const QStringList names = positionalArgNames.mid(positionalArgs.count());
     printErr(tr("Missing arguments:") % " " % names.join(" "));
     printErr(usageHelpText);
@@ -417,45 +466,80 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
     printErr(usageHelpText);
     printErr(helpCommandText);
     return 1;
+  } else if ((command == "open-library") && parser.isSet(libJobsOption) &&
+             (!parser.isSet(libAllOption))) {
+    printErr(tr("The option '%1' requires '%2'.").arg("--jobs", "--all"));
+    printErr(usageHelpText);
+    printErr(helpCommandText);
+    return 1;
   }
 
   // Execute command
   bool cmdSuccess = false;
   if (command == "open-project") {
-    cmdSuccess = openProject(
-        positionalArgs.value(1),  // project filepath
-        parser.isSet(ercOption),  // run ERC
-        parser.isSet(drcOption),  // run DRC
-        parser.value(drcSettingsOption),  // DRC settings
-        parser.values(runSpecificJobOption),  // run specific output jobs
-        parser.isSet(runAllJobsOption),  // run all output jobs
-        parser.value(customJobsOption).trimmed(),  // custom jobs file path
-        parser.value(customOutDirOption).trimmed(),  // custom jobs outdir
-        parser.values(exportSchematicsOption),  // export schematics
-        parser.values(exportBomOption),  // export generic BOM
-        parser.values(exportBoardBomOption),  // export board BOM
-        parser.value(bomAttributesOption),  // BOM attributes
-        parser.isSet(exportPcbFabricationDataOption),  // export PCB fab. data
-        parser.value(pcbFabricationSettingsOption),  // PCB fab. settings
-        parser.values(exportPnpTopOption),  // export PnP top
-        parser.values(exportPnpBottomOption),  // export PnP bottom
-        parser.values(exportNetlistOption),  // export netlist
-        parser.values(boardOption),  // board names
-        parser.values(boardIndexOption),  // board indices
-        parser.isSet(removeOtherBoardsOption),  // remove other boards
-        parser.values(assemblyVariantOption),  // assembly variant names
-        parser.values(assemblyVariantIndexOption),  // assembly variant indices
-        parser.value(setDefaultAssemblyVariantOption),  // set default AV
-        parser.isSet(saveOption),  // save project
-        parser.isSet(prjStrictOption)  // strict mode
-    );
+    QStringList projectFiles = positionalArgs.mid(1);
+    if (parser.isSet(projectsFileOption)) {
+      const QString fp = parser.value(projectsFileOption);
+      try {
+        projectFiles += readProjectsFile(fp);  // can throw
+      } catch (const Exception& e) {
+        printErr(tr("ERROR: Failed to read projects file '%1': %2")
+                     .arg(fp, e.getMsg()));
+        projectFiles.clear();
+      }
+    }
+    int parallel = 1;
+    if (parser.isSet(prjParallelOption)) {
+      bool ok = false;
+      parallel = parser.value(prjParallelOption).trimmed().toInt(&ok);
+      if ((!ok) || (parallel < 1)) {
+        printErr(tr("ERROR: Number of parallel projects '%1' is invalid.")
+                     .arg(parser.value(prjParallelOption)));
+        projectFiles.clear();
+      }
+    }
+    // Note: All options are evaluated here in the main thread since the
+    // projects might be processed in worker threads.
+    QVector<std::function<bool()>> tasks;
+    foreach (const QString& projectFile, projectFiles) {
+      tasks.append(std::bind(
+          &CommandLineInterface::openProject, this,
+          projectFile,  // project filepath
+          parser.isSet(ercOption),  // run ERC
+          parser.isSet(drcOption),  // run DRC
+          parser.value(drcSettingsOption),  // DRC settings
+          parser.values(runSpecificJobOption),  // run specific output jobs
+          parser.isSet(runAllJobsOption),  // run all output jobs
+          parser.value(customJobsOption).trimmed(),  // custom jobs file path
+          parser.value(customOutDirOption).trimmed(),  // custom jobs outdir
+          parser.values(exportSchematicsOption),  // export schematics
+          parser.values(exportBomOption),  // export generic BOM
+          parser.values(exportBoardBomOption),  // export board BOM
+          parser.value(bomAttributesOption),  // BOM attributes
+          parser.isSet(exportPcbFabricationDataOption),  // export PCB fab.
+          parser.value(pcbFabricationSettingsOption),  // PCB fab. settings
+          parser.values(exportPnpTopOption),  // export PnP top
+          parser.values(exportPnpBottomOption),  // export PnP bottom
+          parser.values(exportNetlistOption),  // export netlist
+          parser.values(boardOption),  // board names
+          parser.values(boardIndexOption),  // board indices
+          parser.isSet(removeOtherBoardsOption),  // remove other boards
+          parser.values(assemblyVariantOption),  // assembly variant names
+          parser.values(assemblyVariantIndexOption),  // assembly variant idx
+          parser.value(setDefaultAssemblyVariantOption),  // set default AV
+          parser.isSet(saveOption),  // save project
+          parser.isSet(prjStrictOption)  // strict mode
+          ));
+    }
+    cmdSuccess = (!tasks.isEmpty()) && runTasks(tasks, parallel);
   } else if (command == "open-library") {
     cmdSuccess = openLibrary(positionalArgs.value(1),  // library directory
                              parser.isSet(libAllOption),  // all elements
                              parser.isSet(libCheckOption),  // run check
                              parser.isSet(libMinifyStepOption),  // minify STEP
                              parser.isSet(libSaveOption),  // save
-                             parser.isSet(libStrictOption)  // strict mode
+                             parser.isSet(libStrictOption),  // strict mode
+                             parser.value(libJobsOption)  // parallel jobs
     );
   } else if (command == "open-step") {
     cmdSuccess = openStep(positionalArgs.value(1),  // STEP file path
@@ -466,6 +550,17 @@ int CommandLineInterface::execute(const QStringList& args) noexcept {
   } else {
     printErr("Internal failure.");  // No tr() because this cannot occur.
   }
+  if (parser.isSet(profileOption)) {
+    const QString fp = parser.value(profileOption);
+    try {
+      Tracer::writeChromeTrace(
+          FilePath(QFileInfo(fp).absoluteFilePath()));  // can throw
+    } catch (const Exception& e) {
+      printErr(tr("ERROR: Failed to write profiling report '%1': %2")
+                   .arg(fp, e.getMsg()));
+      cmdSuccess = false;
+    }
+  }
   if (cmdSuccess) {
     print(tr("SUCCESS"));
     return 0;
@@ -492,6 +587,7 @@ bool CommandLineInterface::openProject(
     const QStringList& boardIndices, bool removeOtherBoards,
     const QStringList& avNames, const QStringList& avIndices,
     const QString& setDefaultAv, bool save, bool strict) const noexcept {
+  LIBREPCB_TRACE_SCOPE("CommandLineInterface::openProject");
   try {
     bool success = true;
     QMap<FilePath, int> writtenFilesCounter;
@@ -583,10 +679,7 @@ bool CommandLineInterface::openProject(
 
     // If no assembly variants are specified, export all variants.
     if (avNames.isEmpty() && avIndices.isEmpty()) {
-      for (auto it = project->getCircuit().getAssemblyVariants().begin();
-           it != project->getCircuit().getAssemblyVariants().end(); ++it) {
-        assemblyVariants.append(it.ptr());
-      }
+      assemblyVariants = project->getCircuit().getAssemblyVariants().values();
     }
 
     // Parse list of boards.
@@ -637,13 +730,13 @@ bool CommandLineInterface::openProject(
     if (runDrc || exportPcbFabricationData || (!runJobs.isEmpty()) ||
         runAllJobs) {
       foreach (Board* board, boards) {
-        qInfo().nospace().noquote() << "Rebuilding all planes of board '"
-                                    << *board->getName() << "'...";
+        printVerbose(tr("Rebuilding all planes of board '%1'...")
+                         .arg(*board->getName()));
         BoardPlaneFragmentsBuilder builder;
         builder.runSynchronously(*board);  // can throw
       }
     } else {
-      qInfo() << "No need to rebuild planes, thus skipped.";
+      printVerbose(tr("No need to rebuild planes, thus skipped."));
     }
 
     // Check for non-canonical files (strict mode)
@@ -1046,12 +1139,91 @@ bool CommandLineInterface::openProject(
   }
 }
 
+QStringList CommandLineInterface::readProjectsFile(const QString& filePath) {
+  const FilePath fp(QFileInfo(filePath).absoluteFilePath());
+  const QString content = QString::fromUtf8(FileUtils::readFile(fp));
+  QStringList projectFiles;
+  foreach (QString line, content.split('\n')) {
+    line = line.trimmed();
+    if ((!line.isEmpty()) && (!line.startsWith('#'))) {
+      // Keep the path relative to the working directory if the projects file
+      // path is relative too, for pretty console output.
+      const FilePath projectFp = QDir::isAbsolutePath(line)
+          ? FilePath(QFileInfo(line).absoluteFilePath())
+          : fp.getParentDir().getPathTo(line);
+      projectFiles.append(QFileInfo(filePath).isAbsolute()
+                              ? projectFp.toNative()
+                              : projectFp.toRelativeNative(
+                                    FilePath(QDir::currentPath())));
+    }
+  }
+  return projectFiles;
+}
+
+bool CommandLineInterface::runTasks(
+    const QVector<std::function<bool()>>& tasks, int jobs) noexcept {
+  bool success = true;
+  if (jobs <= 1) {
+    foreach (const auto& task, tasks) {
+      if (!task()) {
+        success = false;
+      }
+    }
+  } else {
+    // Note: The tasks share no caches, each project is loaded and processed
+    // with its own objects. Only process-wide singletons are shared, which
+    // have been checked for concurrent use: the Application getters (static
+    // initialization is thread-safe), the stroke font pool (StrokeFont loads
+    // fonts lazily under a mutex), the attribute template cache (guarded by
+    // a mutex) and the static lookup tables of Layer and SExpression (read
+    // only after their thread-safe initialization).
+    //
+    // Capture the console output of each task and print it in the order of
+    // the tasks to keep the console output deterministic.
+    auto run = [](const std::function<bool()>& task) {
+      OutputBuffer output;
+      captureOutput(&output);
+      const bool success = task();
+      captureOutput(nullptr);
+      return std::make_pair(success, output);
+    };
+    QThreadPool pool;
+    pool.setMaxThreadCount(jobs);
+    QList<QFuture<std::pair<bool, OutputBuffer>>> futures;
+    foreach (const auto& task, tasks) {
+      futures.append(
+          QtConcurrent::run(&pool, [&run, task]() { return run(task); }));
+    }
+    foreach (const auto& future, futures) {
+      const std::pair<bool, OutputBuffer> result = future.result();
+      flush(result.second);
+      if (!result.first) {
+        success = false;
+      }
+    }
+  }
+  return success;
+}
+
 bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
                                        bool runCheck, bool minifyStepFiles,
-                                       bool save, bool strict) const noexcept {
+                                       bool save, bool strict,
+                                       const QString& jobs) const noexcept {
+  LIBREPCB_TRACE_SCOPE("CommandLineInterface::openLibrary");
   try {
     bool success = true;
 
+    // Parse number of parallel jobs.
+    int jobCount = 1;
+    if (!jobs.isEmpty()) {
+      bool ok = false;
+      jobCount = jobs.trimmed().toInt(&ok);
+      if ((!ok) || (jobCount < 1)) {
+        printErr(tr("ERROR: Number of jobs '%1' is invalid.").arg(jobs));
+        return false;
+      }
+    }
+
     // Open library
     FilePath libFp(QFileInfo(libDir).absoluteFilePath());
     print(tr("Open library '%1'...").arg(prettyPath(libFp, libDir)));
@@ -1070,18 +1242,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<ComponentCategory>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 component categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<ComponentCategory> element =
-            ComponentCategory::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<ComponentCategory>(
+          libDir, libFp, elements, runCheck, minifyStepFiles, save, strict,
+          jobCount, success);  // can throw
     }
 
     // Open all package categories
@@ -1089,18 +1252,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<PackageCategory>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 package categories...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<PackageCategory> element =
-            PackageCategory::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<PackageCategory>(
+          libDir, libFp, elements, runCheck, minifyStepFiles, save, strict,
+          jobCount, success);  // can throw
     }
 
     // Open all symbols
@@ -1108,18 +1262,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<Symbol>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 symbols...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Symbol> element =
-            Symbol::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<Symbol>(libDir, libFp, elements, runCheck,
+                                     minifyStepFiles, save, strict, jobCount,
+                                     success);  // can throw
     }
 
     // Open all packages
@@ -1127,18 +1272,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<Package>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 packages...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Package> element =
-            Package::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<Package>(libDir, libFp, elements, runCheck,
+                                      minifyStepFiles, save, strict, jobCount,
+                                      success);  // can throw
     }
 
     // Open all components
@@ -1146,18 +1282,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<Component>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 components...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Component> element =
-            Component::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<Component>(libDir, libFp, elements, runCheck,
+                                        minifyStepFiles, save, strict,
+                                        jobCount, success);  // can throw
     }
 
     // Open all devices
@@ -1165,18 +1292,9 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
       QStringList elements = lib->searchForElements<Device>();
       elements.sort();  // For deterministic console output.
       print(tr("Process %1 devices...").arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo().noquote() << tr("Open '%1'...").arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        std::unique_ptr<Device> element =
-            Device::open(std::unique_ptr<TransactionalDirectory>(
-                new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
-                              save, strict,
-                              success);  // can throw
-      }
+      processLibraryElements<Device>(libDir, libFp, elements, runCheck,
+                                     minifyStepFiles, save, strict, jobCount,
+                                     success);  // can throw
     }
 
     return success;
@@ -1186,6 +1304,84 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
   }
 }
 
+template <typename ElementType>
+void CommandLineInterface::processLibraryElements(
+    const QString& libDir, const FilePath& libFp, const QStringList& elements,
+    bool runCheck, bool minifyStepFiles, bool save, bool strict, int jobs,
+    bool& success) const {
+  struct Result {
+    OutputBuffer output;
+    bool success;
+    QString error;
+  };
+
+  // Index of the first element which failed with an exception. Elements after
+  // that one are skipped, just like a sequential run would abort there.
+  std::atomic<int> firstFailedIndex(std::numeric_limits<int>::max());
+
+  // Open & process a single element, with its own file system and all console
+  // output captured. Thus this is safe to be called from worker threads.
+  auto process = [&](int index) -> Result {
+    Result result{OutputBuffer(), true, QString()};
+    if (index > firstFailedIndex) {
+      return result;
+    }
+    captureOutput(&result.output);
+    auto sg = scopeGuard([]() { captureOutput(nullptr); });
+    try {
+      const FilePath fp = libFp.getPathTo(elements.at(index));
+      printVerbose(tr("Open '%1'...").arg(prettyPath(fp, libDir)));
+      std::shared_ptr<TransactionalFileSystem> fs =
+          TransactionalFileSystem::open(fp, save);  // can throw
+      std::unique_ptr<ElementType> element =
+          ElementType::open(std::unique_ptr<TransactionalDirectory>(
+              new TransactionalDirectory(fs)));  // can throw
+      processLibraryElement(libDir, *fs, *element, runCheck, minifyStepFiles,
+                            save, strict,
+                            result.success);  // can throw
+    } catch (const Exception& e) {
+      result.error = e.getMsg();
+      int failedIndex = firstFailedIndex;
+      while ((index < failedIndex) &&
+             (!firstFailedIndex.compare_exchange_weak(failedIndex, index))) {
+      }
+    }
+    return result;
+  };
+
+  // Print the buffered output in the order of the elements to keep the console
+  // output deterministic, independent of the number of jobs.
+  auto handleResult = [&success](const Result& result) {
+    flush(result.output);
+    if (!result.success) {
+      success = false;
+    }
+    if (!result.error.isNull()) {
+      throw RuntimeError(__FILE__, __LINE__, result.error);
+    }
+  };
+
+  if (jobs <= 1) {
+    for (int i = 0; i < elements.count(); ++i) {
+      handleResult(process(i));  // can throw
+    }
+  } else {
+    // Note: The pool needs to be destroyed (i.e. waiting for all workers)
+    // before the objects referenced by the workers go out of scope.
+    QThreadPool pool;
+    pool.setMaxThreadCount(jobs);
+    QList<QFuture<Result>> futures;
+    for (int i = 0; i < elements.count(); ++i) {
+      futures.append(QtConcurrent::run(&pool, [&process, i]() {
+        return process(i);
+      }));
+    }
+    foreach (const QFuture<Result>& future, futures) {
+      handleResult(future.result());  // can throw
+    }
+  }
+}
+
 void CommandLineInterface::processLibraryElement(
     const QString& libDir, TransactionalFileSystem& fs,
     LibraryBaseElement& element, bool runCheck, bool minifyStepFiles, bool save,
@@ -1212,7 +1408,7 @@ void CommandLineInterface::processLibraryElement(
     foreach (const QString& file, fs.getFiles()) {
       if (file.endsWith(".step")) {
         const QString fp = prettyPath(fs.getAbsPath(file), libDir);
-        qInfo().noquote() << tr("Minify STEP model '%1'...").arg(fp);
+        printVerbose(tr("Minify STEP model '%1'...").arg(fp));
         try {
           const QByteArray content = fs.read(file);  // can throw
           const QByteArray minified =
@@ -1237,8 +1433,8 @@ void CommandLineInterface::processLibraryElement(
 
   // Check for non-canonical files (strict mode)
   if (strict) {
-    qInfo().noquote() << tr("Check '%1' for non-canonical files...")
-                             .arg(prettyPath(fs.getPath(), libDir));
+    printVerbose(tr("Check '%1' for non-canonical files...")
+                     .arg(prettyPath(fs.getPath(), libDir)));
 
     QStringList paths = fs.checkForModifications();  // can throw
     if (!paths.isEmpty()) {
@@ -1255,16 +1451,15 @@ void CommandLineInterface::processLibraryElement(
 
   // Run library element check, if needed.
   if (runCheck) {
-    qInfo().noquote() << tr("Check '%1' for non-approved messages...")
-                             .arg(prettyPath(fs.getPath(), libDir));
+    printVerbose(tr("Check '%1' for non-approved messages...")
+                     .arg(prettyPath(fs.getPath(), libDir)));
     int approvedMsgCount = 0;
     const RuleCheckMessageList messages = element.runChecks();
     const QStringList nonApproved = prepareRuleCheckMessages(
         messages, element.getMessageApprovals(), approvedMsgCount);
-    qInfo().noquote() << "  " %
-            tr("Approved messages: %1").arg(approvedMsgCount);
-    qInfo().noquote() << "  " %
-            tr("Non-approved messages: %1").arg(nonApproved.count());
+    printVerbose("  " % tr("Approved messages: %1").arg(approvedMsgCount));
+    printVerbose("  " %
+                 tr("Non-approved messages: %1").arg(nonApproved.count()));
     foreach (const QString& msg, nonApproved) {
       printErrorHeaderOnce();
       printErr("    - " % msg);
@@ -1274,8 +1469,7 @@ void CommandLineInterface::processLibraryElement(
 
   // Save element to file system, if needed
   if (save) {
-    qInfo().noquote()
-        << tr("Save '%1'...").arg(prettyPath(fs.getPath(), libDir));
+    printVerbose(tr("Save '%1'...").arg(prettyPath(fs.getPath(), libDir)));
     if (failIfFileFormatUnstable()) {
       success = false;
     } else {
@@ -1291,6 +1485,7 @@ void CommandLineInterface::processLibraryElement(
 bool CommandLineInterface::openStep(const QString& filePath, bool minify,
                                     bool tesselate,
                                     const QString& saveTo) const noexcept {
+  LIBREPCB_TRACE_SCOPE("CommandLineInterface::openStep");
   try {
     // Note: Not using tr() for this command as it is basically intended for
     // developers, not end users.
@@ -1417,20 +1612,57 @@ bool CommandLineInterface::failIfFileFormatUnstable() noexcept {
             .arg("--save"));
     return true;
   } else {
-    qInfo() << "Application version is unstable, but warning is disabled with "
-               "environment variable LIBREPCB_DISABLE_UNSTABLE_WARNING.";
+    printVerbose(
+        "Application version is unstable, but warning is disabled with "
+        "environment variable LIBREPCB_DISABLE_UNSTABLE_WARNING.");
     return false;
   }
 }
 
 void CommandLineInterface::print(const QString& str) noexcept {
-  QTextStream s(stdout);
-  s << str << endl;
+  if (sCapturedOutput) {
+    sCapturedOutput->append(std::make_pair(OutputChannel::StdOut, str));
+  } else {
+    QTextStream s(stdout);
+    s << str << endl;
+  }
 }
 
 void CommandLineInterface::printErr(const QString& str) noexcept {
-  QTextStream s(stderr);
-  s << str << endl;
+  if (sCapturedOutput) {
+    sCapturedOutput->append(std::make_pair(OutputChannel::StdErr, str));
+  } else {
+    QTextStream s(stderr);
+    s << str << endl;
+  }
+}
+
+void CommandLineInterface::printVerbose(const QString& str) noexcept {
+  if (sCapturedOutput) {
+    sCapturedOutput->append(std::make_pair(OutputChannel::Verbose, str));
+  } else {
+    qInfo().noquote() << str;
+  }
+}
+
+void CommandLineInterface::captureOutput(OutputBuffer* buffer) noexcept {
+  sCapturedOutput = buffer;
+}
+
+void CommandLineInterface::flush(const OutputBuffer& output) noexcept {
+  for (const auto& pair : output) {
+    switch (pair.first) {
+      case OutputChannel::Verbose:
+        printVerbose(pair.second);
+        break;
+      case OutputChannel::StdOut:
+        print(pair.second);
+        break;
+      case OutputChannel::StdErr:
+        printErr(pair.second);
+        break;
+    }
+  }
 }
 
 /*******************************************************************************
@@ -27,6 +27,8 @@
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -57,6 +59,10 @@ public:
   // General Methods
   int execute(const QStringList& args) noexcept;
 
+private:  // Types
+  enum class OutputChannel { Verbose, StdOut, StdErr };
+  typedef QList<std::pair<OutputChannel, QString>> OutputBuffer;
+
 private:  // Methods
   bool openProject(
       const QString& projectFile, bool runErc, bool runDrc,
@@ -72,8 +78,17 @@ private:  // Methods
       const QStringList& boardIndices, bool removeOtherBoards,
       const QStringList& avNames, const QStringList& avIndices,
       const QString& setDefaultAv, bool save, bool strict) const noexcept;
+  static QStringList readProjectsFile(const QString& filePath);
+  static bool runTasks(const QVector<std::function<bool()>>& tasks,
+                       int jobs) noexcept;
   bool openLibrary(const QString& libDir, bool all, bool runCheck,
-                   bool minifyStepFiles, bool save, bool strict) const noexcept;
+                   bool minifyStepFiles, bool save, bool strict,
+                   const QString& jobs) const noexcept;
+  template <typename ElementType>
+  void processLibraryElements(const QString& libDir, const FilePath& libFp,
+                              const QStringList& elements, bool runCheck,
+                              bool minifyStepFiles, bool save, bool strict,
+                              int jobs, bool& success) const;
   void processLibraryElement(const QString& libDir, TransactionalFileSystem& fs,
                              LibraryBaseElement& element, bool runCheck,
                              bool minifyStepFiles, bool save, bool strict,
@@ -88,6 +103,14 @@ private:  // Methods
   static bool failIfFileFormatUnstable() noexcept;
   static void print(const QString& str) noexcept;
   static void printErr(const QString& str) noexcept;
+  static void printVerbose(const QString& str) noexcept;
+  static void captureOutput(OutputBuffer* buffer) noexcept;
+  static void flush(const OutputBuffer& output) noexcept;
+
+private:  // Data
+  /// If set, all console output of the current thread is captured in this
+  /// buffer (to be printed later with #flush()) instead of printing it.
+  static thread_local OutputBuffer* sCapturedOutput;
 };
 
 /*******************************************************************************
@@ -27,6 +27,7 @@
 #include "../types/pcbcolor.h"
 #include "../utils/clipperhelpers.h"
 #include "../utils/scopeguard.h"
+#include "../utils/tracer.h"
 #include "occmodel.h"
 #include "scenedata3d.h"
 
@@ -85,6 +86,7 @@ QString StepExport::run(std::shared_ptr<SceneData3D> data, FilePath fp,
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  LIBREPCB_TRACE_SCOPE("StepExport::run");
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start exporting STEP file in worker thread...";
@@ -35,95 +35,138 @@ namespace librepcb {
 
 QString AttributeSubstitutor::substitute(QString str, LookupFunction lookup,
                                          FilterFunction filter) noexcept {
+  return evaluate(compile(str), lookup, filter);
+}
+
+AttributeSubstitutor::Template AttributeSubstitutor::compile(
+    const QString& text) noexcept {
+  // Cost of cache entries is the text length, to limit the memory usage.
+  static QMutex mutex;
+  static QCache<QString, Template> cache(1000000);
+  if (text.isEmpty()) {
+    return Template();
+  }
+  {
+    QMutexLocker lock(&mutex);
+    if (const Template* cached = cache.object(text)) {
+      return *cached;
+    }
+  }
+
+  Template tmpl;
   int startPos = 0;
+  int pos = 0;
   int length = 0;
-  int outerVariableStart = -1;
-  int outerVariableEnd = -1;  // counted from end of string
-  QString value;
-  QStringList keys;
-  QSet<QString> keyBacktrace;  // avoid endless recursion
-  while (searchVariablesInText(str, startPos, startPos, length, keys)) {
-    if (filter && (startPos + length > str.length() - outerVariableEnd)) {
-      applyFilter(str, outerVariableStart, outerVariableEnd, filter);
-    }
-    if (filter && (outerVariableStart < 0)) {
-      outerVariableStart = startPos;
-      outerVariableEnd = str.length() - length - startPos;
-    }
-    bool keyFound = false;
-    foreach (const QString& key, keys) {
-      if (key.startsWith('\'') && key.endsWith('\'')) {
-        // replace "{{'VALUE'}}" with "VALUE"
-        str.replace(startPos, length, key.mid(1, key.length() - 2));
-        startPos +=
-            key.length() - 2;  // do not search for variables in the value
-        keyFound = true;
-        break;
-      } else if ((getValueOfKey(key, value, lookup)) &&
-                 (!keyBacktrace.contains(key))) {
-        // replace "{{KEY}}" with the value of KEY
-        str.replace(startPos, length, value);
-        keyBacktrace.insert(key);
-        keyFound = true;
-        break;
-      }
-    }
-    if (!keyFound) {
-      // attribute not found, remove "{{KEY}}" from str
-      str.remove(startPos, length);
+  while (searchVariableInText(text, startPos, pos, length)) {
+    if (pos > startPos) {
+      tmpl.append(Segment{text.mid(startPos, pos - startPos), QStringList()});
     }
+    tmpl.append(Segment{QString(), parseKeys(text, pos, length)});
+    startPos = pos + length;
   }
-  if (filter && (outerVariableStart >= 0)) {
-    applyFilter(str, outerVariableStart, outerVariableEnd, filter);
+  if (startPos < text.length()) {
+    tmpl.append(Segment{text.mid(startPos), QStringList()});
   }
-  return str;
+
+  QMutexLocker lock(&mutex);
+  cache.insert(text, new Template(tmpl), text.length());
+  return tmpl;
+}
+
+QString AttributeSubstitutor::evaluate(const Template& tmpl,
+                                       const LookupFunction& lookup,
+                                       const FilterFunction& filter) noexcept {
+  QHash<QString, QString> values;  // avoid redundant lookups
+  QSet<QString> backtrace;  // avoid endless recursion
+  return evaluateTemplate(tmpl, lookup, filter, values, backtrace);
 }
 
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
 
-bool AttributeSubstitutor::searchVariablesInText(const QString& text,
-                                                 int startPos, int& pos,
-                                                 int& length,
-                                                 QStringList& keys) noexcept {
-  QRegularExpression re("\\{\\{(.*?)\\}\\}");
-  QRegularExpressionMatch match = re.match(text, startPos);
-  if (match.hasMatch() && match.capturedLength() > 0) {
-    pos = match.capturedStart();
-    if (text.midRef(pos).startsWith("{{ '}}' }}")) {
-      // special case to escape '}}' as it doesn't work with the regex above
+bool AttributeSubstitutor::searchVariableInText(const QString& text,
+                                                int startPos, int& pos,
+                                                int& length) noexcept {
+  // Same as matching the regex "\{\{(.*?)\}\}", but much faster.
+  int start = text.indexOf("{{", startPos);
+  while (start >= 0) {
+    if (text.midRef(start).startsWith("{{ '}}' }}")) {
+      // special case to escape '}}' as it doesn't work with the search below
+      pos = start;
       length = 10;
-      keys = QStringList{"'}}'"};
-    } else {
-      length = match.capturedLength();
-      keys = match.captured(1).split(" or ");
-      for (QString& key : keys) {
-        key = key.trimmed();
-      }
+      return true;
+    }
+    const int end = text.indexOf("}}", start + 2);
+    if (end < 0) {
+      return false;
     }
-    return true;
-  } else {
-    return false;
+    const int newline = text.indexOf('\n', start + 2);
+    if ((newline < 0) || (newline > end)) {
+      pos = start;
+      length = end + 2 - start;
+      return true;
+    }
+    start = text.indexOf("{{", start + 1);
   }
+  return false;
 }
 
-void AttributeSubstitutor::applyFilter(QString& str, int& start, int& end,
-                                       FilterFunction filter) noexcept {
-  int length = str.length() - end - start;
-  str.replace(start, length, filter(str.mid(start, length)));
-  start = -1;
-  end = -1;
+QStringList AttributeSubstitutor::parseKeys(const QString& text, int pos,
+                                            int length) noexcept {
+  if ((length == 10) && text.midRef(pos).startsWith("{{ '}}' }}")) {
+    return QStringList{"'}}'"};
+  }
+  QStringList keys = text.mid(pos + 2, length - 4).split(" or ");
+  for (QString& key : keys) {
+    key = key.trimmed();
+  }
+  return keys;
 }
 
-bool AttributeSubstitutor::getValueOfKey(const QString& key, QString& value,
-                                         LookupFunction lookup) noexcept {
-  if (lookup) {
-    value = lookup(key);
-    return !value.isEmpty();
-  } else {
-    return false;
+QString AttributeSubstitutor::evaluateTemplate(
+    const Template& tmpl, const LookupFunction& lookup,
+    const FilterFunction& filter, QHash<QString, QString>& values,
+    QSet<QString>& backtrace) noexcept {
+  QString result;
+  foreach (const Segment& segment, tmpl) {
+    if (segment.keys.isEmpty()) {
+      result += segment.text;
+    } else {
+      const QString value =
+          evaluateVariable(segment.keys, lookup, values, backtrace);
+      result += filter ? filter(value) : value;
+    }
+  }
+  return result;
+}
+
+QString AttributeSubstitutor::evaluateVariable(
+    const QStringList& keys, const LookupFunction& lookup,
+    QHash<QString, QString>& values, QSet<QString>& backtrace) noexcept {
+  foreach (const QString& key, keys) {
+    if (key.startsWith('\'') && key.endsWith('\'')) {
+      // replace "{{'VALUE'}}" with "VALUE" (without substituting VALUE)
+      return key.mid(1, key.length() - 2);
+    } else if (lookup && (!backtrace.contains(key))) {
+      auto it = values.find(key);
+      if (it == values.end()) {
+        it = values.insert(key, lookup(key));
+      }
+      const QString value = it.value();
+      if (!value.isEmpty()) {
+        // replace "{{KEY}}" with the (recursively substituted) value of KEY
+        backtrace.insert(key);
+        const QString result = evaluateTemplate(
+            compile(value), lookup, FilterFunction(), values, backtrace);
+        backtrace.remove(key);
+        if (!result.isEmpty()) {
+          return result;
+        }
+      }
+    }
   }
+  return QString();  // attribute not found, remove "{{KEY}}"
 }
 
 /*******************************************************************************
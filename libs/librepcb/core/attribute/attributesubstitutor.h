@@ -47,18 +47,30 @@ namespace librepcb {
  * @see ::librepcb::ProjectAttributeLookup
  * @see @ref doc_attributes_system
  *
- * @todo Fix side-effect of the endless loop detection ("{{FOO}} {{FOO}}" is
- * currently substituted by "{{FOO}} " because of the endless loop detection,
- * even if there is actually no endless loop).
- * @todo Properly implement multiple key substitution ("{{FOO or BAR}}" is
- * currently substituted by "{{FOO}}", even if the attribute {{FOO}} indirectly
- * evaluates to an empty string).
+ * Texts are parsed once into a #Template of literal and variable segments
+ * (see #compile()). Compiled templates are cached, so repeatedly substituting
+ * the same texts (e.g. when rendering many board texts) only costs the
+ * attribute lookups.
  */
 class AttributeSubstitutor final {
 public:
+  // Types
   using LookupFunction = std::function<QString(const QString&)>;
   using FilterFunction = std::function<QString(const QString&)>;
 
+  /**
+   * @brief A segment of a compiled text, either a literal or a variable
+   */
+  struct Segment {
+    QString text;  ///< The literal text (only if #keys is empty)
+    QStringList keys;  ///< Variable keys, e.g. {"MPN", "VALUE", "'n/a'"}
+
+    bool operator==(const Segment& rhs) const noexcept {
+      return (text == rhs.text) && (keys == rhs.keys);
+    }
+  };
+  using Template = QVector<Segment>;
+
   // Constructors / Destructor / Operator Overloadings
   AttributeSubstitutor() = delete;
   AttributeSubstitutor(const AttributeSubstitutor& other) = delete;
@@ -79,36 +91,72 @@ public:
    *                  to remove invalid characters if the resulting string is
    *                  used for a file path.
    *
-   * @return True if str was modified in some way, false if not
+   * @return The substituted string
    */
   static QString substitute(QString str, LookupFunction lookup = nullptr,
                             FilterFunction filter = nullptr) noexcept;
 
+  /**
+   * @brief Parse a text into literal and variable segments
+   *
+   * The result is cached, i.e. compiling the same text again is cheap. This
+   * method is thread-safe.
+   *
+   * @param text      A text which can contain variables ("{{NAME}}").
+   *
+   * @return The compiled template (empty if the text is empty)
+   */
+  static Template compile(const QString& text) noexcept;
+
+  /**
+   * @brief Substitute all variables of a compiled template
+   *
+   * Values returned by the lookup function are substituted recursively, with
+   * loop detection per substitution path. If a key evaluates to an empty
+   * string, the next key of the variable is tried ("{{FOO or BAR}}").
+   *
+   * @param tmpl      The compiled template, see #compile().
+   * @param lookup    The attribute lookup function (key -> value). Each key
+   *                  is looked up at most once per call.
+   * @param filter    See #substitute().
+   *
+   * @return The substituted string
+   */
+  static QString evaluate(const Template& tmpl,
+                          const LookupFunction& lookup = nullptr,
+                          const FilterFunction& filter = nullptr) noexcept;
+
 private:  // Methods
   /**
-   * @brief Search the next variables (e.g. "{{KEY or FALLBACK}}") in a given
+   * @brief Search the next variable (e.g. "{{KEY or FALLBACK}}") in a given
    * text
    *
    * @param text      A text which can contain variables
    * @param startPos  The search start index (use 0 to search in the whole text)
    * @param pos       The index of the next variable in the specified text
-   * (index of the first '{' character, or -1 if no variable found) will be
-   *                  written into this variable.
+   *                  (index of the first '{' character) will be written into
+   *                  this variable.
    * @param length    If a variable is found, the length (incl. '{{}}') will be
    *                  written into this variable.
-   * @param keys      The variable key names (text between '{{' and '}}', split
-   * by ' or ')
    *
    * @return          true if a variable is found, false if not
    */
-  static bool searchVariablesInText(const QString& text, int startPos, int& pos,
-                                    int& length, QStringList& keys) noexcept;
+  static bool searchVariableInText(const QString& text, int startPos, int& pos,
+                                   int& length) noexcept;
+
+  static QStringList parseKeys(const QString& text, int pos,
+                               int length) noexcept;
 
-  static void applyFilter(QString& str, int& start, int& end,
-                          FilterFunction filter) noexcept;
+  static QString evaluateTemplate(const Template& tmpl,
+                                  const LookupFunction& lookup,
+                                  const FilterFunction& filter,
+                                  QHash<QString, QString>& values,
+                                  QSet<QString>& backtrace) noexcept;
 
-  static bool getValueOfKey(const QString& key, QString& value,
-                            LookupFunction lookup) noexcept;
+  static QString evaluateVariable(const QStringList& keys,
+                                  const LookupFunction& lookup,
+                                  QHash<QString, QString>& values,
+                                  QSet<QString>& backtrace) noexcept;
 };
 
 /*******************************************************************************
@@ -24,6 +24,7 @@
 
 #include "../application.h"
 #include "../fileio/fileutils.h"
+#include "../utils/tracer.h"
 #include "graphicsexportsettings.h"
 #include "utils/qtmetatyperegistration.h"
 
@@ -129,6 +130,7 @@ GraphicsExport::Result GraphicsExport::run(RunArgs args) noexcept {
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  LIBREPCB_TRACE_SCOPE("GraphicsExport::run");
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start graphics export in worker thread...";
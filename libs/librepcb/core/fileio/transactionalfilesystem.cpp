@@ -185,7 +185,9 @@ QByteArray TransactionalFileSystem::readIfExists(const QString& path) const {
   } else if (!isRemoved(cleanedPath)) {
     const FilePath fp = mFilePath.getPathTo(cleanedPath);
     if (fp.isExistingFile()) {
-      return FileUtils::readFile(fp);  // can throw
+      const QByteArray content = FileUtils::readFile(fp);  // can throw
+      mDiskChecksums.insert(cleanedPath, calcChecksum(content));
+      return content;
     }
   }
   return QByteArray();
@@ -195,8 +197,15 @@ void TransactionalFileSystem::write(const QString& path,
                                     const QByteArray& content) {
   const QString cleanedPath = cleanPath(path);
   QMutexLocker lock(&mMutex);
-  mModifiedFiles[cleanedPath] = content;
   mRemovedFiles.remove(cleanedPath);
+  auto it = mDiskChecksums.constFind(cleanedPath);
+  if ((it != mDiskChecksums.constEnd()) && (!isRemoved(cleanedPath)) &&
+      (it.value() == calcChecksum(content))) {
+    // Same content as on the disk -> not modified (anymore).
+    mModifiedFiles.remove(cleanedPath);
+  } else {
+    mModifiedFiles[cleanedPath] = content;
+  }
 }
 
 void TransactionalFileSystem::renameFile(const QString& src,
@@ -389,10 +398,22 @@ void TransactionalFileSystem::save() {
     }
   }
 
+  // forget checksums of removed files
+  for (auto it = mDiskChecksums.begin(); it != mDiskChecksums.end();) {
+    if (isRemoved(it.key())) {
+      it = mDiskChecksums.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
   // save new or modified files
-  foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+  for (auto it = mModifiedFiles.constBegin(); it != mModifiedFiles.constEnd();
+       ++it) {
+    mDiskChecksums.remove(it.key());  // In case writing fails.
+    FileUtils::writeFile(mFilePath.getPathTo(it.key()),
+                         it.value());  // can throw
+    mDiskChecksums.insert(it.key(), calcChecksum(it.value()));
   }
 
   // remove backup
@@ -423,6 +444,11 @@ QString TransactionalFileSystem::cleanPath(QString path) noexcept {
  *  Private Methods
  ******************************************************************************/
 
+QByteArray TransactionalFileSystem::calcChecksum(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Sha1);
+}
+
 bool TransactionalFileSystem::isRemoved(const QString& path) const noexcept {
   if (mRemovedFiles.contains(path)) {
     return true;
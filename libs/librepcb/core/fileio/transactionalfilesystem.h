@@ -60,6 +60,11 @@ namespace librepcb {
  *  - Holds all file modifications in memory and allows to write those in an
  *    atomic way to the disk (see @ref doc_project_save).
  *  - Allows to export the whole file system to a ZIP file.
+ *  - Writing a file with the same content as it has on the disk (e.g. when
+ *    re-serializing unmodified documents) does not mark it as modified, so
+ *    (auto)saving only writes files which were really modified. To detect
+ *    that without touching the disk, a checksum of each file read from or
+ *    written to the disk is memorized.
  *
  * In addition, all public methods of this class are thread-safe, i.e.
  * concurrent access to the file system from multiple threads is allowed.
@@ -208,6 +213,7 @@ public:
 
 private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
+  static QByteArray calcChecksum(const QByteArray& content) noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir, FilterFunction filter) const;
   void saveDiff(const QString& type) const;
@@ -225,6 +231,10 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString> mRemovedFiles;
   QSet<QString> mRemovedDirs;
+
+  /// Checksums of files as they are on the disk (only for files read from or
+  /// written to the disk, thus might be incomplete)
+  mutable QHash<QString, QByteArray> mDiskChecksums;
 };
 
 /*******************************************************************************
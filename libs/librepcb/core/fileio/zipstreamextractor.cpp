@@ -0,0 +1,394 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "zipstreamextractor.h"
+
+#include "../exceptions.h"
+#include "fileutils.h"
+
+#include <QtConcurrent>
+#include <QtCore>
+
+#include <zlib.h>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+// ZIP record signatures, see APPNOTE.TXT of the ZIP file format specification
+static const quint32 sLocalFileHeaderSignature = 0x04034b50;
+static const quint32 sDataDescriptorSignature = 0x08074b50;
+static const quint32 sCentralDirectorySignature = 0x02014b50;
+static const quint32 sEndOfCentralDirectorySignature = 0x06054b50;
+static const int sLocalFileHeaderSize = 30;
+static const int sInflateChunkSize = 64 * 1024;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+ZipStreamExtractor::ZipStreamExtractor(const FilePath& dir) noexcept
+  : mDirectory(dir),
+    mSupported(true),
+    mState(State::LocalHeader),
+    mBuffer(),
+    mBufferPos(0),
+    mEntryPath(),
+    mEntryIsDirectory(false),
+    mEntryIsDeflated(false),
+    mEntryHasDataDescriptor(false),
+    mEntryExpectedCrc(0),
+    mEntryRemainingSize(0),
+    mEntryContent(),
+    mInflateStream(),
+    mWriterPool(),
+    mPendingWrites(),
+    mPendingWriteBytes(0),
+    mExtractedFiles(),
+    mCreatedDirs() {
+  // Writing files is mostly I/O bound, so use some more threads than cores.
+  mWriterPool.setMaxThreadCount(qMax(QThread::idealThreadCount(), 4));
+}
+
+ZipStreamExtractor::~ZipStreamExtractor() noexcept {
+  mWriterPool.waitForDone();
+  if (mInflateStream) {
+    inflateEnd(mInflateStream.get());
+  }
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void ZipStreamExtractor::addData(const QByteArray& data) {
+  if ((!mSupported) || (mState == State::Finished)) {
+    return;
+  }
+
+  mBuffer.append(data);
+  bool progress = true;
+  while (progress && mSupported) {
+    switch (mState) {
+      case State::LocalHeader:
+        progress = processLocalHeader();  // can throw
+        break;
+      case State::EntryData:
+        progress = processEntryData();  // can throw
+        break;
+      case State::DataDescriptor:
+        progress = processDataDescriptor();  // can throw
+        break;
+      default:
+        progress = false;
+        break;
+    }
+  }
+
+  // Drop the processed data to keep memory usage low.
+  if ((!mSupported) || (mState == State::Finished)) {
+    mBuffer.clear();
+  } else {
+    mBuffer.remove(0, mBufferPos);
+  }
+  mBufferPos = 0;
+}
+
+void ZipStreamExtractor::finish() {
+  if (mSupported && (mState != State::Finished)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The ZIP file is incomplete or corrupt."));
+  }
+  waitForPendingWrites();  // can throw
+}
+
+void ZipStreamExtractor::removeExtractedFiles() noexcept {
+  mWriterPool.waitForDone();
+  mPendingWrites.clear();
+  mPendingWriteBytes = 0;
+  try {
+    foreach (const FilePath& fp, mExtractedFiles) {
+      if (fp.isExistingFile()) {
+        FileUtils::removeFile(fp);  // can throw
+      }
+    }
+  } catch (const Exception& e) {
+    qWarning() << "Failed to clean up extracted files:" << e.getMsg();
+  }
+
+  // Remove the created directories, subdirectories first. Directories which
+  // are not empty are kept since they are (also) used by someone else.
+  QList<FilePath> dirs = mCreatedDirs.values();
+  std::sort(dirs.begin(), dirs.end());
+  for (int i = dirs.count() - 1; i >= 0; --i) {
+    QDir().rmdir(dirs.at(i).toStr());
+  }
+  mExtractedFiles.clear();
+  mCreatedDirs.clear();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool ZipStreamExtractor::processLocalHeader() {
+  const int available = mBuffer.size() - mBufferPos;
+  if (available < 4) {
+    return false;
+  }
+  const quint32 signature = readUInt32(0);
+  if ((signature == sCentralDirectorySignature) ||
+      (signature == sEndOfCentralDirectorySignature)) {
+    // All entries are extracted, the rest of the file is not needed.
+    mState = State::Finished;
+    return false;
+  } else if (signature != sLocalFileHeaderSignature) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The file is not a valid ZIP file."));
+  }
+  if (available < sLocalFileHeaderSize) {
+    return false;
+  }
+  const quint16 flags = readUInt16(6);
+  const quint16 method = readUInt16(8);
+  const quint32 crc = readUInt32(14);
+  const quint32 compressedSize = readUInt32(18);
+  const int nameSize = readUInt16(26);
+  const int extraSize = readUInt16(28);
+  if (available < sLocalFileHeaderSize + nameSize + extraSize) {
+    return false;
+  }
+
+  // Check if this entry can be extracted without knowing the central
+  // directory. Stored entries with data descriptor have an unknown size and
+  // ZIP64 entries have their sizes in an extra field, so they are skipped.
+  bool isZip64 = (compressedSize == 0xFFFFFFFF);
+  for (int i = 0; (i + 4) <= extraSize;) {
+    const int offset = sLocalFileHeaderSize + nameSize + i;
+    isZip64 = isZip64 || (readUInt16(offset) == 0x0001);
+    i += 4 + readUInt16(offset + 2);
+  }
+  const bool isEncrypted = flags & 0x0001;
+  const bool hasDataDescriptor = flags & 0x0008;
+  const bool isDeflated = (method == Z_DEFLATED);
+  if (isZip64 || isEncrypted || ((method != 0) && (!isDeflated)) ||
+      (hasDataDescriptor && (!isDeflated))) {
+    qDebug() << "ZIP file is not supported for streaming extraction.";
+    mSupported = false;
+    return false;
+  }
+
+  // Determine destination path and reject paths outside the directory.
+  const QByteArray rawName =
+      mBuffer.mid(mBufferPos + sLocalFileHeaderSize, nameSize);
+  const QString name = (flags & 0x0800) ? QString::fromUtf8(rawName)
+                                        : QString::fromLocal8Bit(rawName);
+  mEntryPath = mDirectory.getPathTo(name);
+  if (!mEntryPath.isLocatedInDir(mDirectory)) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("Invalid file path in ZIP file: %1").arg(name));
+  }
+  mEntryIsDirectory = name.endsWith("/");
+  mEntryIsDeflated = isDeflated;
+  mEntryHasDataDescriptor = hasDataDescriptor;
+  mEntryExpectedCrc = crc;
+  mEntryRemainingSize = compressedSize;
+  mEntryContent.clear();
+  if (mEntryIsDeflated) {
+    // ZIP files contain raw deflate data, i.e. without zlib header.
+    mInflateStream.reset(new z_stream());
+    if (inflateInit2(mInflateStream.get(), -MAX_WBITS) != Z_OK) {
+      mInflateStream.reset();
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Failed to initialize the ZIP decompressor."));
+    }
+  }
+  mBufferPos += sLocalFileHeaderSize + nameSize + extraSize;
+  mState = State::EntryData;
+  return true;
+}
+
+bool ZipStreamExtractor::processEntryData() {
+  const int available = mBuffer.size() - mBufferPos;
+
+  // Stored entries are simply copied.
+  if (!mEntryIsDeflated) {
+    const int size = static_cast<int>(
+        qMin(static_cast<quint32>(available), mEntryRemainingSize));
+    mEntryContent.append(mBuffer.constData() + mBufferPos, size);
+    mBufferPos += size;
+    mEntryRemainingSize -= size;
+    if (mEntryRemainingSize == 0) {
+      finishEntry();  // can throw
+      return true;
+    }
+    return false;
+  }
+
+  // Deflated entries are inflated as far as possible. Without data descriptor
+  // the compressed size is known, otherwise the end of the deflate stream
+  // marks the end of the entry.
+  int inputSize = available;
+  if (!mEntryHasDataDescriptor) {
+    inputSize = static_cast<int>(
+        qMin(static_cast<quint32>(available), mEntryRemainingSize));
+  }
+  z_stream* stream = mInflateStream.get();
+  stream->next_in = reinterpret_cast<Bytef*>(
+      const_cast<char*>(mBuffer.constData() + mBufferPos));
+  stream->avail_in = static_cast<uInt>(inputSize);
+  int ret = Z_OK;
+  do {
+    const int oldSize = mEntryContent.size();
+    mEntryContent.resize(oldSize + sInflateChunkSize);
+    stream->next_out = reinterpret_cast<Bytef*>(mEntryContent.data() + oldSize);
+    stream->avail_out = sInflateChunkSize;
+    ret = inflate(stream, Z_NO_FLUSH);
+    mEntryContent.resize(oldSize + sInflateChunkSize - stream->avail_out);
+  } while ((ret == Z_OK) && (stream->avail_out == 0));
+  const int consumed = inputSize - static_cast<int>(stream->avail_in);
+  mBufferPos += consumed;
+  if (!mEntryHasDataDescriptor) {
+    mEntryRemainingSize -= consumed;
+  }
+
+  if (ret == Z_STREAM_END) {
+    inflateEnd(stream);
+    mInflateStream.reset();
+    if (mEntryHasDataDescriptor) {
+      mState = State::DataDescriptor;
+    } else if (mEntryRemainingSize == 0) {
+      finishEntry();  // can throw
+    } else {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("Corrupt entry in ZIP file: %1").arg(mEntryPath.toNative()));
+    }
+    return true;
+  } else if (((ret != Z_OK) && (ret != Z_BUF_ERROR)) ||
+             ((!mEntryHasDataDescriptor) && (mEntryRemainingSize == 0))) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("Corrupt entry in ZIP file: %1").arg(mEntryPath.toNative()));
+  }
+  return false;  // All available data consumed, wait for more.
+}
+
+bool ZipStreamExtractor::processDataDescriptor() {
+  // The signature of the data descriptor is optional.
+  const int available = mBuffer.size() - mBufferPos;
+  if (available < 4) {
+    return false;
+  }
+  const bool hasSignature = (readUInt32(0) == sDataDescriptorSignature);
+  const int size = hasSignature ? 16 : 12;
+  if (available < size) {
+    return false;
+  }
+  mEntryExpectedCrc = readUInt32(hasSignature ? 4 : 0);
+  mBufferPos += size;
+  finishEntry();  // can throw
+  return true;
+}
+
+void ZipStreamExtractor::finishEntry() {
+  // Verify the checksum before writing anything to disk.
+  const quint32 crc =
+      crc32(0, reinterpret_cast<const Bytef*>(mEntryContent.constData()),
+            static_cast<uInt>(mEntryContent.size()));
+  if (crc != mEntryExpectedCrc) {
+    throw RuntimeError(
+        __FILE__, __LINE__,
+        tr("CRC error in ZIP file: %1").arg(mEntryPath.toNative()));
+  }
+
+  rememberCreatedDirs(mEntryIsDirectory ? mEntryPath
+                                        : mEntryPath.getParentDir());
+  if (mEntryIsDirectory) {
+    FileUtils::makePath(mEntryPath);  // can throw
+  } else {
+    const FilePath fp = mEntryPath;
+    const QByteArray content = mEntryContent;
+    // If the disk is slower than the download, limit the memory held by the
+    // pending writes by waiting for the oldest ones.
+    while ((!mPendingWrites.isEmpty()) &&
+           ((mPendingWriteBytes + content.size()) > sMaxPendingWriteBytes)) {
+      waitForOldestWrite();  // can throw
+    }
+    QFuture<void> future = QtConcurrent::run(&mWriterPool, [fp, content]() {
+      FileUtils::writeFile(fp, content);  // can throw
+    });
+    mPendingWrites.append(
+        std::make_pair(future, static_cast<qint64>(content.size())));
+    mPendingWriteBytes += content.size();
+    mExtractedFiles.append(fp);
+  }
+  mEntryContent.clear();
+  mState = State::LocalHeader;
+
+  // Report write errors as early as possible.
+  while ((!mPendingWrites.isEmpty()) &&
+         mPendingWrites.first().first.isFinished()) {
+    waitForOldestWrite();  // can throw
+  }
+}
+
+void ZipStreamExtractor::rememberCreatedDirs(const FilePath& dir) noexcept {
+  // Parent directories of files are created by the writer threads, so
+  // directories already remembered may not exist yet.
+  for (FilePath fp = dir; fp.isValid() && (!mCreatedDirs.contains(fp)) &&
+       (!fp.isExistingDir());
+       fp = fp.getParentDir()) {
+    mCreatedDirs.insert(fp);
+  }
+}
+
+void ZipStreamExtractor::waitForOldestWrite() {
+  std::pair<QFuture<void>, qint64> write = mPendingWrites.takeFirst();
+  mPendingWriteBytes -= write.second;
+  write.first.waitForFinished();  // can throw
+}
+
+void ZipStreamExtractor::waitForPendingWrites() {
+  while (!mPendingWrites.isEmpty()) {
+    waitForOldestWrite();  // can throw
+  }
+}
+
+quint16 ZipStreamExtractor::readUInt16(int offset) const noexcept {
+  const char* data = mBuffer.constData() + mBufferPos + offset;
+  return qFromLittleEndian<quint16>(reinterpret_cast<const uchar*>(data));
+}
+
+quint32 ZipStreamExtractor::readUInt32(int offset) const noexcept {
+  const char* data = mBuffer.constData() + mBufferPos + offset;
+  return qFromLittleEndian<quint32>(reinterpret_cast<const uchar*>(data));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,173 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_ZIPSTREAMEXTRACTOR_H
+#define LIBREPCB_CORE_ZIPSTREAMEXTRACTOR_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "filepath.h"
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+struct z_stream_s;
+
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class ZipStreamExtractor
+ ******************************************************************************/
+
+/**
+ * @brief Extracts a ZIP file while its content is still being received
+ *
+ * In contrast to QuaZip, this class does not need the central directory at
+ * the end of the archive. Instead, the local file headers are parsed
+ * sequentially, so every entry is inflated and CRC-checked as soon as its
+ * data has been passed to #addData(). The extracted files are written to
+ * disk by a thread pool, thus writing many small files doesn't block the
+ * thread feeding the data.
+ *
+ * Some archives can't be extracted this way (e.g. ZIP64 or encrypted
+ * entries). In that case, #isSupported() returns false and all further data
+ * is ignored, so the caller needs to fall back to extracting the completely
+ * received file.
+ */
+class ZipStreamExtractor final {
+  Q_DECLARE_TR_FUNCTIONS(ZipStreamExtractor)
+
+public:
+  // Constructors / Destructor
+  ZipStreamExtractor() = delete;
+  ZipStreamExtractor(const ZipStreamExtractor& other) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * @param dir   Destination directory (may or may not exist)
+   */
+  explicit ZipStreamExtractor(const FilePath& dir) noexcept;
+
+  /**
+   * @brief Destructor
+   *
+   * Blocks until all pending file writes are completed.
+   */
+  ~ZipStreamExtractor() noexcept;
+
+  // Getters
+  const FilePath& getDirectory() const noexcept { return mDirectory; }
+  bool isSupported() const noexcept { return mSupported; }
+  const QList<FilePath>& getExtractedFiles() const noexcept {
+    return mExtractedFiles;
+  }
+
+  // General Methods
+
+  /**
+   * @brief Process the next chunk of the ZIP file
+   *
+   * @param data    Received data, directly following the previous chunk.
+   *
+   * @throw Exception if the ZIP file is corrupt.
+   */
+  void addData(const QByteArray& data);
+
+  /**
+   * @brief Finish the extraction after all data has been passed
+   *
+   * Blocks until all files are written to disk.
+   *
+   * @throw Exception if the ZIP file is incomplete or a file could not be
+   *        written.
+   */
+  void finish();
+
+  /**
+   * @brief Remove all files extracted so far, e.g. after an error occurred
+   *
+   * Directories created by the extraction are removed too, as long as they
+   * are empty afterwards. Anything else in the destination directory (e.g.
+   * files written by someone else in the meantime) is kept.
+   */
+  void removeExtractedFiles() noexcept;
+
+  // Operator Overloadings
+  ZipStreamExtractor& operator=(const ZipStreamExtractor& rhs) = delete;
+
+private:  // Types
+  enum class State {
+    LocalHeader,  ///< Waiting for the next local file header
+    EntryData,  ///< Receiving the (compressed) data of an entry
+    DataDescriptor,  ///< Waiting for the data descriptor of an entry
+    Finished,  ///< Central directory reached, ignoring remaining data
+  };
+
+private:  // Methods
+  bool processLocalHeader();
+  bool processEntryData();
+  bool processDataDescriptor();
+  void finishEntry();
+  void rememberCreatedDirs(const FilePath& dir) noexcept;
+  void waitForOldestWrite();
+  void waitForPendingWrites();
+  quint16 readUInt16(int offset) const noexcept;
+  quint32 readUInt32(int offset) const noexcept;
+
+private:  // Data
+  /// Max. size of file contents held in memory until written to disk
+  static constexpr qint64 sMaxPendingWriteBytes = 32 * 1024 * 1024;
+
+  FilePath mDirectory;
+  bool mSupported;
+  State mState;
+  QByteArray mBuffer;  ///< Received but not yet processed data
+  int mBufferPos;  ///< Number of already processed bytes in #mBuffer
+
+  // Current entry
+  FilePath mEntryPath;
+  bool mEntryIsDirectory;
+  bool mEntryIsDeflated;
+  bool mEntryHasDataDescriptor;
+  quint32 mEntryExpectedCrc;
+  quint32 mEntryRemainingSize;  ///< Compressed size, if known
+  QByteArray mEntryContent;
+  std::unique_ptr<z_stream_s> mInflateStream;
+
+  // File writing
+  QThreadPool mWriterPool;
+  QList<std::pair<QFuture<void>, qint64>> mPendingWrites;  ///< With size
+  qint64 mPendingWriteBytes;  ///< Total size of #mPendingWrites
+  QList<FilePath> mExtractedFiles;
+  QSet<FilePath> mCreatedDirs;  ///< Directories not existing before
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -41,7 +41,11 @@ namespace fb = fontobene;
 
 StrokeFont::StrokeFont(const FilePath& fontFilePath,
                        const QByteArray& content) noexcept
-  : QObject(nullptr), mFilePath(fontFilePath) {
+  : QObject(nullptr),
+    mFilePath(fontFilePath),
+    mFontMutex(QMutex::Recursive),
+    mGlyphCache(10000),
+    mLayoutCache(10000) {
   // load the font in another thread because it takes some time to load it
   qDebug() << "Start loading stroke font " << mFilePath.toNative()
            << "in worker thread...";
@@ -81,6 +85,17 @@ QVector<Path> StrokeFont::stroke(const QString& text,
                                  const Length& lineSpacing,
                                  const Alignment& align, Point& bottomLeft,
                                  Point& topRight) const noexcept {
+  const LayoutKey key{text, *height, letterSpacing, lineSpacing,
+                      static_cast<int>(align.toQtAlign())};
+  {
+    QMutexLocker lock(&mCacheMutex);
+    if (const Layout* layout = mLayoutCache.object(key)) {
+      bottomLeft = layout->bottomLeft;
+      topRight = layout->topRight;
+      return layout->paths;
+    }
+  }
+
   accessor();  // block until the font is loaded. TODO: abort instead of
                // waiting?
   QVector<Path> paths;
@@ -131,6 +146,11 @@ QVector<Path> StrokeFont::stroke(const QString& text,
     topRight.setY(totalHeight / 2);
   }
 
+  // The cached paths are shared with all callers (implicit sharing), so build
+  // their lazily cached painter paths now, before other threads can see them.
+  buildPainterPaths(paths);
+  QMutexLocker lock(&mCacheMutex);
+  mLayoutCache.insert(key, new Layout{paths, bottomLeft, topRight});
   return paths;
 }
 
@@ -155,22 +175,19 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
   Length offset = 0;
   width = 0;  // same as offset, but without last letter spacing
   for (int i = 0; i < text.length(); ++i) {
-    Length glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
-      Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
+    const Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
+      Length shift = (i == 0) ? -glyph.bottomLeft.getX()
+                              : 0;  // left-align first character
+      foreach (const Path& p, glyph.paths) {
         paths.append(p.translated(Point(offset + shift, Length(0))));
       }
-      width = offset + topRight.getX() +
+      width = offset + glyph.topRight.getX() +
           shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
       // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width = offset + glyphSpacing;
+      width = offset + glyph.spacing;
       offset = width + letterSpacing;
     }
   }
@@ -180,18 +197,9 @@ QVector<Path> StrokeFont::strokeLine(const QString& text,
 QVector<Path> StrokeFont::strokeGlyph(const QChar& glyph,
                                       const PositiveLength& height,
                                       Length& spacing) const noexcept {
-  try {
-    qreal glyphSpacing = 0;
-    QVector<fb::Polyline> polylines =
-        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                          &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
-  } catch (const fb::Exception& e) {
-    qWarning().nospace() << "Failed to load stroke font glyph " << glyph << ".";
-    spacing = 0;
-    return QVector<Path>();
-  }
+  const Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
 }
 
 /*******************************************************************************
@@ -202,7 +210,45 @@ void StrokeFont::fontLoaded() noexcept {
   accessor();  // trigger the message about loading succeeded or failed
 }
 
+StrokeFont::Glyph StrokeFont::getGlyph(
+    const QChar& glyph, const PositiveLength& height) const noexcept {
+  const QPair<uint, qint64> key(glyph.unicode(), height->toNm());
+  {
+    QMutexLocker lock(&mCacheMutex);
+    if (const Glyph* cached = mGlyphCache.object(key)) {
+      return *cached;
+    }
+  }
+  const Glyph result = strokeGlyphUncached(glyph, height);
+  buildPainterPaths(result.paths);  // see stroke()
+  QMutexLocker lock(&mCacheMutex);
+  mGlyphCache.insert(key, new Glyph(result));
+  return result;
+}
+
+StrokeFont::Glyph StrokeFont::strokeGlyphUncached(
+    const QChar& glyph, const PositiveLength& height) const noexcept {
+  Glyph result;
+  try {
+    qreal glyphSpacing = 0;
+    QMutexLocker lock(&mFontMutex);  // glyph list accessor is not reentrant
+    QVector<fb::Polyline> polylines =
+        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
+                                          &glyphSpacing);  // can throw
+    result.spacing = convertLength(height, glyphSpacing);
+    result.paths = polylines2paths(polylines, height);
+    if (!result.paths.isEmpty()) {
+      computeBoundingRect(result.paths, result.bottomLeft, result.topRight);
+    }
+  } catch (const fb::Exception& e) {
+    qWarning().nospace() << "Failed to load stroke font glyph " << glyph << ".";
+    result = Glyph();
+  }
+  return result;
+}
+
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
+  QMutexLocker lock(&mFontMutex);
   if (!mFont) {
     try {
       mFont.reset(new fb::Font(mFuture.result()));  // can throw
@@ -238,6 +284,12 @@ QVector<Path> StrokeFont::polylines2paths(
   return paths;
 }
 
+void StrokeFont::buildPainterPaths(const QVector<Path>& paths) noexcept {
+  foreach (const Path& path, paths) {
+    path.toQPainterPathPx();
+  }
+}
+
 Path StrokeFont::polyline2path(const fb::Polyline& p,
                                const PositiveLength& height) noexcept {
   Path path;
@@ -50,6 +50,12 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * Since the same glyphs and texts (e.g. `{{NAME}}` or `{{VALUE}}` of many
+ * devices) are stroked over and over again, both the glyphs and the stroked
+ * texts are cached in memory. The returned path vectors of identical texts
+ * share their data (implicit sharing). All methods are thread-safe: the
+ * lazily loaded font and the caches are guarded by mutexes.
  */
 class StrokeFont final : public QObject {
   Q_OBJECT
@@ -81,12 +87,50 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
-private:
+private:  // Types
+  struct Glyph {
+    QVector<Path> paths;
+    Length spacing;
+    Point bottomLeft;
+    Point topRight;
+  };
+  struct Layout {
+    QVector<Path> paths;
+    Point bottomLeft;
+    Point topRight;
+  };
+  struct LayoutKey {
+    QString text;
+    Length height;
+    Length letterSpacing;
+    Length lineSpacing;
+    int align;  ///< Qt::Alignment
+
+    bool operator==(const LayoutKey& rhs) const noexcept {
+      return (text == rhs.text) && (height == rhs.height) &&
+          (letterSpacing == rhs.letterSpacing) &&
+          (lineSpacing == rhs.lineSpacing) && (align == rhs.align);
+    }
+    friend uint qHash(const LayoutKey& key, uint seed = 0) noexcept {
+      seed = ::qHash(key.text, seed);
+      seed = ::qHash(key.height.toNm(), seed);
+      seed = ::qHash(key.letterSpacing.toNm(), seed);
+      seed = ::qHash(key.lineSpacing.toNm(), seed);
+      return ::qHash(key.align, seed);
+    }
+  };
+
+private:  // Methods
   void fontLoaded() noexcept;
+  Glyph getGlyph(const QChar& glyph,
+                 const PositiveLength& height) const noexcept;
+  Glyph strokeGlyphUncached(const QChar& glyph,
+                            const PositiveLength& height) const noexcept;
   const fontobene::GlyphListAccessor& accessor() const noexcept;
   static QVector<Path> polylines2paths(
       const QVector<fontobene::Polyline>& polylines,
       const PositiveLength& height) noexcept;
+  static void buildPainterPaths(const QVector<Path>& paths) noexcept;
   static Path polyline2path(const fontobene::Polyline& p,
                             const PositiveLength& height) noexcept;
   static Vertex convertVertex(const fontobene::Vertex& v,
@@ -103,6 +147,12 @@ private:  // Data
   mutable QScopedPointer<fontobene::Font> mFont;
   mutable QScopedPointer<fontobene::GlyphListCache> mGlyphListCache;
   mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+  mutable QMutex mFontMutex;  ///< Guards lazy loading & glyph list access
+
+  // Caches
+  mutable QMutex mCacheMutex;
+  mutable QCache<QPair<uint, qint64>, Glyph> mGlyphCache;  ///< Key: (char, h)
+  mutable QCache<LayoutKey, Layout> mLayoutCache;
 };
 
 /*******************************************************************************
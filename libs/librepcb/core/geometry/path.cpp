@@ -23,6 +23,7 @@
 #include "path.h"
 
 #include "../serialization/sexpression.h"
+#include "../utils/clipperhelpers.h"
 #include "../utils/toolbox.h"
 
 #include <QtCore>
@@ -139,7 +140,9 @@ QVector<Path> Path::toOutlineStrokes(
 }
 
 const QPainterPath& Path::toQPainterPathPx() const noexcept {
-  if (mPainterPathPx.isEmpty()) {
+  // Note: Don't use QPainterPath::isEmpty() since it is also true for a path
+  // containing only a single vertex, which would then be appended on each call.
+  if (mPainterPathPx.elementCount() == 0) {
     for (int i = 0; i < mVertices.count(); ++i) {
       const Vertex& v = mVertices.at(i);
       if (i == 0) {
@@ -243,18 +246,24 @@ Path& Path::flattenArcs(const PositiveLength& maxTolerance) noexcept {
   if (!mVertices.isEmpty()) {
     mVertices.last().setAngle(Angle::deg0());
   }
-  for (int i = mVertices.count() - 2; i >= 0; --i) {
-    if (mVertices.at(i).getAngle() != Angle::deg0()) {
-      const Path arc =
-          flatArc(mVertices.at(i).getPos(), mVertices.at(i + 1).getPos(),
-                  mVertices.at(i).getAngle(), maxTolerance);
-      Q_ASSERT(arc.getVertices().count() >= 2);
-      mVertices.insert(i + 1, arc.getVertices().count() - 2, Vertex());
-      for (int k = 0; k < arc.getVertices().count(); ++k) {
-        mVertices[i + k] = arc.getVertices().at(k);
+  ClipperLib::Path points;
+  QVector<Vertex> vertices;
+  vertices.reserve(mVertices.count());
+  for (int i = 0; i < mVertices.count(); ++i) {
+    const Vertex& v = mVertices.at(i);
+    if (v.getAngle() != Angle::deg0()) {
+      points.clear();
+      ClipperHelpers::flattenArc(points, v.getPos(),
+                                 mVertices.at(i + 1).getPos(), v.getAngle(),
+                                 maxTolerance);
+      for (const ClipperLib::IntPoint& point : points) {
+        vertices.append(Vertex(ClipperHelpers::convert(point)));
       }
+    } else {
+      vertices.append(v);
     }
   }
+  mVertices = vertices;
   invalidatePainterPath();
   return *this;
 }
@@ -517,32 +526,14 @@ Path Path::octagon(const PositiveLength& width, const PositiveLength& height,
 
 Path Path::flatArc(const Point& p1, const Point& p2, const Angle& angle,
                    const PositiveLength& maxTolerance) noexcept {
-  // return straight line if radius is smaller than half of the allowed
-  // tolerance
-  Length radiusAbs = Toolbox::arcRadius(p1, p2, angle).abs();
-  if (radiusAbs <= maxTolerance / 2) {
-    return line(p1, p2);
-  }
-
-  // calculate how many lines we need to create
-  qreal radiusAbsNm = static_cast<qreal>(radiusAbs.toNm());
-  qreal y = qBound(qreal(0.0), static_cast<qreal>(maxTolerance->toNm()),
-                   radiusAbsNm / qreal(4));
-  qreal stepsPerRad =
-      qMin(qreal(0.5) / qAcos(1 - y / radiusAbsNm), radiusAbsNm / qreal(2));
-  int steps = qCeil(stepsPerRad * angle.abs().toRad());
-
-  // some other very complex calculations...
-  qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
-  Point center = Toolbox::arcCenter(p1, p2, angle);
-
-  // create line segments
+  ClipperLib::Path points;
+  ClipperHelpers::flattenArc(points, p1, p2, angle, maxTolerance);
   Path p;
-  p.addVertex(p1);
-  for (int i = 1; i < steps; ++i) {
-    p.addVertex(p1.rotated(Angle(angleDelta * i), center));
+  p.mVertices.reserve(points.size() + 1);
+  for (const ClipperLib::IntPoint& point : points) {
+    p.mVertices.append(Vertex(ClipperHelpers::convert(point)));
   }
-  p.addVertex(p2);
+  p.mVertices.append(Vertex(p2));
   return p;
 }
 
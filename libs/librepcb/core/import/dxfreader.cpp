@@ -22,11 +22,15 @@
  ******************************************************************************/
 #include "dxfreader.h"
 
+#include "../exceptions.h"
 #include "../fileio/filepath.h"
+#include "../utils/toolbox.h"
 
 #include <dl_creationadapter.h>
 #include <dl_dxf.h>
 
+#include <fstream>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -48,25 +52,40 @@ namespace librepcb {
  */
 class DxfReaderImpl : public DL_CreationAdapter {
 public:
-  DxfReaderImpl(DxfReader& reader)
+  DxfReaderImpl(const DxfReader& reader, const DxfReader::Sink& sink,
+                std::istream& stream, qint64 fileSize)
     : mReader(reader),
+      mSink(sink),
+      mStream(stream),
+      mFileSize(fileSize),
+      mEntityCount(0),
+      mProgress(-1),
       mScaleToMm(1),
+      mPolylineSkipped(false),
       mPolylineClosed(false),
       mPolylineVertices(0),
-      mPolylinePath() {}
+      mPolylinePath(),
+      mPendingPath(),
+      mRemovedPoints() {}
 
   virtual ~DxfReaderImpl() {}
 
   virtual void addPoint(const DL_PointData& data) override {
-    mReader.mPoints.append(point(data.x, data.y));
+    if (acceptEntity() && mSink.point) {
+      mSink.point(point(data.x, data.y));
+    }
   }
 
   virtual void addLine(const DL_LineData& data) override {
-    mReader.mPolygons.append(
-        Path::line(point(data.x1, data.y1), point(data.x2, data.y2)));
+    if (acceptEntity()) {
+      addPath(Path::line(point(data.x1, data.y1), point(data.x2, data.y2)));
+    }
   }
 
   virtual void addArc(const DL_ArcData& data) override {
+    if (!acceptEntity()) {
+      return;
+    }
     Point center = point(data.cx, data.cy);
     Length radius = length(data.radius);
     Angle angle1 = angle(data.angle1);
@@ -78,14 +97,19 @@ public:
     if (angle < 0) {
       angle.invert();
     }
-    mReader.mPolygons.append(Path::line(p1, p2, angle));
+    addPath(Path::line(p1, p2, angle));
   }
 
   virtual void addCircle(const DL_CircleData& data) override {
+    if (!acceptEntity()) {
+      return;
+    }
     Length diameter = length(data.radius * 2);
     if (diameter > 0) {
-      mReader.mCircles.append(
-          DxfReader::Circle{point(data.cx, data.cy), PositiveLength(diameter)});
+      if (mSink.circle) {
+        mSink.circle(DxfReader::Circle{point(data.cx, data.cy),
+                                       PositiveLength(diameter)});
+      }
     } else {
       qWarning() << "Circle in DXF file ignored due to invalid radius:"
                  << data.radius;
@@ -94,16 +118,24 @@ public:
 
   virtual void addEllipse(const DL_EllipseData& data) override {
     Q_UNUSED(data);
-    qWarning() << "Ellipse in DXF file ignored since it is not supported yet.";
+    if (acceptEntity()) {
+      qWarning()
+          << "Ellipse in DXF file ignored since it is not supported yet.";
+    }
   }
 
   virtual void addPolyline(const DL_PolylineData& data) override {
+    // The vertices belong to the layer of the polyline.
+    mPolylineSkipped = !acceptEntity();
     mPolylineClosed = (data.flags & DL_CLOSED_PLINE) != 0;
     mPolylineVertices = data.number;
     mPolylinePath = Path();
   }
 
   virtual void addVertex(const DL_VertexData& data) override {
+    if (mPolylineSkipped) {
+      return;
+    }
     mPolylinePath.addVertex(point(data.x, data.y), bulgeToAngle(data.bulge));
     if (mPolylinePath.getVertices().count() == mPolylineVertices) {
       endSequence();
@@ -115,7 +147,7 @@ public:
       if (mPolylineClosed && (mPolylinePath.getVertices().count() >= 3)) {
         mPolylinePath.close();
       }
-      mReader.mPolygons.append(mPolylinePath);
+      addPath(mPolylinePath);
     }
     mPolylinePath = Path();
   }
@@ -143,7 +175,112 @@ public:
     }
   }
 
+  void finish() {
+    flushPath();
+    if (mSink.progress) {
+      mSink.progress(100);
+    }
+  }
+
 private:  // Methods
+  /**
+   * @brief Report progress and check the layer filter for a new entity
+   *
+   * @return Whether the current entity shall be imported or not.
+   */
+  bool acceptEntity() {
+    // Determining the stream position is not for free, so do it only from
+    // time to time.
+    if (mSink.progress && (mFileSize > 0) && ((++mEntityCount % 256) == 1)) {
+      const qint64 pos = static_cast<qint64>(mStream.tellg());
+      const qint64 percent = (pos * 99) / mFileSize;
+      const int progress =
+          static_cast<int>(qBound(qint64(0), percent, qint64(99)));
+      if (progress != mProgress) {
+        mProgress = progress;
+        mSink.progress(progress);
+      }
+    }
+    if (mReader.mLayerFilter.isEmpty()) {
+      return true;
+    }
+    const QString layer =
+        QString::fromStdString(getAttributes().getLayer()).toLower();
+    return mReader.mLayerFilter.contains(layer);
+  }
+
+  void addPath(const Path& path) {
+    const QVector<Vertex>& pending = mPendingPath.getVertices();
+    const QVector<Vertex>& vertices = path.getVertices();
+    if (vertices.count() < 2) {
+      return;
+    }
+    if (mReader.mMergePolylines && (pending.count() >= 2) &&
+        (!mPendingPath.isClosed()) && (!path.isClosed())) {
+      if (vertices.first().getPos() == pending.last().getPos()) {
+        appendPath(path);
+        return;
+      } else if (vertices.last().getPos() == pending.last().getPos()) {
+        appendPath(path.reversed());
+        return;
+      }
+    }
+    flushPath();
+    mPendingPath.addVertex(vertices.first());
+    appendPath(path);
+  }
+
+  void appendPath(const Path& path) {
+    const QVector<Vertex>& vertices = path.getVertices();
+    mPendingPath.getVertices().last().setAngle(vertices.first().getAngle());
+    for (int i = 1; i < vertices.count(); ++i) {
+      appendVertex(vertices.at(i));
+    }
+    // A closed outline can't be extended anymore, so pass it to the sink.
+    if (mPendingPath.isClosed()) {
+      flushPath();
+    }
+  }
+
+  void appendVertex(const Vertex& vertex) {
+    QVector<Vertex>& vertices = mPendingPath.getVertices();
+    const int count = vertices.count();
+    if ((mReader.mArcTolerance > 0) && (count >= 2) &&
+        (vertices.at(count - 2).getAngle() == 0) &&
+        (vertices.at(count - 1).getAngle() == 0)) {
+      // The last vertex lies between two straight segments. Remove it if
+      // neither it nor any vertex removed before deviates too much from the
+      // straight segment replacing them.
+      const Point& start = vertices.at(count - 2).getPos();
+      const Point& end = vertex.getPos();
+      mRemovedPoints.append(vertices.at(count - 1).getPos());
+      bool removable = true;
+      foreach (const Point& p, mRemovedPoints) {
+        if (Toolbox::shortestDistanceBetweenPointAndLine(p, start, end) >
+            mReader.mArcTolerance) {
+          removable = false;
+          break;
+        }
+      }
+      if (removable) {
+        vertices.removeLast();
+      } else {
+        mRemovedPoints.clear();
+      }
+    } else {
+      mRemovedPoints.clear();
+    }
+    vertices.append(vertex);
+  }
+
+  void flushPath() {
+    if ((mPendingPath.getVertices().count() >= 2) && mSink.polygon) {
+      mSink.polygon(mPendingPath);
+    }
+    mPendingPath = Path();
+    mRemovedPoints.clear();
+  }
+
   Angle angle(double angle) const { return Angle::fromDeg(angle); }
   Angle bulgeToAngle(double bulge) const {
     // Round to 0.001° to avoid odd numbers like 179.999999°.
@@ -158,37 +295,78 @@ private:  // Methods
   }
 
 private:  // Data
-  DxfReader& mReader;
+  const DxfReader& mReader;
+  const DxfReader::Sink& mSink;
+  std::istream& mStream;
+  qint64 mFileSize;
+  qint64 mEntityCount;
+  int mProgress;
   qreal mScaleToMm;
 
   // Current polygon state
+  bool mPolylineSkipped;
   bool mPolylineClosed;
   int mPolylineVertices;
   Path mPolylinePath;
+
+  // Path not passed to the sink yet since it might be merged with the next
+  // one, and the points removed from its last straight segment.
+  Path mPendingPath;
+  QVector<Point> mRemovedPoints;
 };
 
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
 
-DxfReader::DxfReader() noexcept : mScaleFactor(1) {
+DxfReader::DxfReader() noexcept
+  : mScaleFactor(1),
+    mLayerFilter(),
+    mMergePolylines(false),
+    mArcTolerance(0) {
 }
 
 DxfReader::~DxfReader() noexcept {
 }
 
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void DxfReader::setLayerFilter(const QSet<QString>& layers) noexcept {
+  mLayerFilter.clear();
+  foreach (const QString& layer, layers) {
+    mLayerFilter.insert(layer.toLower());
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
 void DxfReader::parse(const FilePath& dxfFile) {
+  Sink sink;
+  sink.point = [this](const Point& p) { mPoints.append(p); };
+  sink.circle = [this](const Circle& c) { mCircles.append(c); };
+  sink.polygon = [this](const Path& p) { mPolygons.append(p); };
+  parse(dxfFile, sink);  // can throw
+}
+
+void DxfReader::parse(const FilePath& dxfFile, const Sink& sink) {
   try {
+    // Note: dxflib reads the file line by line, so the file is never loaded
+    // into memory completely.
+    std::ifstream stream(dxfFile.toNative().toStdString());
+    const qint64 fileSize = QFileInfo(dxfFile.toStr()).size();
     DL_Dxf dxf;
-    DxfReaderImpl helper(*this);
-    if (!dxf.in(dxfFile.toNative().toStdString(), &helper)) {
+    DxfReaderImpl helper(*this, sink, stream, fileSize);
+    if (!dxf.in(stream, &helper)) {
       throw RuntimeError(__FILE__, __LINE__,
                          tr("File does not exist or is not readable."));
     }
+    helper.finish();  // can throw
+  } catch (const Exception&) {
+    throw;  // Thrown by ourselves, e.g. by a sink callback.
   } catch (const std::exception& e) {
     // Since a third party library was used, catch std::exception and convert
     // it to our own exception type.
@@ -27,6 +27,8 @@
 
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -56,6 +58,13 @@ class FilePath;
  * Note that this class tries to read and apply the length unit defined in the
  * DXF file. However, a DXF file is not required to specify the unit. If it is
  * missing, the unit millimeters is assumed.
+ *
+ * By default, all imported objects are collected in lists (see #getPoints(),
+ * #getCircles() and #getPolygons()). For large files, #parse(const FilePath&,
+ * const Sink&) passes every object to callbacks instead, while the file is
+ * read sequentially. Together with a layer filter, merging of connected
+ * polylines and vertex reduction (see setters), this keeps the memory usage
+ * bounded by the size of the objects actually needed.
  */
 class DxfReader {
   Q_DECLARE_TR_FUNCTIONS(DxfReader)
@@ -66,6 +75,18 @@ public:
     PositiveLength diameter;
   };
 
+  /**
+   * @brief Callbacks to receive the imported objects while parsing
+   *
+   * Callbacks which are not set are simply not called.
+   */
+  struct Sink {
+    std::function<void(const Point&)> point;
+    std::function<void(const Circle&)> circle;
+    std::function<void(const Path&)> polygon;
+    std::function<void(int)> progress;  ///< Parsed percentage of the file
+  };
+
   // Constructors / Destructor
 
   /**
@@ -93,6 +114,43 @@ public:
     mScaleFactor = scaleFactor;
   }
 
+  /**
+   * @brief Only import objects of specific DXF layers
+   *
+   * @param layers  Names of the layers to import (case insensitive). If
+   *                empty (the default), objects of all layers are imported.
+   */
+  void setLayerFilter(const QSet<QString>& layers) noexcept;
+
+  /**
+   * @brief Merge connected lines, arcs and polylines while parsing
+   *
+   * If enabled, a line, arc or polyline starting or ending exactly at the
+   * end of the previous one is appended to it instead of creating a separate
+   * polygon. MCAD exports often contain outlines as a sequence of single
+   * segments, so this reduces the number of polygons a lot without needing
+   * all of them in memory (in contrast to librepcb::TangentPathJoiner, which
+   * may still be used afterwards to join the remaining paths). Default is
+   * disabled.
+   *
+   * @param merge   Whether to merge connected paths or not.
+   */
+  void setMergePolylines(bool merge) noexcept { mMergePolylines = merge; }
+
+  /**
+   * @brief Set the tolerance to simplify curves made of straight segments
+   *
+   * Curves are often exported as lots of tiny straight segments. Vertices
+   * between straight segments are removed as long as the simplified path
+   * doesn't deviate more than this tolerance from the original vertices.
+   * Default is zero, i.e. no simplification.
+   *
+   * @param tolerance   Maximum allowed deviation.
+   */
+  void setArcTolerance(const UnsignedLength& tolerance) noexcept {
+    mArcTolerance = tolerance;
+  }
+
   // Getters
 
   /**
@@ -121,17 +179,36 @@ public:
   /**
    * @brief Parse a DXF file
    *
+   * The imported objects are available with the getters afterwards.
+   *
    * @param dxfFile   File path to the DXF to import.
    *
    * @throw Exception if anything went wrong (e.g. file does not exist).
    */
   void parse(const FilePath& dxfFile);
 
+  /**
+   * @brief Parse a DXF file and pass the imported objects to callbacks
+   *
+   * The objects are not stored in this object, i.e. the getters will not
+   * return them.
+   *
+   * @param dxfFile   File path to the DXF to import.
+   * @param sink      Callbacks to be called for each imported object.
+   *
+   * @throw Exception if anything went wrong (e.g. file does not exist). Also
+   *        exceptions thrown by the callbacks are forwarded.
+   */
+  void parse(const FilePath& dxfFile, const Sink& sink);
+
   // Operator Overloadings
   DxfReader& operator=(const DxfReader& rhs) = delete;
 
 private:
   qreal mScaleFactor;
+  QSet<QString> mLayerFilter;  ///< Lowercase layer names, empty = all
+  bool mMergePolylines;
+  UnsignedLength mArcTolerance;
 
   QList<Point> mPoints;
   QList<Circle> mCircles;
@@ -0,0 +1,204 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "librarymanifest.h"
+
+#include "../exceptions.h"
+#include "../fileio/fileutils.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+LibraryManifest::LibraryManifest() noexcept : mHashes(), mUrls() {
+}
+
+LibraryManifest::LibraryManifest(const LibraryManifest& other) noexcept
+  : mHashes(other.mHashes), mUrls(other.mUrls) {
+}
+
+LibraryManifest::~LibraryManifest() noexcept {
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void LibraryManifest::setHash(const QString& element,
+                              const QByteArray& hash) noexcept {
+  mHashes.insert(element, hash);
+}
+
+void LibraryManifest::setUrl(const QString& element, const QUrl& url) noexcept {
+  mUrls.insert(element, url);
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QStringList LibraryManifest::getModifiedElements(
+    const LibraryManifest& installed) const noexcept {
+  QStringList elements;
+  for (auto it = mHashes.begin(); it != mHashes.end(); ++it) {
+    if (installed.mHashes.value(it.key()) != it.value()) {
+      elements.append(it.key());
+    }
+  }
+  return elements;
+}
+
+QStringList LibraryManifest::getRemovedElements(
+    const LibraryManifest& installed) const noexcept {
+  QStringList elements;
+  foreach (const QString& element, installed.mHashes.keys()) {
+    if (!mHashes.contains(element)) {
+      elements.append(element);
+    }
+  }
+  return elements;
+}
+
+QByteArray LibraryManifest::toJson() const noexcept {
+  QJsonObject elements;
+  for (auto it = mHashes.begin(); it != mHashes.end(); ++it) {
+    QJsonObject element;
+    element.insert("sha256", QString(it.value().toHex()));
+    element.insert("url", mUrls.value(it.key()).toString());
+    elements.insert(it.key(), element);
+  }
+  QJsonObject root;
+  root.insert("elements", elements);
+  return QJsonDocument(root).toJson();
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+LibraryManifest& LibraryManifest::operator=(
+    const LibraryManifest& rhs) noexcept {
+  mHashes = rhs.mHashes;
+  mUrls = rhs.mUrls;
+  return *this;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+LibraryManifest LibraryManifest::fromJson(const QByteArray& json,
+                                          const QUrl& baseUrl) {
+  const QJsonDocument doc = QJsonDocument::fromJson(json);
+  const QJsonValue elements = doc.object().value("elements");
+  if ((!doc.isObject()) || (!elements.isObject())) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       tr("The library manifest is not valid."));
+  }
+
+  LibraryManifest manifest;
+  const QJsonObject obj = elements.toObject();
+  for (auto it = obj.begin(); it != obj.end(); ++it) {
+    const QJsonObject element = it.value().toObject();
+    const QByteArray hash =
+        QByteArray::fromHex(element.value("sha256").toString().toUtf8());
+    const QUrl url = baseUrl.resolved(QUrl(element.value("url").toString()));
+    if ((!isValidElement(it.key())) || (hash.size() != 32) ||
+        (!url.isValid())) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("Invalid element in library manifest: %1").arg(it.key()));
+    }
+    manifest.setHash(it.key(), hash);
+    manifest.setUrl(it.key(), url);
+  }
+  return manifest;
+}
+
+bool LibraryManifest::isValidElement(const QString& element) noexcept {
+  if (element == ".") {
+    return true;
+  }
+  const QStringList segments = element.split('/');
+  if (segments.count() != 2) {
+    return false;  // Also rejects absolute paths like "/foo".
+  }
+  foreach (const QString& segment, segments) {
+    if (segment.isEmpty() || (segment == ".") || segment.contains("..") ||
+        segment.contains('\\') || segment.contains(':')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+LibraryManifest LibraryManifest::fromDirectory(const FilePath& libDir) {
+  LibraryManifest manifest;
+  manifest.setHash(".", calcElementHash(libDir, false));  // can throw
+  const QDir::Filters filter = QDir::Dirs | QDir::NoDotAndDotDot;
+  foreach (const QString& typeDir, QDir(libDir.toStr()).entryList(filter)) {
+    const FilePath typeFp = libDir.getPathTo(typeDir);
+    const QStringList elementDirs = QDir(typeFp.toStr()).entryList(filter);
+    foreach (const QString& elementDir, elementDirs) {
+      manifest.setHash(
+          typeDir % "/" % elementDir,
+          calcElementHash(typeFp.getPathTo(elementDir), true));  // can throw
+    }
+  }
+  return manifest;
+}
+
+QByteArray LibraryManifest::calcElementHash(const FilePath& dir,
+                                            bool recursive) {
+  QStringList files;
+  foreach (const FilePath& fp,
+           FileUtils::getFilesInDirectory(dir, {}, recursive)) {  // can throw
+    const QString relativePath = fp.toRelative(dir);
+    if (relativePath != ".lock") {
+      files.append(relativePath);
+    }
+  }
+  files.sort();
+
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+  foreach (const QString& relativePath, files) {
+    const QByteArray content =
+        FileUtils::readFile(dir.getPathTo(relativePath));  // can throw
+    hash.addData(relativePath.toUtf8());
+    hash.addData("\n", 1);
+    hash.addData(QCryptographicHash::hash(content, QCryptographicHash::Sha256));
+  }
+  return hash.result();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
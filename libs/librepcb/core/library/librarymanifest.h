@@ -0,0 +1,182 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_LIBRARYMANIFEST_H
+#define LIBREPCB_CORE_LIBRARYMANIFEST_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../fileio/filepath.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class LibraryManifest
+ ******************************************************************************/
+
+/**
+ * @brief Content hashes of all elements of a library, used for delta updates
+ *
+ * For this purpose, a library is split into elements: Every directory two
+ * levels below the library root (e.g. `sym/<uuid>`) is an element, and the
+ * files located directly in the library root (e.g. `library.lp`) form the
+ * special element `.`. The hash of an element is the SHA-256 over the
+ * relative paths and the SHA-256 checksums of all its files, sorted by path.
+ * Thus it can be calculated for an installed library as well, and comparing
+ * it with the manifest of the latest library release tells which elements
+ * need to be downloaded.
+ *
+ * The manifest provided by a server is a JSON file like the one below. The
+ * element URLs are relative to the manifest URL and point to ZIP files
+ * containing the files of the corresponding element directory:
+ *
+ * @code{.json}
+ * {
+ *   "elements": {
+ *     ".": {"sha256": "5891b5b5...", "url": "library.zip"},
+ *     "sym/7d9ef5cf-...": {"sha256": "9f86d081...", "url": "sym/7d9ef5cf.zip"}
+ *   }
+ * }
+ * @endcode
+ */
+class LibraryManifest final {
+  Q_DECLARE_TR_FUNCTIONS(LibraryManifest)
+
+public:
+  // Constructors / Destructor
+  LibraryManifest() noexcept;
+  LibraryManifest(const LibraryManifest& other) noexcept;
+  ~LibraryManifest() noexcept;
+
+  // Getters
+  const QMap<QString, QByteArray>& getHashes() const noexcept {
+    return mHashes;
+  }
+  QUrl getUrl(const QString& element) const noexcept {
+    return mUrls.value(element);
+  }
+
+  // Setters
+  void setHash(const QString& element, const QByteArray& hash) noexcept;
+  void setUrl(const QString& element, const QUrl& url) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Get all elements which need to be downloaded to update a library
+   *
+   * @param installed   Manifest of the installed library.
+   *
+   * @return Elements which are new or have a different hash than in
+   *         the installed library.
+   */
+  QStringList getModifiedElements(
+      const LibraryManifest& installed) const noexcept;
+
+  /**
+   * @brief Get all elements which need to be removed to update a library
+   *
+   * @param installed   Manifest of the installed library.
+   *
+   * @return Elements of the installed library which don't exist anymore.
+   */
+  QStringList getRemovedElements(
+      const LibraryManifest& installed) const noexcept;
+
+  /**
+   * @brief Serialize the manifest into the JSON format
+   *
+   * @return JSON file content
+   */
+  QByteArray toJson() const noexcept;
+
+  // Operator Overloadings
+  LibraryManifest& operator=(const LibraryManifest& rhs) noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Load a manifest from its JSON file content
+   *
+   * @param json      JSON file content.
+   * @param baseUrl   URL of the JSON file, used to resolve relative URLs.
+   *
+   * @return The loaded manifest
+   *
+   * @throw Exception if the JSON content is invalid, e.g. if it contains an
+   *        invalid element path (see #isValidElement()).
+   */
+  static LibraryManifest fromJson(const QByteArray& json, const QUrl& baseUrl);
+
+  /**
+   * @brief Check if an element path is valid
+   *
+   * Since element paths from a manifest are used as file paths, only `.` and
+   * paths of the form `<typedir>/<elementdir>` are valid. Anything which
+   * could point outside of the library directory (e.g. `..`, backslashes or
+   * absolute paths) is rejected.
+   *
+   * @param element   The element path to check.
+   *
+   * @return Whether the element path is valid or not
+   */
+  static bool isValidElement(const QString& element) noexcept;
+
+  /**
+   * @brief Calculate the manifest of a library directory
+   *
+   * @param libDir    Root directory of the library.
+   *
+   * @return Manifest containing the hashes (but no URLs) of all elements
+   *
+   * @throw Exception if a file could not be read.
+   */
+  static LibraryManifest fromDirectory(const FilePath& libDir);
+
+  /**
+   * @brief Calculate the hash of a single element
+   *
+   * @param dir       Directory of the element.
+   * @param recursive Whether to consider files in subdirectories too (false
+   *                  only for the special element `.`).
+   *
+   * @return SHA-256 hash of the element
+   *
+   * @throw Exception if a file could not be read.
+   */
+  static QByteArray calcElementHash(const FilePath& dir, bool recursive);
+
+private:  // Data
+  QMap<QString, QByteArray> mHashes;  ///< Key: Element path, Value: SHA-256
+  QHash<QString, QUrl> mUrls;  ///< Key: Element path, Value: ZIP file URL
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
@@ -23,6 +23,7 @@
 #include "filedownload.h"
 
 #include "../exceptions.h"
+#include "../fileio/zipstreamextractor.h"
 #include "../utils/scopeguard.h"
 
 #include <quazip/JlCompress.h>
@@ -43,10 +44,17 @@ FileDownload::FileDownload(const QUrl& url, const FilePath& dest) noexcept
     mDestination(dest),
     mHashAlgorithm(QCryptographicHash::Md5),
     mExpectedChecksum(),
-    mExtractZipToDir() {
+    mExtractZipToDir(),
+    mHash(),
+    mZipExtractor(),
+    mZipExtractorError() {
 }
 
 FileDownload::~FileDownload() noexcept {
+  // revert a streaming extraction which did not complete successfully
+  if (mZipExtractor) {
+    mZipExtractor->removeExtractedFiles();
+  }
 }
 
 /*******************************************************************************
@@ -93,6 +101,20 @@ void FileDownload::prepareRequest() {
                        QString("Could not open file \"%1\": %2")
                            .arg(mDestination.toNative(), mFile->errorString()));
   }
+
+  // prepare checksum calculation and ZIP extraction, both are done on the fly
+  // (on redirects this method is called again, so start from scratch)
+  if (!mExpectedChecksum.isEmpty()) {
+    mHash.reset(new QCryptographicHash(mHashAlgorithm));
+  }
+  if (mZipExtractor) {
+    mZipExtractor->removeExtractedFiles();
+  }
+  mZipExtractor.reset();
+  mZipExtractorError = QString();
+  if (mExtractZipToDir.isValid()) {
+    mZipExtractor.reset(new ZipStreamExtractor(mExtractZipToDir));
+  }
 }
 
 void FileDownload::finalizeRequest() {
@@ -113,18 +135,10 @@ void FileDownload::finalizeRequest() {
   // if an error occurs below this line, remove the downloaded file
   auto sg = scopeGuard([this]() { QFile::remove(mDestination.toStr()); });
 
-  // verify checksum of downloaded file
+  // verify checksum of downloaded file (calculated while receiving the data)
   if (!mExpectedChecksum.isEmpty()) {
     emit progressState(tr("Verify checksum..."));
-    QFile file(mDestination.toStr());
-    if (!file.open(QFile::ReadOnly)) {
-      throw RuntimeError(__FILE__, __LINE__,
-                         tr("Error while readback file \"%1\": %2")
-                             .arg(mDestination.toNative(), file.errorString()));
-    }
-    QCryptographicHash hash(mHashAlgorithm);
-    hash.addData(&file);
-    QString result = hash.result().toHex();
+    QString result = mHash->result().toHex();
     QString expected = mExpectedChecksum.toHex();
     if (result != expected) {
       qDebug().nospace() << "Expected checksum " << expected << " but got "
@@ -138,8 +152,20 @@ void FileDownload::finalizeRequest() {
   }
 
   // extract zip file if necessary
-  if (mExtractZipToDir.isValid()) {
+  if (mZipExtractor && mZipExtractor->isSupported()) {
+    // files are already extracted, just wait until they are written
+    emit progressState(tr("Extract files..."));
+    if (!mZipExtractorError.isNull()) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Error while extracting the ZIP file \"%1\": %2")
+                             .arg(mDestination.toNative(), mZipExtractorError));
+    }
+    mZipExtractor->finish();  // can throw
+    mZipExtractor.reset();  // keep extracted files
+  } else if (mExtractZipToDir.isValid()) {
+    // streaming extraction not possible, extract the downloaded file
     emit progressState(tr("Extract files..."));
+    mZipExtractor.reset();
     QStringList files =
         JlCompress::extractDir(mDestination.toStr(), mExtractZipToDir.toStr());
     if (files.isEmpty()) {
@@ -161,7 +187,19 @@ void FileDownload::emitSuccessfullyFinishedSignals() noexcept {
 }
 
 void FileDownload::fetchNewData() noexcept {
-  mFile->write(mReply->readAll());
+  const QByteArray data = mReply->readAll();
+  mFile->write(data);
+  if (mHash) {
+    mHash->addData(data);
+  }
+  if (mZipExtractor && mZipExtractorError.isNull()) {
+    try {
+      mZipExtractor->addData(data);  // can throw
+    } catch (const Exception& e) {
+      // will be reported when the download is finished
+      mZipExtractorError = e.getMsg();
+    }
+  }
 }
 
 /*******************************************************************************
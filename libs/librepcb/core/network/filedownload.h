@@ -33,6 +33,8 @@
  ******************************************************************************/
 namespace librepcb {
 
+class ZipStreamExtractor;
+
 /*******************************************************************************
  *  Class FileDownload
  ******************************************************************************/
@@ -68,7 +70,8 @@ public:
    *
    * If set, the checksum of the downloaded file will be compared with this
    * checksum. If they differ, the file gets removed and an error will be
-   * reported.
+   * reported. The checksum is calculated while receiving the data, so no
+   * additional pass over the downloaded file is needed.
    *
    * @param algorithm     The checksum algorithm to be used
    * @param checksum      The expected checksum of the file to download
@@ -80,7 +83,10 @@ public:
    * @brief Set extraction directory of the ZIP file to download
    *
    * If set (and valid), the downloaded file (must be a ZIP!) will be extracted
-   * into this directory after downloading it.
+   * into this directory. The entries are extracted while the download is
+   * still in progress (see librepcb::ZipStreamExtractor), only ZIP files not
+   * supporting this are extracted after downloading them. If the download
+   * fails, all extracted files are removed again.
    *
    * @note The downloaded ZIP file will be removed after extracting it.
    *
@@ -125,6 +131,9 @@ private:  // Data
   QCryptographicHash::Algorithm mHashAlgorithm;
   QByteArray mExpectedChecksum;
   FilePath mExtractZipToDir;
+  QScopedPointer<QCryptographicHash> mHash;
+  QScopedPointer<ZipStreamExtractor> mZipExtractor;
+  QString mZipExtractorError;
 };
 
 /*******************************************************************************
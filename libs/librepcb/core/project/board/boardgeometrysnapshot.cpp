@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "boardgeometrysnapshot.h"
+
+#include "../../geometry/hole.h"
+#include "../../library/pkg/footprint.h"
+#include "../../library/pkg/footprintpad.h"
+#include "../../utils/tracer.h"
+#include "../circuit/netsignal.h"
+#include "board.h"
+#include "items/bi_device.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_hole.h"
+#include "items/bi_netline.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netsegment.h"
+#include "items/bi_via.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+BoardGeometrySnapshot::BoardGeometrySnapshot(const Board& board) noexcept {
+  LIBREPCB_TRACE_SCOPE("BoardGeometrySnapshot::BoardGeometrySnapshot");
+
+  QHash<const NetSignal*, int> netSignalIndices;
+  auto netSignalIndex = [this, &netSignalIndices](
+                            const NetSignal* netSignal) -> int {
+    if (!netSignal) {
+      return -1;
+    }
+    auto it = netSignalIndices.find(netSignal);
+    if (it == netSignalIndices.end()) {
+      it = netSignalIndices.insert(netSignal, mNetSignals.uuid.count());
+      mNetSignals.uuid.append(netSignal->getUuid());
+      mNetSignals.name.append(*netSignal->getName());
+    }
+    return it.value();
+  };
+
+  // Devices.
+  foreach (const BI_Device* device, board.getDeviceInstances()) {
+    const Transform transform(*device);
+    foreach (const BI_FootprintPad* pad, device->getPads()) {
+      const int netSignal = netSignalIndex(pad->getCompSigInstNetSignal());
+      const Transform padTransform(*pad);
+      const auto& geometries = pad->getGeometries();
+      for (auto it = geometries.begin(); it != geometries.end(); ++it) {
+        if (!it.value().isEmpty()) {
+          Pads& pads = mPads[it.key()];
+          pads.transform.append(padTransform);
+          pads.clearance.append(pad->getLibPad().getCopperClearance()->toNm());
+          pads.geometries.append(it.value());
+          pads.netSignal.append(netSignal);
+          pads.items.append(pad);
+        }
+      }
+    }
+    for (const Hole& hole : device->getLibFootprint().getHoles()) {
+      mNpthHoles.path.append(*transform.map(hole.getPath()));
+      mNpthHoles.diameter.append(hole.getDiameter()->toNm());
+      mNpthHoles.uuid.append(hole.getUuid());
+      mNpthHoles.items.append(device);
+    }
+  }
+
+  // Board holes.
+  foreach (const BI_Hole* hole, board.getHoles()) {
+    mNpthHoles.path.append(*hole->getData().getPath());
+    mNpthHoles.diameter.append(hole->getData().getDiameter()->toNm());
+    mNpthHoles.uuid.append(hole->getData().getUuid());
+    mNpthHoles.items.append(hole);
+  }
+
+  // Net segments.
+  foreach (const BI_NetSegment* segment, board.getNetSegments()) {
+    const int segmentIndex = mSegments.count();
+    const int netSignal = netSignalIndex(segment->getNetSignal());
+    mSegments.netSignal.append(netSignal);
+    mSegments.items.append(segment);
+    for (const BI_Via* via : segment->getVias()) {
+      const tl::optional<PositiveLength>& stopMaskTop =
+          via->getStopMaskDiameterTop();
+      const tl::optional<PositiveLength>& stopMaskBottom =
+          via->getStopMaskDiameterBottom();
+      mVias.x.append(via->getPosition().getX().toNm());
+      mVias.y.append(via->getPosition().getY().toNm());
+      mVias.size.append(via->getSize()->toNm());
+      mVias.drill.append(via->getDrillDiameter()->toNm());
+      mVias.stopMaskTop.append(stopMaskTop ? (*stopMaskTop)->toNm() : 0);
+      mVias.stopMaskBottom.append(stopMaskBottom ? (*stopMaskBottom)->toNm()
+                                                 : 0);
+      mVias.startLayer.append(&via->getVia().getStartLayer());
+      mVias.endLayer.append(&via->getVia().getEndLayer());
+      mVias.netSignal.append(netSignal);
+      mVias.segment.append(segmentIndex);
+      mVias.items.append(via);
+    }
+    for (const BI_NetLine* netline : segment->getNetLines()) {
+      const Point& startPos = netline->getStartPoint().getPosition();
+      const Point& endPos = netline->getEndPoint().getPosition();
+      Traces& traces = mTraces[&netline->getLayer()];
+      traces.startX.append(startPos.getX().toNm());
+      traces.startY.append(startPos.getY().toNm());
+      traces.endX.append(endPos.getX().toNm());
+      traces.endY.append(endPos.getY().toNm());
+      traces.width.append(netline->getWidth()->toNm());
+      traces.netSignal.append(netSignal);
+      traces.segment.append(segmentIndex);
+      traces.items.append(netline);
+    }
+  }
+}
+
+BoardGeometrySnapshot::~BoardGeometrySnapshot() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+tl::optional<Uuid> BoardGeometrySnapshot::getNetSignalUuid(
+    int index) const noexcept {
+  if ((index >= 0) && (index < mNetSignals.uuid.count())) {
+    return mNetSignals.uuid.at(index);
+  } else {
+    return tl::nullopt;
+  }
+}
+
+int BoardGeometrySnapshot::indexOfNetSignal(
+    const tl::optional<Uuid>& uuid) const noexcept {
+  return uuid ? mNetSignals.uuid.indexOf(*uuid) : -1;
+}
+
+const BoardGeometrySnapshot::Traces& BoardGeometrySnapshot::getTraces(
+    const Layer& layer) const noexcept {
+  static const Traces empty{};
+  auto it = mTraces.find(&layer);
+  return (it != mTraces.end()) ? it.value() : empty;
+}
+
+const BoardGeometrySnapshot::Pads& BoardGeometrySnapshot::getPads(
+    const Layer& layer) const noexcept {
+  static const Pads empty{};
+  auto it = mPads.find(&layer);
+  return (it != mPads.end()) ? it.value() : empty;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_BOARDGEOMETRYSNAPSHOT_H
+#define LIBREPCB_CORE_BOARDGEOMETRYSNAPSHOT_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../geometry/padgeometry.h"
+#include "../../geometry/path.h"
+#include "../../types/length.h"
+#include "../../types/point.h"
+#include "../../types/uuid.h"
+#include "../../utils/transform.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class BI_Base;
+class BI_FootprintPad;
+class BI_NetLine;
+class BI_NetSegment;
+class BI_Via;
+class Board;
+class Layer;
+
+/*******************************************************************************
+ *  Class BoardGeometrySnapshot
+ ******************************************************************************/
+
+/**
+ * @brief Flat snapshot of the copper and drill geometry of a board
+ *
+ * Traces, vias, pads and non-plated holes of a ::librepcb::Board are copied
+ * into contiguous arrays (structure of arrays, traces and pads grouped by
+ * layer), so algorithms iterating over all of them (DRC, plane builder,
+ * Gerber export) do not need to walk through the board's item maps and
+ * the snapshot can safely be processed in a worker thread.
+ *
+ * All coordinates are in board coordinates (i.e. already transformed) and
+ * all lengths are in nanometers. Within each array, objects are stored in
+ * the same order as the board iterates them, thus exports remain
+ * deterministic.
+ *
+ * @warning The `items` arrays point to the original board items, only for
+ *          referencing them (e.g. in DRC messages). They must only be
+ *          dereferenced in the main thread and as long as the board was not
+ *          modified.
+ */
+class BoardGeometrySnapshot final {
+public:
+  // Types
+  struct NetSignals {
+    QVector<Uuid> uuid;
+    QVector<QString> name;
+  };
+
+  struct Segments {
+    QVector<int> netSignal;  ///< Index in #getNetSignals(), or -1
+    QVector<const BI_NetSegment*> items;
+
+    int count() const noexcept { return items.count(); }
+  };
+
+  struct Traces {
+    QVector<LengthBase_t> startX;
+    QVector<LengthBase_t> startY;
+    QVector<LengthBase_t> endX;
+    QVector<LengthBase_t> endY;
+    QVector<LengthBase_t> width;
+    QVector<int> netSignal;  ///< Index in #getNetSignals(), or -1
+    QVector<int> segment;  ///< Index in #getSegments()
+    QVector<const BI_NetLine*> items;
+
+    int count() const noexcept { return items.count(); }
+    Point getStartPos(int i) const noexcept {
+      return Point(Length(startX.at(i)), Length(startY.at(i)));
+    }
+    Point getEndPos(int i) const noexcept {
+      return Point(Length(endX.at(i)), Length(endY.at(i)));
+    }
+  };
+
+  struct Vias {
+    QVector<LengthBase_t> x;
+    QVector<LengthBase_t> y;
+    QVector<LengthBase_t> size;
+    QVector<LengthBase_t> drill;
+    QVector<LengthBase_t> stopMaskTop;  ///< 0 if there is no stop mask
+    QVector<LengthBase_t> stopMaskBottom;  ///< 0 if there is no stop mask
+    QVector<const Layer*> startLayer;
+    QVector<const Layer*> endLayer;
+    QVector<int> netSignal;  ///< Index in #getNetSignals(), or -1
+    QVector<int> segment;  ///< Index in #getSegments()
+    QVector<const BI_Via*> items;
+
+    int count() const noexcept { return items.count(); }
+    Point getPosition(int i) const noexcept {
+      return Point(Length(x.at(i)), Length(y.at(i)));
+    }
+  };
+
+  struct Pads {
+    QVector<Transform> transform;
+    QVector<LengthBase_t> clearance;
+    QVector<QList<PadGeometry>> geometries;  ///< In pad coordinates
+    QVector<int> netSignal;  ///< Index in #getNetSignals(), or -1
+    QVector<const BI_FootprintPad*> items;
+
+    int count() const noexcept { return items.count(); }
+  };
+
+  struct Holes {
+    QVector<Path> path;
+    QVector<LengthBase_t> diameter;
+    QVector<Uuid> uuid;
+    QVector<const BI_Base*> items;  ///< Either a BI_Device or a BI_Hole
+
+    int count() const noexcept { return items.count(); }
+  };
+
+  // Constructors / Destructor
+  BoardGeometrySnapshot() = delete;
+  BoardGeometrySnapshot(const BoardGeometrySnapshot& other) = delete;
+  explicit BoardGeometrySnapshot(const Board& board) noexcept;
+  ~BoardGeometrySnapshot() noexcept;
+
+  // Getters
+  const NetSignals& getNetSignals() const noexcept { return mNetSignals; }
+  tl::optional<Uuid> getNetSignalUuid(int index) const noexcept;
+  int indexOfNetSignal(const tl::optional<Uuid>& uuid) const noexcept;
+  const Segments& getSegments() const noexcept { return mSegments; }
+  const Traces& getTraces(const Layer& layer) const noexcept;
+  const Vias& getVias() const noexcept { return mVias; }
+  const Pads& getPads(const Layer& layer) const noexcept;
+  const Holes& getNpthHoles() const noexcept { return mNpthHoles; }
+
+  // Operator Overloadings
+  BoardGeometrySnapshot& operator=(const BoardGeometrySnapshot& rhs) = delete;
+
+private:  // Data
+  NetSignals mNetSignals;
+  Segments mSegments;
+  QHash<const Layer*, Traces> mTraces;
+  Vias mVias;
+  QHash<const Layer*, Pads> mPads;
+  Holes mNpthHoles;  ///< Footprint holes first, then board holes
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
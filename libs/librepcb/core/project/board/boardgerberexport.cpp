@@ -32,6 +32,8 @@
 #include "../../library/pkg/footprintpad.h"
 #include "../../library/pkg/package.h"
 #include "../../library/pkg/packagepad.h"
+#include "../../utils/scopeguard.h"
+#include "../../utils/tracer.h"
 #include "../../utils/transform.h"
 #include "../circuit/componentinstance.h"
 #include "../circuit/componentsignalinstance.h"
@@ -40,6 +42,7 @@
 #include "../projectattributelookup.h"
 #include "board.h"
 #include "boardfabricationoutputsettings.h"
+#include "boardgeometrysnapshot.h"
 #include "items/bi_device.h"
 #include "items/bi_footprintpad.h"
 #include "items/bi_hole.h"
@@ -117,7 +120,10 @@ void BoardGerberExport::setBeforeWriteCallback(BeforeWriteCallback cb) {
 
 void BoardGerberExport::exportPcbLayers(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportPcbLayers");
   mWrittenFiles.clear();
+  mGeometry = std::make_shared<BoardGeometrySnapshot>(mBoard);
+  auto sg = scopeGuard([this]() { mGeometry.reset(); });
 
   exportDrillsMerged(settings);
   exportDrillsNpth(settings);
@@ -138,6 +144,7 @@ void BoardGerberExport::exportPcbLayers(
 void BoardGerberExport::exportComponentLayer(BoardSide side,
                                              const Uuid& assemblyVariant,
                                              const FilePath& filePath) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportComponentLayer");
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
                       *mProject.getVersion());
   if (side == BoardSide::Top) {
@@ -299,6 +306,7 @@ void BoardGerberExport::exportComponentLayer(BoardSide side,
 
 void BoardGerberExport::exportDrillsMerged(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportDrillsMerged");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrills());
   if (settings.getMergeDrillFiles()) {
@@ -318,6 +326,7 @@ void BoardGerberExport::exportDrillsMerged(
 
 void BoardGerberExport::exportDrillsNpth(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportDrillsNpth");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrillsNpth());
   if (!settings.getMergeDrillFiles()) {
@@ -344,6 +353,7 @@ void BoardGerberExport::exportDrillsNpth(
 
 void BoardGerberExport::exportDrillsPth(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportDrillsPth");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixDrillsPth());
   if (!settings.getMergeDrillFiles()) {
@@ -362,6 +372,7 @@ void BoardGerberExport::exportDrillsPth(
 
 void BoardGerberExport::exportDrillsBlindBuried(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportDrillsBlindBuried");
   auto vias = getBlindBuriedVias();
   for (auto it = vias.begin(); it != vias.end(); it++) {
     mCurrentStartLayer = it.key().first;
@@ -383,6 +394,7 @@ void BoardGerberExport::exportDrillsBlindBuried(
 
 void BoardGerberExport::exportLayerBoardOutlines(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerBoardOutlines");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixOutlines());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -397,6 +409,7 @@ void BoardGerberExport::exportLayerBoardOutlines(
 
 void BoardGerberExport::exportLayerTopCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerTopCopper");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixCopperTop());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -411,6 +424,7 @@ void BoardGerberExport::exportLayerTopCopper(
 
 void BoardGerberExport::exportLayerBottomCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerBottomCopper");
   FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                   settings.getSuffixCopperBot());
   GerberGenerator gen(mCreationDateTime, mProjectName, mBoard.getUuid(),
@@ -426,6 +440,7 @@ void BoardGerberExport::exportLayerBottomCopper(
 
 void BoardGerberExport::exportLayerInnerCopper(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerInnerCopper");
   for (int i = 1; i <= mBoard.getInnerLayerCount(); ++i) {
     mCurrentInnerCopperLayer = i;  // used for attribute provider
     FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
@@ -448,6 +463,7 @@ void BoardGerberExport::exportLayerInnerCopper(
 
 void BoardGerberExport::exportLayerTopSolderMask(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerTopSolderMask");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderMaskTop());
   if (mBoard.getSolderResist()) {
@@ -467,6 +483,7 @@ void BoardGerberExport::exportLayerTopSolderMask(
 
 void BoardGerberExport::exportLayerBottomSolderMask(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerBottomSolderMask");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderMaskBot());
   if (mBoard.getSolderResist()) {
@@ -486,6 +503,7 @@ void BoardGerberExport::exportLayerBottomSolderMask(
 
 void BoardGerberExport::exportLayerTopSilkscreen(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerTopSilkscreen");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSilkscreenTop());
   const QVector<const Layer*>& layers = mBoard.getSilkscreenLayersTop();
@@ -510,6 +528,7 @@ void BoardGerberExport::exportLayerTopSilkscreen(
 
 void BoardGerberExport::exportLayerBottomSilkscreen(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerBottomSilkscreen");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSilkscreenBot());
   const QVector<const Layer*>& layers = mBoard.getSilkscreenLayersBot();
@@ -534,6 +553,7 @@ void BoardGerberExport::exportLayerBottomSilkscreen(
 
 void BoardGerberExport::exportLayerTopSolderPaste(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerTopSolderPaste");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderPasteTop());
   if (settings.getEnableSolderPasteTop()) {
@@ -553,6 +573,7 @@ void BoardGerberExport::exportLayerTopSolderPaste(
 
 void BoardGerberExport::exportLayerBottomSolderPaste(
     const BoardFabricationOutputSettings& settings) const {
+  LIBREPCB_TRACE_SCOPE("BoardGerberExport::exportLayerBottomSolderPaste");
   const FilePath fp = getOutputFilePath(settings.getOutputBasePath() %
                                         settings.getSuffixSolderPasteBot());
   if (settings.getEnableSolderPasteBot()) {
@@ -571,26 +592,14 @@ void BoardGerberExport::exportLayerBottomSolderPaste(
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
-  int count = 0;
-
-  // footprint holes
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    const Transform transform(*device);
-    for (const Hole& hole : device->getLibFootprint().getHoles()) {
-      gen.drill(transform.map(hole.getPath()), hole.getDiameter(), false,
-                ExcellonGenerator::Function::MechanicalDrill);
-      ++count;
-    }
-  }
-
-  // board holes
-  foreach (const BI_Hole* hole, mBoard.getHoles()) {
-    gen.drill(hole->getData().getPath(), hole->getData().getDiameter(), false,
+  // footprint holes & board holes
+  const BoardGeometrySnapshot::Holes& holes = getGeometry().getNpthHoles();
+  for (int i = 0; i < holes.count(); ++i) {
+    gen.drill(NonEmptyPath(holes.path.at(i)),
+              PositiveLength(holes.diameter.at(i)), false,
               ExcellonGenerator::Function::MechanicalDrill);
-    ++count;
   }
-
-  return count;
+  return holes.count();
 }
 
 int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
@@ -614,13 +623,13 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
   }
 
   // vias
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      if (via->getVia().isThrough()) {
-        gen.drill(via->getPosition(), via->getDrillDiameter(), true,
-                  ExcellonGenerator::Function::ViaDrill);
-        ++count;
-      }
+  const BoardGeometrySnapshot::Vias& vias = getGeometry().getVias();
+  for (int i = 0; i < vias.count(); ++i) {
+    if ((vias.startLayer.at(i) == &Layer::topCopper()) &&
+        (vias.endLayer.at(i) == &Layer::botCopper())) {
+      gen.drill(vias.getPosition(i), PositiveLength(vias.drill.at(i)), true,
+                ExcellonGenerator::Function::ViaDrill);
+      ++count;
     }
   }
 
@@ -651,24 +660,26 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
   }
 
   // draw vias and traces (grouped by net)
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    Q_ASSERT(netsegment);
-    QString net = netsegment->getNetSignal()
-        ? *netsegment->getNetSignal()->getName()  // Named net.
+  const BoardGeometrySnapshot& geometry = getGeometry();
+  const BoardGeometrySnapshot::Segments& segments = geometry.getSegments();
+  const BoardGeometrySnapshot::Vias& vias = geometry.getVias();
+  const BoardGeometrySnapshot::Traces& traces = geometry.getTraces(layer);
+  int via = 0;
+  int trace = 0;
+  for (int segment = 0; segment < segments.count(); ++segment) {
+    const int netSignal = segments.netSignal.at(segment);
+    QString net = (netSignal >= 0)
+        ? geometry.getNetSignals().name.at(netSignal)  // Named net.
         : "N/C";  // Anonymous net (reserved name by Gerber specs).
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      Q_ASSERT(via);
-      drawVia(gen, *via, layer, net);
+    for (; (via < vias.count()) && (vias.segment.at(via) == segment); ++via) {
+      drawVia(gen, via, layer, net);
     }
-    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      Q_ASSERT(netline);
-      if (netline->getLayer() == layer) {
-        gen.drawLine(netline->getStartPoint().getPosition(),
-                     netline->getEndPoint().getPosition(),
-                     positiveToUnsigned(netline->getWidth()),
-                     GerberAttribute::ApertureFunction::Conductor, net,
-                     QString());
-      }
+    for (; (trace < traces.count()) && (traces.segment.at(trace) == segment);
+         ++trace) {
+      gen.drawLine(traces.getStartPos(trace), traces.getEndPos(trace),
+                   UnsignedLength(traces.width.at(trace)),
+                   GerberAttribute::ApertureFunction::Conductor, net,
+                   QString());
     }
   }
 
@@ -746,15 +757,18 @@ void BoardGerberExport::drawLayer(GerberGenerator& gen,
   }
 }
 
-void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
+void BoardGerberExport::drawVia(GerberGenerator& gen, int index,
                                 const Layer& layer,
                                 const QString& netName) const {
-  const bool drawCopper = via.getVia().isOnLayer(layer);
-  const tl::optional<PositiveLength> stopMaskDiameter = layer.isStopMask()
-      ? (layer.isTop() ? via.getStopMaskDiameterTop()
-                       : via.getStopMaskDiameterBottom())
-      : tl::nullopt;
-  if (drawCopper || stopMaskDiameter) {
+  const BoardGeometrySnapshot::Vias& vias = getGeometry().getVias();
+  const bool drawCopper = layer.isCopper() &&
+      Via::isOnLayer(layer, *vias.startLayer.at(index),
+                     *vias.endLayer.at(index));
+  const LengthBase_t stopMaskDiameter = layer.isStopMask()
+      ? (layer.isTop() ? vias.stopMaskTop.at(index)
+                       : vias.stopMaskBottom.at(index))
+      : 0;
+  if (drawCopper || (stopMaskDiameter > 0)) {
     // Via attributes (only on copper layers).
     GerberGenerator::Function function = tl::nullopt;
     tl::optional<QString> net = tl::nullopt;
@@ -763,11 +777,19 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
       net = netName;
     }
 
-    const PositiveLength diameter =
-        stopMaskDiameter ? (*stopMaskDiameter) : via.getSize();
-    gen.flashCircle(via.getPosition(), diameter, function, net, QString(),
-                    QString(), QString());
+    const PositiveLength diameter((stopMaskDiameter > 0)
+                                      ? stopMaskDiameter
+                                      : vias.size.at(index));
+    gen.flashCircle(vias.getPosition(index), diameter, function, net,
+                    QString(), QString(), QString());
+  }
+}
+
+const BoardGeometrySnapshot& BoardGerberExport::getGeometry() const noexcept {
+  if (!mGeometry) {
+    mGeometry = std::make_shared<BoardGeometrySnapshot>(mBoard);
   }
+  return *mGeometry;
 }
 
 void BoardGerberExport::drawDevice(GerberGenerator& gen,
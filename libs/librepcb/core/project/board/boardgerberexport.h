@@ -44,6 +44,7 @@ class BI_Device;
 class BI_FootprintPad;
 class BI_Via;
 class Board;
+class BoardGeometrySnapshot;
 class BoardFabricationOutputSettings;
 class Circle;
 class GerberGenerator;
@@ -123,8 +124,9 @@ private:
   int drawPthDrills(ExcellonGenerator& gen) const;
   QMap<LayerPair, QList<const BI_Via*> > getBlindBuriedVias() const;
   void drawLayer(GerberGenerator& gen, const Layer& layer) const;
-  void drawVia(GerberGenerator& gen, const BI_Via& via, const Layer& layer,
+  void drawVia(GerberGenerator& gen, int index, const Layer& layer,
                const QString& netName) const;
+  const BoardGeometrySnapshot& getGeometry() const noexcept;
   void drawDevice(GerberGenerator& gen, const BI_Device& device,
                   const Layer& layer) const;
   void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad,
@@ -159,6 +161,7 @@ private:
   mutable const Layer* mCurrentStartLayer;
   mutable const Layer* mCurrentEndLayer;
   mutable QVector<FilePath> mWrittenFiles;
+  mutable std::shared_ptr<const BoardGeometrySnapshot> mGeometry;
 };
 
 /*******************************************************************************
@@ -25,9 +25,11 @@
 #include "../../library/pkg/footprint.h"
 #include "../../library/pkg/footprintpad.h"
 #include "../../utils/clipperhelpers.h"
+#include "../../utils/tracer.h"
 #include "../../utils/transform.h"
 #include "../circuit/netsignal.h"
 #include "board.h"
+#include "boardgeometrysnapshot.h"
 #include "items/bi_device.h"
 #include "items/bi_footprintpad.h"
 #include "items/bi_hole.h"
@@ -76,8 +78,9 @@ BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept {
  ******************************************************************************/
 
 void BoardPlaneFragmentsBuilder::runSynchronously(
-    Board& board, const QSet<const Layer*>* layers) {
-  if (auto data = createJob(board, layers)) {
+    Board& board, const QSet<const Layer*>* layers,
+    std::shared_ptr<const BoardGeometrySnapshot> geometry) {
+  if (auto data = createJob(board, layers, geometry)) {
     cancel();
     if (!applyToBoard(run(data, true))) {  // can throw
       throw LogicError(__FILE__, __LINE__,
@@ -88,7 +91,7 @@ void BoardPlaneFragmentsBuilder::runSynchronously(
 
 bool BoardPlaneFragmentsBuilder::startAsynchronously(
     Board& board, const QSet<const Layer*>* layers) noexcept {
-  if (auto data = createJob(board, layers)) {
+  if (auto data = createJob(board, layers, nullptr)) {
     cancel();
     mFuture =
         QtConcurrent::run(this, &BoardPlaneFragmentsBuilder::run, data, false);
@@ -116,7 +119,9 @@ void BoardPlaneFragmentsBuilder::cancel() noexcept {
 
 std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
     BoardPlaneFragmentsBuilder::createJob(
-        Board& board, const QSet<const Layer*>* filter) noexcept {
+        Board& board, const QSet<const Layer*>* filter,
+        std::shared_ptr<const BoardGeometrySnapshot> geometry) noexcept {
+  LIBREPCB_TRACE_SCOPE("BoardPlaneFragmentsBuilder::createJob");
   QSet<const Layer*> layersWithPlanes;
   foreach (const BI_Plane* plane, board.getPlanes()) {
     if ((!filter) ||
@@ -137,19 +142,12 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
   auto data = std::make_shared<JobData>();
   data->board = &board;
   data->layers = layers;
+  data->geometry =
+      geometry ? geometry : std::make_shared<BoardGeometrySnapshot>(board);
   layers.insert(&Layer::boardOutlines());
   layers.insert(&Layer::boardCutouts());
   foreach (const BI_Device* device, board.getDeviceInstances()) {
     const Transform transform(*device);
-    foreach (const BI_FootprintPad* pad, device->getPads()) {
-      tl::optional<Uuid> netSignalUuid;
-      if (const NetSignal* netSignal = pad->getCompSigInstNetSignal()) {
-        netSignalUuid = netSignal->getUuid();
-      }
-      data->pads.append(PadData{Transform(*pad), netSignalUuid,
-                                pad->getLibPad().getCopperClearance(),
-                                pad->getGeometries()});
-    }
     for (const Polygon& polygon : device->getLibFootprint().getPolygons()) {
       const Layer& layer = transform.map(polygon.getLayer());
       if (layers.contains(&layer)) {
@@ -173,10 +171,6 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
             transform, zone.getLayers(), {}, zone.getOutline()});
       }
     }
-    for (const Hole& hole : device->getLibFootprint().getHoles()) {
-      data->holes.append(
-          std::make_tuple(transform, hole.getDiameter(), hole.getPath()));
-    }
     foreach (const BI_StrokeText* text, device->getStrokeTexts()) {
       if (layers.contains(&text->getData().getLayer())) {
         foreach (const Path& path, text->getPaths()) {
@@ -224,29 +218,6 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
       }
     }
   }
-  foreach (const BI_Hole* hole, board.getHoles()) {
-    data->holes.append(std::make_tuple(
-        Transform(), hole->getData().getDiameter(), hole->getData().getPath()));
-  }
-  foreach (const BI_NetSegment* segment, board.getNetSegments()) {
-    tl::optional<Uuid> netSignalUuid;
-    if (const NetSignal* netSignal = segment->getNetSignal()) {
-      netSignalUuid = netSignal->getUuid();
-    }
-    for (const BI_Via* via : segment->getVias()) {
-      data->vias.append(ViaData{
-          netSignalUuid, via->getVia().getPosition(), via->getVia().getSize(),
-          &via->getVia().getStartLayer(), &via->getVia().getEndLayer()});
-    }
-    for (const BI_NetLine* netline : segment->getNetLines()) {
-      if (layers.contains(&netline->getLayer())) {
-        data->traces.append(TraceData{&netline->getLayer(), netSignalUuid,
-                                      netline->getStartPoint().getPosition(),
-                                      netline->getEndPoint().getPosition(),
-                                      netline->getWidth()});
-      }
-    }
-  }
   return data;
 }
 
@@ -256,6 +227,9 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
   // Note: This method is called from a different thread, thus be careful with
   //       calling other methods to only call thread-safe methods!
 
+  LIBREPCB_TRACE_SCOPE("BoardPlaneFragmentsBuilder::run");
+  LIBREPCB_TRACE_COUNTER("BoardPlaneFragmentsBuilder::planes",
+                         data->planes.count());
   QElapsedTimer timer;
   timer.start();
   qDebug() << "Start calculating areas of" << data->planes.count()
@@ -282,16 +256,17 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
   for (PolygonData& polygon : data->polygons) {
     polygon.path = polygon.transform.map(polygon.path);
   }
-  for (auto& tuple : data->holes) {
-    std::get<2>(tuple) = std::get<0>(tuple).map(std::get<2>(tuple));
-  }
-  for (const TraceData& trace : data->traces) {
-    data->polygons.append(
-        PolygonData{Transform(), trace.layer, trace.netSignal,
-                    Path({Vertex(trace.startPos), Vertex(trace.endPos)}),
-                    positiveToUnsigned(trace.width), false});
+  const BoardGeometrySnapshot& geometry = *data->geometry;
+  foreach (const Layer* layer, data->layers) {
+    const BoardGeometrySnapshot::Traces& traces = geometry.getTraces(*layer);
+    for (int i = 0; i < traces.count(); ++i) {
+      data->polygons.append(PolygonData{
+          Transform(), layer,
+          geometry.getNetSignalUuid(traces.netSignal.at(i)),
+          Path({Vertex(traces.getStartPos(i)), Vertex(traces.getEndPos(i))}),
+          UnsignedLength(traces.width.at(i)), false});
+    }
   }
-  data->traces.clear();
 
   // Determine board area.
   QVector<Path> boardOutlines;
@@ -325,6 +300,7 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
 
   // Build all planes.
   for (auto it = data->planes.begin(); it != data->planes.end(); it++) {
+    LIBREPCB_TRACE_SCOPE("BoardPlaneFragmentsBuilder::buildPlane");
     try {
       ClipperLib::Paths removedAreas;
       ClipperLib::Paths connectedNetSignalAreas;
@@ -376,13 +352,13 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
       }
 
       // Collect holes.
-      foreach (const auto& tuple, data->holes) {
-        const PositiveLength diameter(std::get<1>(tuple) +
+      const BoardGeometrySnapshot::Holes& holes = geometry.getNpthHoles();
+      for (int i = 0; i < holes.count(); ++i) {
+        const PositiveLength diameter(Length(holes.diameter.at(i)) +
                                       it->minClearance * 2);
-        const QVector<Path> paths =
-            std::get<2>(tuple)->toOutlineStrokes(diameter);
         const ClipperLib::Paths clipperPaths =
-            ClipperHelpers::convert(paths, maxArcTolerance());
+            ClipperHelpers::convertOutlineStrokes(holes.path.at(i), diameter,
+                                                  maxArcTolerance());
         removedAreas.insert(removedAreas.end(), clipperPaths.begin(),
                             clipperPaths.end());
       }
@@ -391,26 +367,31 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
       }
 
       // Collect vias.
-      foreach (const ViaData& via, data->vias) {
-        if ((via.startLayer->getCopperNumber() >
+      const int planeNetSignal = geometry.indexOfNetSignal(it->netSignal);
+      const BoardGeometrySnapshot::Vias& vias = geometry.getVias();
+      for (int i = 0; i < vias.count(); ++i) {
+        if ((vias.startLayer.at(i)->getCopperNumber() >
              it->layer->getCopperNumber()) ||
-            (via.endLayer->getCopperNumber() < it->layer->getCopperNumber())) {
+            (vias.endLayer.at(i)->getCopperNumber() <
+             it->layer->getCopperNumber())) {
           continue;
         }
-        if (it->netSignal && (via.netSignal == it->netSignal)) {
+        const Point position = vias.getPosition(i);
+        const PositiveLength diameter(vias.size.at(i));
+        if ((planeNetSignal >= 0) && (vias.netSignal.at(i) == planeNetSignal)) {
           // Via has same net as plane -> no cut-out.
           // Note: Do not respect the plane connect style for vias, but always
           // connect them with solid style. Since vias are not soldered, heat
           // dissipation is not an issue or often even desired. See discussion
           // https://github.com/LibrePCB/LibrePCB/issues/454#issuecomment-1373402172
-          const Path path = Path::circle(via.diameter).translated(via.position);
+          const Path path = Path::circle(diameter).translated(position);
           connectedNetSignalAreas.push_back(
               ClipperHelpers::convert(path, maxArcTolerance()));
         } else {
           // Vias has different net than plane -> subtract with clearance.
           const Path path =
-              Path::circle(PositiveLength(via.diameter + it->minClearance * 2))
-                  .translated(via.position);
+              Path::circle(PositiveLength(diameter + it->minClearance * 2))
+                  .translated(position);
           const ClipperLib::Path clipperPath =
               ClipperHelpers::convert(path, maxArcTolerance());
           removedAreas.push_back(clipperPath);
@@ -433,10 +414,11 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
             }
             if ((!polygon.filled) || (polygon.width > 0)) {
               // Outline strokes.
-              const QVector<Path> paths = polygon.path.toOutlineStrokes(
-                  PositiveLength(std::max(*polygon.width, Length(1))));
               const ClipperLib::Paths clipperPaths =
-                  ClipperHelpers::convert(paths, maxArcTolerance());
+                  ClipperHelpers::convertOutlineStrokes(
+                      polygon.path,
+                      PositiveLength(std::max(*polygon.width, Length(1))),
+                      maxArcTolerance());
               connectedNetSignalAreas.insert(connectedNetSignalAreas.end(),
                                              clipperPaths.begin(),
                                              clipperPaths.end());
@@ -454,11 +436,12 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
             }
             if ((!polygon.filled) || (polygon.width > 0)) {
               // Outline strokes.
-              const QVector<Path> paths =
-                  polygon.path.toOutlineStrokes(PositiveLength(std::max(
-                      *polygon.width + it->minClearance * 2, Length(1))));
               const ClipperLib::Paths clipperPaths =
-                  ClipperHelpers::convert(paths, maxArcTolerance());
+                  ClipperHelpers::convertOutlineStrokes(
+                      polygon.path,
+                      PositiveLength(std::max(
+                          *polygon.width + it->minClearance * 2, Length(1))),
+                      maxArcTolerance());
               removedAreas.insert(removedAreas.end(), clipperPaths.begin(),
                                   clipperPaths.end());
             }
@@ -473,13 +456,16 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
       ClipperLib::Paths thermalPadAreas;
       ClipperLib::Paths thermalPadAreasShrinked;
       ClipperLib::Paths thermalPadClearanceAreas;
-      foreach (const PadData& pad, data->pads) {
-        const bool sameNet = it->netSignal && (pad.netSignal == it->netSignal);
-        foreach (const PadGeometry& geometry, pad.geometries.value(it->layer)) {
+      const BoardGeometrySnapshot::Pads& pads = geometry.getPads(*it->layer);
+      for (int i = 0; i < pads.count(); ++i) {
+        const Transform& padTransform = pads.transform.at(i);
+        const bool sameNet =
+            (planeNetSignal >= 0) && (pads.netSignal.at(i) == planeNetSignal);
+        foreach (const PadGeometry& padGeometry, pads.geometries.at(i)) {
           if (sameNet) {
             // Same net signal -> memorize as connected area.
             const QVector<Path> paths =
-                pad.transform.map(geometry.toOutlines());
+                padTransform.map(padGeometry.toOutlines());
             const ClipperLib::Paths clipperPaths =
                 ClipperHelpers::convert(paths, maxArcTolerance());
             connectedNetSignalAreas.insert(connectedNetSignalAreas.end(),
@@ -492,10 +478,11 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
             // pads of the same net, use the thermal gap clearance since usually
             // it is smaller than the planes clearance, so it leads to a higher
             // plane area.
-            const Length clearance = std::max(
-                sameNet ? *it->thermalGap : *it->minClearance, *pad.clearance);
-            QVector<Path> paths =
-                pad.transform.map(geometry.withOffset(clearance).toOutlines());
+            const Length clearance =
+                std::max(sameNet ? *it->thermalGap : *it->minClearance,
+                         Length(pads.clearance.at(i)));
+            QVector<Path> paths = padTransform.map(
+                padGeometry.withOffset(clearance).toOutlines());
             ClipperLib::Paths clipperPaths =
                 ClipperHelpers::convert(paths, maxArcTolerance());
 
@@ -509,15 +496,15 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
               const PositiveLength spokeWidth(it->thermalSpokeWidth + 10);
               const Length spokeLength(100000000);  // Maximum spoke length.
               foreach (const auto& spokeConfig,
-                       determineThermalSpokes(geometry)) {
+                       determineThermalSpokes(padGeometry)) {
                 const Point p1 =
-                    spokeConfig.first.rotated(pad.transform.getRotation()) +
-                    pad.transform.getPosition();
+                    spokeConfig.first.rotated(padTransform.getRotation()) +
+                    padTransform.getPosition();
                 const Point p2 =
                     (Point(spokeLength, 0).rotated(spokeConfig.second) +
                      spokeConfig.first)
-                        .rotated(pad.transform.getRotation()) +
-                    pad.transform.getPosition();
+                        .rotated(padTransform.getRotation()) +
+                    padTransform.getPosition();
                 const ClipperLib::Paths spokePaths{ClipperHelpers::convert(
                     Path::obround(p1, p2, spokeWidth), maxArcTolerance())};
                 ClipperHelpers::subtract(clipperPaths, spokePaths,
@@ -527,7 +514,8 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
               // Memorize copper area for later removal of unconnected
               // thermal spokes,
               ClipperLib::Paths tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.toOutlines()), maxArcTolerance());
+                  padTransform.map(padGeometry.toOutlines()),
+                  maxArcTolerance());
               if (tmp.size() > 1) {
                 ClipperHelpers::unite(tmp,
                                       ClipperLib::pftNonZero);  // can throw
@@ -538,7 +526,7 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
               // thermal spokes,
               Length offset = clearance + it->minWidth - maxArcTolerance() - 10;
               tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.withOffset(offset).toOutlines()),
+                  padTransform.map(padGeometry.withOffset(offset).toOutlines()),
                   maxArcTolerance());
               if (tmp.size() > 1) {
                 ClipperHelpers::unite(tmp,
@@ -550,7 +538,7 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
               // unconnected thermal spokes,
               offset = -maxArcTolerance() - 10;
               tmp = ClipperHelpers::convert(
-                  pad.transform.map(geometry.withOffset(offset).toOutlines()),
+                  padTransform.map(padGeometry.withOffset(offset).toOutlines()),
                   maxArcTolerance());
               thermalPadAreasShrinked.insert(thermalPadAreasShrinked.end(),
                                              tmp.begin(), tmp.end());
@@ -561,11 +549,11 @@ std::shared_ptr<BoardPlaneFragmentsBuilder::JobData>
             // Also create cut-outs for each hole to ensure correct clearance
             // even if the pad outline is too small or invalid.
             if (!sameNet) {
-              for (const PadHole& hole : geometry.getHoles()) {
+              for (const PadHole& hole : padGeometry.getHoles()) {
                 const PositiveLength width(hole.getDiameter() +
                                            (clearance * 2));
                 paths =
-                    pad.transform.map(hole.getPath()->toOutlineStrokes(width));
+                    padTransform.map(hole.getPath()->toOutlineStrokes(width));
                 clipperPaths =
                     ClipperHelpers::convert(paths, maxArcTolerance());
                 removedAreas.insert(removedAreas.end(), clipperPaths.begin(),
@@ -783,6 +771,7 @@ QVector<std::pair<Point, Angle>>
 
 bool BoardPlaneFragmentsBuilder::applyToBoard(
     std::shared_ptr<JobData> data) noexcept {
+  LIBREPCB_TRACE_SCOPE("BoardPlaneFragmentsBuilder::applyToBoard");
   if (data->board) {
     bool modified = false;
     for (auto it = data->result.begin(); it != data->result.end(); it++) {
@@ -39,6 +39,7 @@
 namespace librepcb {
 
 class Board;
+class BoardGeometrySnapshot;
 class Layer;
 class NetSignal;
 class PadGeometry;
@@ -70,11 +71,15 @@ public:
    *                to rebuild and located on the given layers (quick rebuild).
    *                If `nullptr` (default), rebuild all planes (more reliable,
    *                but slower).
+   * @param geometry  If not `nullptr`, use this (up-to-date) geometry snapshot
+   *                  of the board instead of creating a new one. Allows
+   *                  sharing the snapshot e.g. with the DRC.
    *
    * @throws Exception if any error occurred.
    */
-  void runSynchronously(Board& board,
-                        const QSet<const Layer*>* layers = nullptr);
+  void runSynchronously(
+      Board& board, const QSet<const Layer*>* layers = nullptr,
+      std::shared_ptr<const BoardGeometrySnapshot> geometry = nullptr);
 
   /**
    * @brief Start building plane fragments asynchronously
@@ -148,45 +153,20 @@ private:  // Methods
     bool filled;
   };
 
-  struct ViaData {
-    tl::optional<Uuid> netSignal;
-    Point position;
-    PositiveLength diameter;
-    const Layer* startLayer;
-    const Layer* endLayer;
-  };
-
-  struct PadData {
-    Transform transform;
-    tl::optional<Uuid> netSignal;
-    UnsignedLength clearance;
-    QHash<const Layer*, QList<PadGeometry>> geometries;
-  };
-
-  struct TraceData {
-    const Layer* layer;
-    tl::optional<Uuid> netSignal;
-    Point startPos;
-    Point endPos;
-    PositiveLength width;
-  };
-
   struct JobData {
     QPointer<Board> board;
     QSet<const Layer*> layers;
     QList<PlaneData> planes;
     QList<KeepoutZoneData> keepoutZones;
     QList<PolygonData> polygons;
-    QList<ViaData> vias;
-    QList<PadData> pads;
-    QList<std::tuple<Transform, PositiveLength, NonEmptyPath>> holes;
-    QList<TraceData> traces;  // Converted to polygons after preprocessing.
+    std::shared_ptr<const BoardGeometrySnapshot> geometry;  // Vias, pads, ...
     QHash<Uuid, QVector<Path>> result;
     bool finished = false;
   };
 
-  std::shared_ptr<JobData> createJob(Board& board,
-                                     const QSet<const Layer*>* filter) noexcept;
+  std::shared_ptr<JobData> createJob(
+      Board& board, const QSet<const Layer*>* filter,
+      std::shared_ptr<const BoardGeometrySnapshot> geometry) noexcept;
   std::shared_ptr<JobData> run(std::shared_ptr<JobData> data,
                                bool exceptionOnError);
   static QVector<std::pair<Point, Angle>> determineThermalSpokes(
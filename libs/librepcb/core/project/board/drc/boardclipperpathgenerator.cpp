@@ -287,10 +287,11 @@ void BoardClipperPathGenerator::addPolygon(const Path& path,
   // Outline.
   const Length totalWidth = lineWidth + offset * 2;
   if ((lineWidth > 0) && (totalWidth > 0)) {
-    QVector<Path> paths = path.toOutlineStrokes(PositiveLength(totalWidth));
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    ClipperHelpers::unite(
+        mPaths,
+        ClipperHelpers::convertOutlineStrokes(
+            path, PositiveLength(totalWidth), mMaxArcTolerance),
+        ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
   }
 
   // Area (only fill closed paths, for consistency with the appearance in
@@ -315,11 +316,11 @@ void BoardClipperPathGenerator::addCircle(const Circle& circle,
 
   // Outline.
   if (circle.getLineWidth() > 0) {
-    QVector<Path> paths =
-        path.toOutlineStrokes(PositiveLength(*circle.getLineWidth()));
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    ClipperHelpers::unite(
+        mPaths,
+        ClipperHelpers::convertOutlineStrokes(
+            path, PositiveLength(*circle.getLineWidth()), mMaxArcTolerance),
+        ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
   }
 
   // Area.
@@ -336,10 +337,10 @@ void BoardClipperPathGenerator::addStrokeText(const BI_StrokeText& strokeText,
       qMax(*strokeText.getData().getStrokeWidth() + (offset * 2), Length(1)));
   const Transform transform(strokeText.getData());
   foreach (const Path path, transform.map(strokeText.getPaths())) {
-    QVector<Path> paths = path.toOutlineStrokes(width);
-    ClipperHelpers::unite(mPaths,
-                          ClipperHelpers::convert(paths, mMaxArcTolerance),
-                          ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+    ClipperHelpers::unite(
+        mPaths,
+        ClipperHelpers::convertOutlineStrokes(path, width, mMaxArcTolerance),
+        ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
   }
 }
 
@@ -348,11 +349,10 @@ void BoardClipperPathGenerator::addHole(const PositiveLength& diameter,
                                         const Transform& transform,
                                         const Length& offset) {
   const PositiveLength width(std::max(*diameter + offset + offset, Length(1)));
-  ClipperHelpers::unite(
-      mPaths,
-      ClipperHelpers::convert(transform.map(*path).toOutlineStrokes(width),
-                              mMaxArcTolerance),
-      ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
+  ClipperHelpers::unite(mPaths,
+                        ClipperHelpers::convertOutlineStrokes(
+                            transform.map(*path), width, mMaxArcTolerance),
+                        ClipperLib::pftEvenOdd, ClipperLib::pftNonZero);
 }
 
 void BoardClipperPathGenerator::addPad(const BI_FootprintPad& pad,
@@ -30,13 +30,16 @@
 #include "../../../library/pkg/footprintpad.h"
 #include "../../../library/pkg/packagepad.h"
 #include "../../../utils/clipperhelpers.h"
+#include "../../../utils/scopeguard.h"
 #include "../../../utils/toolbox.h"
+#include "../../../utils/tracer.h"
 #include "../../../utils/transform.h"
 #include "../../circuit/circuit.h"
 #include "../../circuit/componentinstance.h"
 #include "../../circuit/netsignal.h"
 #include "../../project.h"
 #include "../board.h"
+#include "../boardgeometrysnapshot.h"
 #include "../boardplanefragmentsbuilder.h"
 #include "../items/bi_airwire.h"
 #include "../items/bi_device.h"
@@ -83,12 +86,15 @@ BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept {
  ******************************************************************************/
 
 void BoardDesignRuleCheck::execute(bool quick) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::execute");
   emit started();
   emitProgress(2);
 
   mIgnorePlanes = quick;
   mProgressStatus.clear();
   mMessages.clear();
+  mGeometry = std::make_shared<BoardGeometrySnapshot>(mBoard);
+  auto sg = scopeGuard([this]() { mGeometry.reset(); });
 
   if (!quick) {
     rebuildPlanes(12);  // 10%
@@ -122,6 +128,7 @@ void BoardDesignRuleCheck::execute(bool quick) {
     checkForStaleObjects(97);  // 2%
   }
 
+  LIBREPCB_TRACE_COUNTER("BoardDesignRuleCheck::messages", mMessages.count());
   emitStatus(
       tr("Finished with %1 message(s)!", "Count of messages", mMessages.count())
           .arg(mMessages.count()));
@@ -134,13 +141,15 @@ void BoardDesignRuleCheck::execute(bool quick) {
  ******************************************************************************/
 
 void BoardDesignRuleCheck::rebuildPlanes(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::rebuildPlanes");
   emitStatus(tr("Rebuild planes..."));
   BoardPlaneFragmentsBuilder builder;
-  builder.runSynchronously(mBoard);  // can throw
+  builder.runSynchronously(mBoard, nullptr, mGeometry);  // can throw
   emitProgress(progressEnd);
 }
 
 void BoardDesignRuleCheck::checkCopperCopperClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkCopperCopperClearances");
   const UnsignedLength clearance = mSettings.getMinCopperCopperClearance();
   if (clearance == 0) {
     return;
@@ -426,6 +435,7 @@ void BoardDesignRuleCheck::checkCopperCopperClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkCopperBoardClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkCopperBoardClearances");
   const UnsignedLength clearance = mSettings.getMinCopperBoardClearance();
   if (clearance == 0) {
     return;
@@ -574,6 +584,7 @@ void BoardDesignRuleCheck::checkCopperBoardClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkCopperHoleClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkCopperHoleClearances");
   const UnsignedLength clearance = mSettings.getMinCopperNpthClearance();
   if (clearance == 0) {
     return;
@@ -629,6 +640,7 @@ void BoardDesignRuleCheck::checkCopperHoleClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkDrillDrillClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkDrillDrillClearances");
   const UnsignedLength clearance = mSettings.getMinDrillDrillClearance();
   if (clearance == 0) {
     return;
@@ -717,6 +729,7 @@ void BoardDesignRuleCheck::checkDrillDrillClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkDrillBoardClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkDrillBoardClearances");
   const UnsignedLength clearance = mSettings.getMinDrillBoardClearance();
   if (clearance == 0) {
     return;
@@ -791,6 +804,8 @@ void BoardDesignRuleCheck::checkDrillBoardClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkSilkscreenStopmaskClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE(
+      "BoardDesignRuleCheck::checkSilkscreenStopmaskClearances");
   const UnsignedLength clearance =
       mSettings.getMinSilkscreenStopmaskClearance();
   const QVector<const Layer*> layersTop = mBoard.getSilkscreenLayersTop();
@@ -879,6 +894,7 @@ void BoardDesignRuleCheck::checkSilkscreenStopmaskClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumCopperWidth");
   const UnsignedLength minWidth = mSettings.getMinCopperWidth();
   if (minWidth == 0) {
     return;
@@ -892,6 +908,7 @@ void BoardDesignRuleCheck::checkMinimumCopperWidth(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumPthAnnularRing(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumPthAnnularRing");
   const UnsignedLength annularWidth = mSettings.getMinPthAnnularRing();
   if (annularWidth == 0) {
     return;
@@ -910,13 +927,13 @@ void BoardDesignRuleCheck::checkMinimumPthAnnularRing(int progressEnd) {
       ClipperHelpers::treeToPaths(*thtCopperAreaIntersections);
 
   // Check via annular rings.
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      const Length annular = (*via->getSize() - *via->getDrillDiameter()) / 2;
-      if (annular < (*annularWidth)) {
-        emitMessage(std::make_shared<DrcMsgMinimumAnnularRingViolation>(
-            *via, annularWidth, getViaLocation(*via)));
-      }
+  const BoardGeometrySnapshot::Vias& vias = mGeometry->getVias();
+  for (int i = 0; i < vias.count(); ++i) {
+    const Length annular((vias.size.at(i) - vias.drill.at(i)) / 2);
+    if (annular < (*annularWidth)) {
+      const BI_Via& via = *vias.items.at(i);
+      emitMessage(std::make_shared<DrcMsgMinimumAnnularRingViolation>(
+          via, annularWidth, getViaLocation(via)));
     }
   }
 
@@ -959,6 +976,7 @@ void BoardDesignRuleCheck::checkMinimumPthAnnularRing(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumNpthDrillDiameter");
   const UnsignedLength minDiameter = mSettings.getMinNpthDrillDiameter();
   if (minDiameter == 0) {
     return;
@@ -990,6 +1008,7 @@ void BoardDesignRuleCheck::checkMinimumNpthDrillDiameter(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumNpthSlotWidth(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumNpthSlotWidth");
   const UnsignedLength minWidth = mSettings.getMinNpthSlotWidth();
   if (minWidth == 0) {
     return;
@@ -1021,6 +1040,7 @@ void BoardDesignRuleCheck::checkMinimumNpthSlotWidth(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumPthDrillDiameter");
   const UnsignedLength minDiameter = mSettings.getMinPthDrillDiameter();
   if (minDiameter == 0) {
     return;
@@ -1029,14 +1049,14 @@ void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressEnd) {
   emitStatus(tr("Check PTH drill diameters..."));
 
   // Vias.
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    foreach (const BI_Via* via, netsegment->getVias()) {
-      if (via->getDrillDiameter() < minDiameter) {
-        const QVector<Path> locations{Path::circle(via->getDrillDiameter())
-                                          .translated(via->getPosition())};
-        emitMessage(std::make_shared<DrcMsgMinimumDrillDiameterViolation>(
-            *via, minDiameter, locations));
-      }
+  const BoardGeometrySnapshot::Vias& vias = mGeometry->getVias();
+  for (int i = 0; i < vias.count(); ++i) {
+    if (vias.drill.at(i) < minDiameter->toNm()) {
+      const QVector<Path> locations{
+          Path::circle(PositiveLength(vias.drill.at(i)))
+              .translated(vias.getPosition(i))};
+      emitMessage(std::make_shared<DrcMsgMinimumDrillDiameterViolation>(
+          *vias.items.at(i), minDiameter, locations));
     }
   }
 
@@ -1059,6 +1079,7 @@ void BoardDesignRuleCheck::checkMinimumPthDrillDiameter(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumPthSlotWidth(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumPthSlotWidth");
   const UnsignedLength minWidth = mSettings.getMinPthSlotWidth();
   if (minWidth == 0) {
     return;
@@ -1083,6 +1104,7 @@ void BoardDesignRuleCheck::checkMinimumPthSlotWidth(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumSilkscreenWidth(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkMinimumSilkscreenWidth");
   const UnsignedLength minWidth = mSettings.getMinSilkscreenWidth();
   const QVector<const Layer*> layers =
       mBoard.getSilkscreenLayersTop() + mBoard.getSilkscreenLayersBot();
@@ -1098,6 +1120,8 @@ void BoardDesignRuleCheck::checkMinimumSilkscreenWidth(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkMinimumSilkscreenTextHeight(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE(
+      "BoardDesignRuleCheck::checkMinimumSilkscreenTextHeight");
   const UnsignedLength minHeight = mSettings.getMinSilkscreenTextHeight();
   const QVector<const Layer*> layers =
       mBoard.getSilkscreenLayersTop() + mBoard.getSilkscreenLayersBot();
@@ -1125,6 +1149,7 @@ void BoardDesignRuleCheck::checkMinimumSilkscreenTextHeight(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkZones(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkZones");
   emitStatus(tr("Check keepout zones..."));
 
   // Collect all zones.
@@ -1388,6 +1413,7 @@ void BoardDesignRuleCheck::checkZones(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkVias(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkVias");
   emitStatus(tr("Check for useless or disallowed vias..."));
 
   foreach (const BI_NetSegment* segment, mBoard.getNetSegments()) {
@@ -1409,6 +1435,7 @@ void BoardDesignRuleCheck::checkVias(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkAllowedNpthSlots(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkAllowedNpthSlots");
   const BoardDesignRuleCheckSettings::AllowedSlots allowed =
       mSettings.getAllowedNpthSlots();
   if (allowed == BoardDesignRuleCheckSettings::AllowedSlots::Any) {
@@ -1440,6 +1467,7 @@ void BoardDesignRuleCheck::checkAllowedNpthSlots(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkAllowedPthSlots(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkAllowedPthSlots");
   const BoardDesignRuleCheckSettings::AllowedSlots allowed =
       mSettings.getAllowedPthSlots();
   if (allowed == BoardDesignRuleCheckSettings::AllowedSlots::Any) {
@@ -1465,6 +1493,7 @@ void BoardDesignRuleCheck::checkAllowedPthSlots(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkInvalidPadConnections(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkInvalidPadConnections");
   emitStatus(tr("Check pad connections..."));
 
   // Pads.
@@ -1499,6 +1528,7 @@ void BoardDesignRuleCheck::checkInvalidPadConnections(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkDeviceClearances(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkDeviceClearances");
   emitStatus(tr("Check device clearances..."));
 
   for (const auto& layers :
@@ -1555,6 +1585,7 @@ void BoardDesignRuleCheck::checkDeviceClearances(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkBoardOutline(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkBoardOutline");
   emitStatus(tr("Check board outline..."));
 
   // Report all open polygons.
@@ -1630,6 +1661,7 @@ void BoardDesignRuleCheck::checkBoardOutline(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkForUnplacedComponents(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkForUnplacedComponents");
   emitStatus(tr("Check for unplaced components..."));
 
   foreach (const ComponentInstance* cmp,
@@ -1645,6 +1677,7 @@ void BoardDesignRuleCheck::checkForUnplacedComponents(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkForMissingConnections(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkForMissingConnections");
   emitStatus(tr("Check for missing connections..."));
 
   // No check based on copper paths implemented yet -> return existing airwires
@@ -1663,6 +1696,7 @@ void BoardDesignRuleCheck::checkForMissingConnections(int progressEnd) {
 }
 
 void BoardDesignRuleCheck::checkForStaleObjects(int progressEnd) {
+  LIBREPCB_TRACE_SCOPE("BoardDesignRuleCheck::checkForStaleObjects");
   emitStatus(tr("Check for stale objects..."));
 
   foreach (const BI_NetSegment* netSegment, mBoard.getNetSegments()) {
@@ -1798,17 +1832,18 @@ void BoardDesignRuleCheck::checkMinimumWidth(
   }
 
   // Netlines.
-  foreach (const BI_NetSegment* netsegment, mBoard.getNetSegments()) {
-    foreach (const BI_NetLine* netline, netsegment->getNetLines()) {
-      if (!layerFilter(netline->getLayer())) {
-        continue;
-      }
-      if (netline->getWidth() < minWidth) {
-        const QVector<Path> locations{Path::obround(
-            netline->getStartPoint().getPosition(),
-            netline->getEndPoint().getPosition(), netline->getWidth())};
+  foreach (const Layer* layer, Layer::all()) {
+    if ((!layer->isCopper()) || (!layerFilter(*layer))) {
+      continue;
+    }
+    const BoardGeometrySnapshot::Traces& traces = mGeometry->getTraces(*layer);
+    for (int i = 0; i < traces.count(); ++i) {
+      if (traces.width.at(i) < minWidth->toNm()) {
+        const QVector<Path> locations{
+            Path::obround(traces.getStartPos(i), traces.getEndPos(i),
+                          PositiveLength(traces.width.at(i)))};
         emitMessage(std::make_shared<DrcMsgMinimumWidthViolation>(
-            *netline, minWidth, locations));
+            *traces.items.at(i), minWidth, locations));
       }
     }
   }
@@ -38,6 +38,7 @@ namespace librepcb {
 
 class BI_Device;
 class Board;
+class BoardGeometrySnapshot;
 class Hole;
 class NetSignal;
 
@@ -139,6 +140,7 @@ private:  // Data
   int mProgressPercent;
   QStringList mProgressStatus;
   RuleCheckMessageList mMessages;
+  std::shared_ptr<const BoardGeometrySnapshot> mGeometry;  ///< During run
   QHash<QPair<const Layer*, QSet<const NetSignal*>>, ClipperLib::Paths>
       mCachedPaths;
 };
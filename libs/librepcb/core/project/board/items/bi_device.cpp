@@ -249,11 +249,11 @@ StrokeTextList BI_Device::getDefaultStrokeTexts() const noexcept {
   // identification.
   StrokeTextList texts = mLibFootprint->getStrokeTexts();
   Transform transform(*this);
-  for (StrokeText& text : texts) {
-    text.setPosition(transform.map(text.getPosition()));
-    text.setRotation(transform.mapMirrorable(text.getRotation()));
-    text.setMirrored(transform.map(text.getMirrored()));
-    text.setLayer(transform.map(text.getLayer()));
+  for (const auto& text : texts.values()) {
+    text->setPosition(transform.map(text->getPosition()));
+    text->setRotation(transform.mapMirrorable(text->getRotation()));
+    text->setMirrored(transform.map(text->getMirrored()));
+    text->setLayer(transform.map(text->getLayer()));
   }
   return texts;
 }
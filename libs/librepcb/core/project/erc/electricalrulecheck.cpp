@@ -30,6 +30,7 @@
 #include "../circuit/netclass.h"
 #include "../circuit/netsignal.h"
 #include "../project.h"
+#include "../schematic/items/si_netline.h"
 #include "../schematic/items/si_netpoint.h"
 #include "../schematic/items/si_netsegment.h"
 #include "../schematic/items/si_symbol.h"
@@ -48,8 +49,34 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-ElectricalRuleCheck::ElectricalRuleCheck(const Project& project) noexcept
-  : mProject(project) {
+ElectricalRuleCheck::ElectricalRuleCheck(const Project& project) noexcept {
+  foreach (const NetClass* netClass, project.getCircuit().getNetClasses()) {
+    mNetClasses.append(NetClassData{netClass->getUuid(),
+                                    *netClass->getName(), netClass->isUsed()});
+  }
+
+  foreach (const NetSignal* net, project.getCircuit().getNetSignals()) {
+    // Do not count component signals of schematic-only components since these
+    // are just "virtual" connections, i.e. not represented by a real pad (see
+    // https://github.com/LibrePCB/LibrePCB/issues/739).
+    int realComponentSignalCount = 0;
+    foreach (const ComponentSignalInstance* sig, net->getComponentSignals()) {
+      if (!sig->getComponentInstance().getLibComponent().isSchematicOnly()) {
+        ++realComponentSignalCount;
+      }
+    }
+    mNetSignals.append(NetSignalData{net->getUuid(), *net->getName(),
+                                     realComponentSignalCount});
+  }
+
+  foreach (const ComponentInstance* cmp,
+           project.getCircuit().getComponentInstances()) {
+    mComponents.append(collectComponent(*cmp));
+  }
+
+  foreach (const Schematic* schematic, project.getSchematics()) {
+    mSchematics.append(collectSchematic(*schematic));
+  }
 }
 
 ElectricalRuleCheck::~ElectricalRuleCheck() noexcept {
@@ -60,13 +87,13 @@ ElectricalRuleCheck::~ElectricalRuleCheck() noexcept {
  ******************************************************************************/
 
 RuleCheckMessageList ElectricalRuleCheck::runChecks() const {
-  mOpenNetSignals.clear();
+  QSet<Uuid> openNetSignals;
 
   RuleCheckMessageList msgs;
   checkNetClasses(msgs);
-  checkNetSignals(msgs);
+  checkNetSignals(msgs, openNetSignals);
   checkComponents(msgs);
-  checkSchematics(msgs);
+  checkSchematics(msgs, openNetSignals);
   return msgs;
 }
 
@@ -74,55 +101,115 @@ RuleCheckMessageList ElectricalRuleCheck::runChecks() const {
  *  Private Methods
  ******************************************************************************/
 
+ElectricalRuleCheck::ComponentData ElectricalRuleCheck::collectComponent(
+    const ComponentInstance& cmp) noexcept {
+  ComponentData data{cmp.getUuid(), *cmp.getName(),
+                     QList<ComponentSignalData>(), QList<GateData>()};
+  foreach (const ComponentSignalInstance* sig, cmp.getSignals()) {
+    tl::optional<QString> netName;
+    if (const NetSignal* net = sig->getNetSignal()) {
+      netName = *net->getName();
+    }
+    tl::optional<QString> forcedNetName;
+    if (sig->isNetSignalNameForced()) {
+      forcedNetName = sig->getForcedNetSignalName();
+    }
+    data.componentSignals.append(ComponentSignalData{
+        sig->getCompSignal().getUuid(), *sig->getCompSignal().getName(),
+        sig->getCompSignal().isRequired(), netName, forcedNetName});
+  }
+  for (const ComponentSymbolVariantItem& gate :
+       cmp.getSymbolVariant().getSymbolItems()) {
+    data.gates.append(GateData{gate.getUuid(), *gate.getSuffix(),
+                               gate.isRequired(),
+                               cmp.getSymbols().contains(gate.getUuid())});
+  }
+  return data;
+}
+
+ElectricalRuleCheck::SchematicData ElectricalRuleCheck::collectSchematic(
+    const Schematic& schematic) noexcept {
+  SchematicData data{schematic.getUuid(), QList<SymbolData>(),
+                     QList<NetSegmentData>()};
+  foreach (const SI_Symbol* symbol, schematic.getSymbols()) {
+    data.symbols.append(collectSymbol(*symbol));
+  }
+  foreach (const SI_NetSegment* netSegment, schematic.getNetSegments()) {
+    data.netSegments.append(collectNetSegment(*netSegment));
+  }
+  return data;
+}
+
+ElectricalRuleCheck::SymbolData ElectricalRuleCheck::collectSymbol(
+    const SI_Symbol& symbol) noexcept {
+  SymbolData data{symbol.getUuid(), symbol.getName(), QList<PinData>()};
+  foreach (const SI_SymbolPin* pin, symbol.getPins()) {
+    data.pins.append(PinData{pin->getLibPinUuid(), pin->getName(),
+                             pin->getCompSigInstNetSignal() != nullptr,
+                             !pin->getNetLines().isEmpty()});
+  }
+  return data;
+}
+
+ElectricalRuleCheck::NetSegmentData ElectricalRuleCheck::collectNetSegment(
+    const SI_NetSegment& netSegment) noexcept {
+  bool hasOpenNetLines = false;
+  foreach (const SI_NetLine* netLine, netSegment.getNetLines()) {
+    if (netLine->getStartPoint().isOpen() || netLine->getEndPoint().isOpen()) {
+      hasOpenNetLines = true;
+      break;
+    }
+  }
+  NetSegmentData data{netSegment.getUuid(),
+                      netSegment.getNetSignal().getUuid(),
+                      *netSegment.getNetSignal().getName(),
+                      !netSegment.getNetLabels().isEmpty(),
+                      hasOpenNetLines,
+                      QList<NetPointData>()};
+  foreach (const SI_NetPoint* netPoint, netSegment.getNetPoints()) {
+    data.netPoints.append(
+        NetPointData{netPoint->getUuid(), !netPoint->getNetLines().isEmpty()});
+  }
+  return data;
+}
+
 void ElectricalRuleCheck::checkNetClasses(RuleCheckMessageList& msgs) const {
   // Don't warn if there's only one netclass, as we need one to be used as
   // default when adding a new wire.
-  if (mProject.getCircuit().getNetClasses().count() <= 1) {
+  if (mNetClasses.count() <= 1) {
     return;
   }
 
-  foreach (const NetClass* netClass, mProject.getCircuit().getNetClasses()) {
-    if (!netClass->isUsed()) {
-      msgs.append(std::make_shared<ErcMsgUnusedNetClass>(*netClass));
+  foreach (const NetClassData& netClass, mNetClasses) {
+    if (!netClass.used) {
+      msgs.append(std::make_shared<ErcMsgUnusedNetClass>(netClass));
     }
   }
 }
 
-void ElectricalRuleCheck::checkNetSignals(RuleCheckMessageList& msgs) const {
-  foreach (const NetSignal* net, mProject.getCircuit().getNetSignals()) {
-    // Raise a warning if the net signal is connected to less then two component
-    // signals. But do not count component signals of schematic-only components
-    // since these are just "virtual" connections, i.e. not represented by a
-    // real pad (see https://github.com/LibrePCB/LibrePCB/issues/739).
-    const QList<ComponentSignalInstance*>& sigs = net->getComponentSignals();
-    int registeredRealComponentCount = sigs.count();
-    if (registeredRealComponentCount >= 2) {  // Optimization
-      foreach (const ComponentSignalInstance* sig, sigs) {
-        if (sig->getComponentInstance().getLibComponent().isSchematicOnly()) {
-          --registeredRealComponentCount;
-        }
-      }
-    }
-    if (registeredRealComponentCount < 2) {
-      mOpenNetSignals.insert(net);
-      msgs.append(std::make_shared<ErcMsgOpenNet>(*net));
+void ElectricalRuleCheck::checkNetSignals(RuleCheckMessageList& msgs,
+                                          QSet<Uuid>& openNetSignals) const {
+  foreach (const NetSignalData& net, mNetSignals) {
+    // Raise a warning if the net signal is connected to less then two
+    // (real) component signals.
+    if (net.realComponentSignalCount < 2) {
+      openNetSignals.insert(net.uuid);
+      msgs.append(std::make_shared<ErcMsgOpenNet>(net));
     }
   }
 }
 
 void ElectricalRuleCheck::checkComponents(RuleCheckMessageList& msgs) const {
-  foreach (const ComponentInstance* cmp,
-           mProject.getCircuit().getComponentInstances()) {
-    checkComponentSignals(*cmp, msgs);
+  foreach (const ComponentData& cmp, mComponents) {
+    checkComponentSignals(cmp, msgs);
 
     // Check for unplaced gates.
-    for (const ComponentSymbolVariantItem& gate :
-         cmp->getSymbolVariant().getSymbolItems()) {
-      if (!cmp->getSymbols().contains(gate.getUuid())) {
-        if (gate.isRequired()) {
-          msgs.append(std::make_shared<ErcMsgUnplacedRequiredGate>(*cmp, gate));
+    foreach (const GateData& gate, cmp.gates) {
+      if (!gate.placed) {
+        if (gate.required) {
+          msgs.append(std::make_shared<ErcMsgUnplacedRequiredGate>(cmp, gate));
         } else {
-          msgs.append(std::make_shared<ErcMsgUnplacedOptionalGate>(*cmp, gate));
+          msgs.append(std::make_shared<ErcMsgUnplacedOptionalGate>(cmp, gate));
         }
       }
     }
@@ -130,69 +217,68 @@ void ElectricalRuleCheck::checkComponents(RuleCheckMessageList& msgs) const {
 }
 
 void ElectricalRuleCheck::checkComponentSignals(
-    const ComponentInstance& cmp, RuleCheckMessageList& msgs) const {
-  foreach (const ComponentSignalInstance* sig, cmp.getSignals()) {
+    const ComponentData& cmp, RuleCheckMessageList& msgs) const {
+  foreach (const ComponentSignalData& sig, cmp.componentSignals) {
     // Check for forced net name conflict.
-    const QString netName =
-        sig->getNetSignal() ? (*sig->getNetSignal()->getName()) : QString();
-    if ((sig->getCompSignal().isRequired()) && (!sig->getNetSignal())) {
-      msgs.append(std::make_shared<ErcMsgUnconnectedRequiredSignal>(*sig));
-    } else if (sig->isNetSignalNameForced() &&
-               (sig->getForcedNetSignalName() != netName)) {
-      msgs.append(std::make_shared<ErcMsgForcedNetSignalNameConflict>(*sig));
+    if (sig.required && (!sig.netName)) {
+      msgs.append(std::make_shared<ErcMsgUnconnectedRequiredSignal>(cmp, sig));
+    } else if (sig.forcedNetName &&
+               (*sig.forcedNetName != sig.netName.value_or(QString()))) {
+      msgs.append(
+          std::make_shared<ErcMsgForcedNetSignalNameConflict>(cmp, sig));
     }
   }
 }
 
-void ElectricalRuleCheck::checkSchematics(RuleCheckMessageList& msgs) const {
-  foreach (const Schematic* schematic, mProject.getSchematics()) {
-    checkSymbols(*schematic, msgs);
-    checkNetSegments(*schematic, msgs);
+void ElectricalRuleCheck::checkSchematics(
+    RuleCheckMessageList& msgs, const QSet<Uuid>& openNetSignals) const {
+  foreach (const SchematicData& schematic, mSchematics) {
+    checkSymbols(schematic, msgs);
+    checkNetSegments(schematic, msgs, openNetSignals);
   }
 }
 
-void ElectricalRuleCheck::checkSymbols(const Schematic& schematic,
+void ElectricalRuleCheck::checkSymbols(const SchematicData& schematic,
                                        RuleCheckMessageList& msgs) const {
-  foreach (const SI_Symbol* symbol, schematic.getSymbols()) {
-    checkPins(*symbol, msgs);
+  foreach (const SymbolData& symbol, schematic.symbols) {
+    checkPins(schematic, symbol, msgs);
   }
 }
 
-void ElectricalRuleCheck::checkPins(const SI_Symbol& symbol,
+void ElectricalRuleCheck::checkPins(const SchematicData& schematic,
+                                    const SymbolData& symbol,
                                     RuleCheckMessageList& msgs) const {
-  foreach (const SI_SymbolPin* pin, symbol.getPins()) {
-    if ((pin->getNetLines().isEmpty()) && (pin->getCompSigInstNetSignal())) {
-      msgs.append(std::make_shared<ErcMsgConnectedPinWithoutWire>(*pin));
+  foreach (const PinData& pin, symbol.pins) {
+    if ((!pin.hasNetLines) && pin.connectedToNet) {
+      msgs.append(std::make_shared<ErcMsgConnectedPinWithoutWire>(
+          schematic, symbol, pin));
     }
   }
 }
 
-void ElectricalRuleCheck::checkNetSegments(const Schematic& schematic,
-                                           RuleCheckMessageList& msgs) const {
-  foreach (const SI_NetSegment* netSegment, schematic.getNetSegments()) {
-    checkNetPoints(*netSegment, msgs);
+void ElectricalRuleCheck::checkNetSegments(
+    const SchematicData& schematic, RuleCheckMessageList& msgs,
+    const QSet<Uuid>& openNetSignals) const {
+  foreach (const NetSegmentData& netSegment, schematic.netSegments) {
+    checkNetPoints(schematic, netSegment, msgs);
 
     // If there are no net labels, check for any open wire. But only if there's
     // no "open net" warning on the net raised, since this would be quite a
     // duplicate warning.
-    if (netSegment->getNetLabels().isEmpty() &&
-        (!mOpenNetSignals.contains(&netSegment->getNetSignal()))) {
-      foreach (const SI_NetLine* netLine, netSegment->getNetLines()) {
-        if (netLine->getStartPoint().isOpen() ||
-            netLine->getEndPoint().isOpen()) {
-          msgs.append(std::make_shared<ErcMsgOpenWireInSegment>(*netSegment));
-          break;
-        }
-      }
+    if ((!netSegment.hasNetLabels) && netSegment.hasOpenNetLines &&
+        (!openNetSignals.contains(netSegment.netSignal))) {
+      msgs.append(std::make_shared<ErcMsgOpenWireInSegment>(netSegment));
     }
   }
 }
 
-void ElectricalRuleCheck::checkNetPoints(const SI_NetSegment& netSegment,
+void ElectricalRuleCheck::checkNetPoints(const SchematicData& schematic,
+                                         const NetSegmentData& netSegment,
                                          RuleCheckMessageList& msgs) const {
-  foreach (const SI_NetPoint* netPoint, netSegment.getNetPoints()) {
-    if (netPoint->getNetLines().isEmpty()) {
-      msgs.append(std::make_shared<ErcMsgUnconnectedJunction>(*netPoint));
+  foreach (const NetPointData& netPoint, netSegment.netPoints) {
+    if (!netPoint.hasNetLines) {
+      msgs.append(std::make_shared<ErcMsgUnconnectedJunction>(
+          schematic, netSegment, netPoint));
     }
   }
 }
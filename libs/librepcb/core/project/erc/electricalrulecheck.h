@@ -24,6 +24,9 @@
  *  Includes
  ******************************************************************************/
 #include "../../rulecheck/rulecheckmessage.h"
+#include "../../types/uuid.h"
+
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
@@ -33,7 +36,6 @@
 namespace librepcb {
 
 class ComponentInstance;
-class NetSignal;
 class Project;
 class SI_NetSegment;
 class SI_Symbol;
@@ -44,11 +46,74 @@ class Schematic;
  ******************************************************************************/
 
 /**
- * @brief The ElectricalRuleCheck class checks a ::librepcb::Board for
- *        design rule violations
+ * @brief The ElectricalRuleCheck class checks a ::librepcb::Project for
+ *        electrical rule violations
+ *
+ * The constructor copies all data needed for the checks from the project, so
+ * #runChecks() does not access the project anymore. This allows to run the
+ * checks in a worker thread while the project is being modified.
  */
 class ElectricalRuleCheck final {
 public:
+  // Types
+  struct NetClassData {
+    Uuid uuid;
+    QString name;
+    bool used;
+  };
+  struct NetSignalData {
+    Uuid uuid;
+    QString name;
+    int realComponentSignalCount;  ///< Excluding schematic-only components
+  };
+  struct ComponentSignalData {
+    Uuid uuid;  ///< UUID of the library component signal
+    QString name;
+    bool required;
+    tl::optional<QString> netName;  ///< `tl::nullopt` if not connected
+    tl::optional<QString> forcedNetName;  ///< `tl::nullopt` if not forced
+  };
+  struct GateData {
+    Uuid uuid;
+    QString suffix;
+    bool required;
+    bool placed;
+  };
+  struct ComponentData {
+    Uuid uuid;
+    QString name;
+    QList<ComponentSignalData> componentSignals;
+    QList<GateData> gates;
+  };
+  struct PinData {
+    Uuid uuid;  ///< UUID of the library symbol pin
+    QString name;
+    bool connectedToNet;
+    bool hasNetLines;
+  };
+  struct SymbolData {
+    Uuid uuid;
+    QString name;
+    QList<PinData> pins;
+  };
+  struct NetPointData {
+    Uuid uuid;
+    bool hasNetLines;
+  };
+  struct NetSegmentData {
+    Uuid uuid;
+    Uuid netSignal;
+    QString netName;
+    bool hasNetLabels;
+    bool hasOpenNetLines;
+    QList<NetPointData> netPoints;
+  };
+  struct SchematicData {
+    Uuid uuid;
+    QList<SymbolData> symbols;
+    QList<NetSegmentData> netSegments;
+  };
+
   // Constructors / Destructor
   explicit ElectricalRuleCheck(const Project& project) noexcept;
   ~ElectricalRuleCheck() noexcept;
@@ -57,23 +122,35 @@ public:
   RuleCheckMessageList runChecks() const;
 
 private:  // Methods
+  static ComponentData collectComponent(const ComponentInstance& cmp) noexcept;
+  static SchematicData collectSchematic(const Schematic& schematic) noexcept;
+  static SymbolData collectSymbol(const SI_Symbol& symbol) noexcept;
+  static NetSegmentData collectNetSegment(
+      const SI_NetSegment& netSegment) noexcept;
   void checkNetClasses(RuleCheckMessageList& msgs) const;
-  void checkNetSignals(RuleCheckMessageList& msgs) const;
+  void checkNetSignals(RuleCheckMessageList& msgs,
+                       QSet<Uuid>& openNetSignals) const;
   void checkComponents(RuleCheckMessageList& msgs) const;
-  void checkComponentSignals(const ComponentInstance& cmp,
+  void checkComponentSignals(const ComponentData& cmp,
                              RuleCheckMessageList& msgs) const;
-  void checkSchematics(RuleCheckMessageList& msgs) const;
-  void checkSymbols(const Schematic& schematic,
+  void checkSchematics(RuleCheckMessageList& msgs,
+                       const QSet<Uuid>& openNetSignals) const;
+  void checkSymbols(const SchematicData& schematic,
                     RuleCheckMessageList& msgs) const;
-  void checkPins(const SI_Symbol& symbol, RuleCheckMessageList& msgs) const;
-  void checkNetSegments(const Schematic& schematic,
-                        RuleCheckMessageList& msgs) const;
-  void checkNetPoints(const SI_NetSegment& netSegment,
+  void checkPins(const SchematicData& schematic, const SymbolData& symbol,
+                 RuleCheckMessageList& msgs) const;
+  void checkNetSegments(const SchematicData& schematic,
+                        RuleCheckMessageList& msgs,
+                        const QSet<Uuid>& openNetSignals) const;
+  void checkNetPoints(const SchematicData& schematic,
+                      const NetSegmentData& netSegment,
                       RuleCheckMessageList& msgs) const;
 
 private:  // Data
-  const Project& mProject;
-  mutable QSet<const NetSignal*> mOpenNetSignals;
+  QList<NetClassData> mNetClasses;
+  QList<NetSignalData> mNetSignals;
+  QList<ComponentData> mComponents;
+  QList<SchematicData> mSchematics;
 };
 
 /*******************************************************************************
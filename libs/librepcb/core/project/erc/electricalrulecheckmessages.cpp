@@ -22,17 +22,7 @@
  ******************************************************************************/
 #include "electricalrulecheckmessages.h"
 
-#include "../../library/cmp/componentsignal.h"
-#include "../../library/cmp/componentsymbolvariantitem.h"
-#include "../circuit/componentinstance.h"
-#include "../circuit/componentsignalinstance.h"
-#include "../circuit/netclass.h"
-#include "../circuit/netsignal.h"
-#include "../schematic/items/si_netpoint.h"
-#include "../schematic/items/si_netsegment.h"
-#include "../schematic/items/si_symbol.h"
-#include "../schematic/items/si_symbolpin.h"
-#include "../schematic/schematic.h"
+#include <QtCore>
 
 /*******************************************************************************
  *  Namespace
@@ -43,27 +33,29 @@ namespace librepcb {
  *  ErcMsgUnusedNetClass
  ******************************************************************************/
 
-ErcMsgUnusedNetClass::ErcMsgUnusedNetClass(const NetClass& netClass) noexcept
+ErcMsgUnusedNetClass::ErcMsgUnusedNetClass(
+    const ElectricalRuleCheck::NetClassData& netClass) noexcept
   : RuleCheckMessage(Severity::Hint,
-                     tr("Unused net class: '%1'").arg(*netClass.getName()),
+                     tr("Unused net class: '%1'").arg(netClass.name),
                      tr("There are no nets assigned to the net class, so you "
                         "could remove it."),
                      "unused_netclass") {
-  mApproval.appendChild("netclass", netClass.getUuid());
+  mApproval.appendChild("netclass", netClass.uuid);
 }
 
 /*******************************************************************************
  *  ErcMsgOpenNet
  ******************************************************************************/
 
-ErcMsgOpenNet::ErcMsgOpenNet(const NetSignal& net) noexcept
+ErcMsgOpenNet::ErcMsgOpenNet(
+    const ElectricalRuleCheck::NetSignalData& net) noexcept
   : RuleCheckMessage(Severity::Warning,
-                     tr("Less than two pins in net: '%1'").arg(*net.getName()),
+                     tr("Less than two pins in net: '%1'").arg(net.name),
                      tr("The net is connected to less than two pins, so it "
                         "does not represent an electrical connection. Check if "
                         "you missed to connect more pins."),
                      "open_net") {
-  mApproval.appendChild("net", net.getUuid());
+  mApproval.appendChild("net", net.uuid);
 }
 
 /*******************************************************************************
@@ -71,16 +63,15 @@ ErcMsgOpenNet::ErcMsgOpenNet(const NetSignal& net) noexcept
  ******************************************************************************/
 
 ErcMsgOpenWireInSegment::ErcMsgOpenWireInSegment(
-    const SI_NetSegment& segment) noexcept
+    const ElectricalRuleCheck::NetSegmentData& segment) noexcept
   : RuleCheckMessage(
-        Severity::Warning,
-        tr("Open wire in net: '%1'").arg(*segment.getNetSignal().getName()),
+        Severity::Warning, tr("Open wire in net: '%1'").arg(segment.netName),
         tr("The wire has an open (unconnected) end with no net "
            "label attached, thus is looks like a mistake. Check "
            "if a connection to another wire or pin is missing (denoted by a "
            "cross mark)."),
         "open_wire") {
-  mApproval.appendChild("segment", segment.getUuid());
+  mApproval.appendChild("segment", segment.uuid);
 }
 
 /*******************************************************************************
@@ -88,19 +79,19 @@ ErcMsgOpenWireInSegment::ErcMsgOpenWireInSegment(
  ******************************************************************************/
 
 ErcMsgUnconnectedRequiredSignal::ErcMsgUnconnectedRequiredSignal(
-    const ComponentSignalInstance& signal) noexcept
+    const ElectricalRuleCheck::ComponentData& component,
+    const ElectricalRuleCheck::ComponentSignalData& signal) noexcept
   : RuleCheckMessage(Severity::Error,
                      tr("Unconnected component signal: '%1:%2'")
-                         .arg(*signal.getComponentInstance().getName(),
-                              *signal.getCompSignal().getName()),
+                         .arg(component.name, signal.name),
                      tr("The component signal is marked as required, but is "
                         "not connected to any net. Add a wire to the "
                         "corresponding symbol pin to connect it to a net."),
                      "unconnected_required_signal") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("component", signal.getComponentInstance().getUuid());
+  mApproval.appendChild("component", component.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("signal", signal.getCompSignal().getUuid());
+  mApproval.appendChild("signal", signal.uuid);
   mApproval.ensureLineBreak();
 }
 
@@ -109,29 +100,30 @@ ErcMsgUnconnectedRequiredSignal::ErcMsgUnconnectedRequiredSignal(
  ******************************************************************************/
 
 ErcMsgForcedNetSignalNameConflict::ErcMsgForcedNetSignalNameConflict(
-    const ComponentSignalInstance& signal) noexcept
+    const ElectricalRuleCheck::ComponentData& component,
+    const ElectricalRuleCheck::ComponentSignalData& signal) noexcept
   : RuleCheckMessage(
         Severity::Error,
         tr("Net name conflict: '%1' != '%2' ('%3:%4')")
-            .arg(getSignalNet(signal), signal.getForcedNetSignalName(),
-                 *signal.getComponentInstance().getName(),
-                 *signal.getCompSignal().getName()),
+            .arg(getSignalNet(signal),
+                 signal.forcedNetName.value_or(QString()), component.name,
+                 signal.name),
         tr("The component signal requires the attached net to be named '%1', "
            "but it is named '%2'. Either rename the net manually or remove "
            "this connection.")
-            .arg(signal.getForcedNetSignalName(), getSignalNet(signal)),
+            .arg(signal.forcedNetName.value_or(QString()),
+                 getSignalNet(signal)),
         "forced_net_name_conflict") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("component", signal.getComponentInstance().getUuid());
+  mApproval.appendChild("component", component.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("signal", signal.getCompSignal().getUuid());
+  mApproval.appendChild("signal", signal.uuid);
   mApproval.ensureLineBreak();
 }
 
 QString ErcMsgForcedNetSignalNameConflict::getSignalNet(
-    const ComponentSignalInstance& signal) noexcept {
-  return (signal.getNetSignal() ? (*signal.getNetSignal()->getName())
-                                : QString());
+    const ElectricalRuleCheck::ComponentSignalData& signal) noexcept {
+  return signal.netName.value_or(QString());
 }
 
 /*******************************************************************************
@@ -139,19 +131,19 @@ QString ErcMsgForcedNetSignalNameConflict::getSignalNet(
  ******************************************************************************/
 
 ErcMsgUnplacedRequiredGate::ErcMsgUnplacedRequiredGate(
-    const ComponentInstance& component,
-    const ComponentSymbolVariantItem& gate) noexcept
+    const ElectricalRuleCheck::ComponentData& component,
+    const ElectricalRuleCheck::GateData& gate) noexcept
   : RuleCheckMessage(Severity::Error,
                      tr("Unplaced required gate: '%1:%2'")
-                         .arg(*component.getName(), *gate.getSuffix()),
+                         .arg(component.name, gate.suffix),
                      tr("The gate '%1' of '%2' is marked as required, but it "
                         "is not added to the schematic.")
-                         .arg(*gate.getSuffix(), *component.getName()),
+                         .arg(gate.suffix, component.name),
                      "unplaced_required_gate") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("component", component.getUuid());
+  mApproval.appendChild("component", component.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("gate", gate.getUuid());
+  mApproval.appendChild("gate", gate.uuid);
   mApproval.ensureLineBreak();
 }
 
@@ -160,19 +152,19 @@ ErcMsgUnplacedRequiredGate::ErcMsgUnplacedRequiredGate(
  ******************************************************************************/
 
 ErcMsgUnplacedOptionalGate::ErcMsgUnplacedOptionalGate(
-    const ComponentInstance& component,
-    const ComponentSymbolVariantItem& gate) noexcept
+    const ElectricalRuleCheck::ComponentData& component,
+    const ElectricalRuleCheck::GateData& gate) noexcept
   : RuleCheckMessage(
         Severity::Warning,
         tr("Unplaced gate: '%1:%2'")
-            .arg(*component.getName(), *gate.getSuffix()),
+            .arg(component.name, gate.suffix),
         tr("The optional gate '%1' of '%2' is not added to the schematic.")
-            .arg(*gate.getSuffix(), *component.getName()),
+            .arg(gate.suffix, component.name),
         "unplaced_optional_gate") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("component", component.getUuid());
+  mApproval.appendChild("component", component.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("gate", gate.getUuid());
+  mApproval.appendChild("gate", gate.uuid);
   mApproval.ensureLineBreak();
 }
 
@@ -181,21 +173,22 @@ ErcMsgUnplacedOptionalGate::ErcMsgUnplacedOptionalGate(
  ******************************************************************************/
 
 ErcMsgConnectedPinWithoutWire::ErcMsgConnectedPinWithoutWire(
-    const SI_SymbolPin& pin) noexcept
-  : RuleCheckMessage(
-        Severity::Warning,
-        tr("Connected pin without wire: '%1:%2'")
-            .arg(pin.getSymbol().getName(), pin.getName()),
+    const ElectricalRuleCheck::SchematicData& schematic,
+    const ElectricalRuleCheck::SymbolData& symbol,
+    const ElectricalRuleCheck::PinData& pin) noexcept
+  : RuleCheckMessage(Severity::Warning,
+                     tr("Connected pin without wire: '%1:%2'")
+                         .arg(symbol.name, pin.name),
         tr("The pin is electrically connected to a net, but has no wire "
            "attached so this connection is not visible in the schematic. Add a "
            "wire to make the connection visible."),
         "connected_pin_without_wire") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("schematic", pin.getSchematic().getUuid());
+  mApproval.appendChild("schematic", schematic.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("symbol", pin.getSymbol().getUuid());
+  mApproval.appendChild("symbol", symbol.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("pin", pin.getLibPinUuid());
+  mApproval.appendChild("pin", pin.uuid);
   mApproval.ensureLineBreak();
 }
 
@@ -204,22 +197,23 @@ ErcMsgConnectedPinWithoutWire::ErcMsgConnectedPinWithoutWire(
  ******************************************************************************/
 
 ErcMsgUnconnectedJunction::ErcMsgUnconnectedJunction(
-    const SI_NetPoint& netPoint) noexcept
+    const ElectricalRuleCheck::SchematicData& schematic,
+    const ElectricalRuleCheck::NetSegmentData& netSegment,
+    const ElectricalRuleCheck::NetPointData& netPoint) noexcept
   : RuleCheckMessage(
         Severity::Hint,
-        tr("Unconnected junction in net: '%1'")
-            .arg(*netPoint.getNetSignalOfNetSegment().getName()),
+        tr("Unconnected junction in net: '%1'").arg(netSegment.netName),
         "There's an invisible junction in the schematic without any wire "
         "attached. This should not happen, please report it as a bug. But "
         "no worries, this issue is not harmful at all so you can safely "
         "ignore this message.",
         "unconnected_junction") {
   mApproval.ensureLineBreak();
-  mApproval.appendChild("schematic", netPoint.getSchematic().getUuid());
+  mApproval.appendChild("schematic", schematic.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("netsegment", netPoint.getNetSegment().getUuid());
+  mApproval.appendChild("netsegment", netSegment.uuid);
   mApproval.ensureLineBreak();
-  mApproval.appendChild("junction", netPoint.getUuid());
+  mApproval.appendChild("junction", netPoint.uuid);
   mApproval.ensureLineBreak();
 }
 
@@ -24,23 +24,15 @@
  *  Includes
  ******************************************************************************/
 #include "../../rulecheck/rulecheckmessage.h"
+#include "electricalrulecheck.h"
 
 #include <QtCore>
 
 /*******************************************************************************
- *  Namespace / Forward Declarations
+ *  Namespace
  ******************************************************************************/
 namespace librepcb {
 
-class ComponentInstance;
-class ComponentSignalInstance;
-class ComponentSymbolVariantItem;
-class NetClass;
-class NetSignal;
-class SI_NetPoint;
-class SI_NetSegment;
-class SI_SymbolPin;
-
 /*******************************************************************************
  *  Class ErcMsgUnusedNetClass
  ******************************************************************************/
@@ -54,7 +46,8 @@ class ErcMsgUnusedNetClass final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgUnusedNetClass() = delete;
-  explicit ErcMsgUnusedNetClass(const NetClass& netClass) noexcept;
+  explicit ErcMsgUnusedNetClass(
+      const ElectricalRuleCheck::NetClassData& netClass) noexcept;
   ErcMsgUnusedNetClass(const ErcMsgUnusedNetClass& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgUnusedNetClass() noexcept {}
@@ -73,7 +66,8 @@ class ErcMsgOpenNet final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgOpenNet() = delete;
-  explicit ErcMsgOpenNet(const NetSignal& net) noexcept;
+  explicit ErcMsgOpenNet(
+      const ElectricalRuleCheck::NetSignalData& net) noexcept;
   ErcMsgOpenNet(const ErcMsgOpenNet& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgOpenNet() noexcept {}
@@ -92,7 +86,8 @@ class ErcMsgOpenWireInSegment final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgOpenWireInSegment() = delete;
-  explicit ErcMsgOpenWireInSegment(const SI_NetSegment& segment) noexcept;
+  explicit ErcMsgOpenWireInSegment(
+      const ElectricalRuleCheck::NetSegmentData& segment) noexcept;
   ErcMsgOpenWireInSegment(const ErcMsgOpenWireInSegment& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgOpenWireInSegment() noexcept {}
@@ -111,8 +106,9 @@ class ErcMsgUnconnectedRequiredSignal final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgUnconnectedRequiredSignal() = delete;
-  explicit ErcMsgUnconnectedRequiredSignal(
-      const ComponentSignalInstance& signal) noexcept;
+  ErcMsgUnconnectedRequiredSignal(
+      const ElectricalRuleCheck::ComponentData& component,
+      const ElectricalRuleCheck::ComponentSignalData& signal) noexcept;
   ErcMsgUnconnectedRequiredSignal(
       const ErcMsgUnconnectedRequiredSignal& other) noexcept
     : RuleCheckMessage(other) {}
@@ -132,15 +128,17 @@ class ErcMsgForcedNetSignalNameConflict final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgForcedNetSignalNameConflict() = delete;
-  explicit ErcMsgForcedNetSignalNameConflict(
-      const ComponentSignalInstance& signal) noexcept;
+  ErcMsgForcedNetSignalNameConflict(
+      const ElectricalRuleCheck::ComponentData& component,
+      const ElectricalRuleCheck::ComponentSignalData& signal) noexcept;
   ErcMsgForcedNetSignalNameConflict(
       const ErcMsgForcedNetSignalNameConflict& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgForcedNetSignalNameConflict() noexcept {}
 
 private:
-  static QString getSignalNet(const ComponentSignalInstance& signal) noexcept;
+  static QString getSignalNet(
+      const ElectricalRuleCheck::ComponentSignalData& signal) noexcept;
 };
 
 /*******************************************************************************
@@ -156,9 +154,9 @@ class ErcMsgUnplacedRequiredGate final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgUnplacedRequiredGate() = delete;
-  explicit ErcMsgUnplacedRequiredGate(
-      const ComponentInstance& component,
-      const ComponentSymbolVariantItem& gate) noexcept;
+  ErcMsgUnplacedRequiredGate(
+      const ElectricalRuleCheck::ComponentData& component,
+      const ElectricalRuleCheck::GateData& gate) noexcept;
   ErcMsgUnplacedRequiredGate(const ErcMsgUnplacedRequiredGate& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgUnplacedRequiredGate() noexcept {}
@@ -177,9 +175,9 @@ class ErcMsgUnplacedOptionalGate final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgUnplacedOptionalGate() = delete;
-  explicit ErcMsgUnplacedOptionalGate(
-      const ComponentInstance& component,
-      const ComponentSymbolVariantItem& gate) noexcept;
+  ErcMsgUnplacedOptionalGate(
+      const ElectricalRuleCheck::ComponentData& component,
+      const ElectricalRuleCheck::GateData& gate) noexcept;
   ErcMsgUnplacedOptionalGate(const ErcMsgUnplacedOptionalGate& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgUnplacedOptionalGate() noexcept {}
@@ -198,7 +196,10 @@ class ErcMsgConnectedPinWithoutWire final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgConnectedPinWithoutWire() = delete;
-  explicit ErcMsgConnectedPinWithoutWire(const SI_SymbolPin& pin) noexcept;
+  ErcMsgConnectedPinWithoutWire(
+      const ElectricalRuleCheck::SchematicData& schematic,
+      const ElectricalRuleCheck::SymbolData& symbol,
+      const ElectricalRuleCheck::PinData& pin) noexcept;
   ErcMsgConnectedPinWithoutWire(
       const ErcMsgConnectedPinWithoutWire& other) noexcept
     : RuleCheckMessage(other) {}
@@ -218,7 +219,10 @@ class ErcMsgUnconnectedJunction final : public RuleCheckMessage {
 public:
   // Constructors / Destructor
   ErcMsgUnconnectedJunction() = delete;
-  explicit ErcMsgUnconnectedJunction(const SI_NetPoint& netPoint) noexcept;
+  ErcMsgUnconnectedJunction(
+      const ElectricalRuleCheck::SchematicData& schematic,
+      const ElectricalRuleCheck::NetSegmentData& netSegment,
+      const ElectricalRuleCheck::NetPointData& netPoint) noexcept;
   ErcMsgUnconnectedJunction(const ErcMsgUnconnectedJunction& other) noexcept
     : RuleCheckMessage(other) {}
   virtual ~ErcMsgUnconnectedJunction() noexcept {}
@@ -36,6 +36,7 @@
 #include "projectlibrary.h"
 #include "schematic/schematic.h"
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -62,6 +63,9 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
     mNormOrder(),
     mCustomBomAttributes(),
     mDefaultLockComponentAssembly(false),
+    mCircuitModified(true),
+    mModifiedSchematics(),
+    mModifiedBoards(),
     mPrimaryBoard(nullptr) {
   // Check if the file extension is correct
   if (!mFilename.endsWith(".lpp")) {
@@ -245,6 +249,7 @@ void Project::addSchematic(Schematic& schematic, int newIndex) {
 
   schematic.addToProject();  // can throw
   mSchematics.insert(newIndex, &schematic);
+  mModifiedSchematics.insert(&schematic);
 
   if (mRemovedSchematics.contains(&schematic)) {
     mRemovedSchematics.removeOne(&schematic);
@@ -270,6 +275,7 @@ void Project::removeSchematic(Schematic& schematic, bool deleteSchematic) {
 
   schematic.removeFromProject();  // can throw
   mSchematics.removeAt(index);
+  mModifiedSchematics.remove(&schematic);
 
   emit schematicRemoved(index);
   emit attributesChanged();
@@ -332,6 +338,7 @@ void Project::addBoard(Board& board, int newIndex) {
 
   board.addToProject();  // can throw
   mBoards.insert(newIndex, &board);
+  mModifiedBoards.insert(&board);
 
   if (mRemovedBoards.contains(&board)) {
     mRemovedBoards.removeOne(&board);
@@ -352,6 +359,7 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
 
   board.removeFromProject();  // can throw
   mBoards.removeAt(index);
+  mModifiedBoards.remove(&board);
 
   emit boardRemoved(index);
   updatePrimaryBoard();
@@ -368,6 +376,28 @@ void Project::removeBoard(Board& board, bool deleteBoard) {
  *  General Methods
  ******************************************************************************/
 
+void Project::setSchematicModified(const Schematic& schematic) noexcept {
+  if (mSchematics.contains(const_cast<Schematic*>(&schematic))) {
+    mModifiedSchematics.insert(&schematic);
+  }
+}
+
+void Project::setBoardModified(const Board& board) noexcept {
+  if (mBoards.contains(const_cast<Board*>(&board))) {
+    mModifiedBoards.insert(&board);
+  }
+}
+
+void Project::setAllDocumentsModified() noexcept {
+  mCircuitModified = true;
+  foreach (const Schematic* schematic, mSchematics) {
+    mModifiedSchematics.insert(schematic);
+  }
+  foreach (const Board* board, mBoards) {
+    mModifiedBoards.insert(board);
+  }
+}
+
 void Project::save() {
   qDebug() << "Save project files to transactional file system...";
 
@@ -443,13 +473,6 @@ void Project::save() {
     mDirectory->write("project/jobs.lp", root.toByteArray());
   }
 
-  // Circuit.
-  {
-    SExpression root = SExpression::createList("librepcb_circuit");
-    mCircuit->serialize(root);
-    mDirectory->write("circuit/circuit.lp", root.toByteArray());
-  }
-
   // ERC.
   {
     SExpression root = SExpression::createList("librepcb_erc");
@@ -462,6 +485,38 @@ void Project::save() {
     mDirectory->write("circuit/erc.lp", root.toByteArray());
   }
 
+  // Circuit, schematics & boards. These are by far the largest documents, so
+  // only the modified ones are serialized, and that in parallel. Note that the
+  // project is not modified in the meantime since the calling thread is
+  // blocked until all are done. Board::save() and Schematic::save() only
+  // serialize their own items, i.e. they do not touch any shared mutable
+  // state like the project-level attribute and library caches. Only the
+  // (mutex-guarded) file system is shared.
+  QVector<std::function<void()>> documents;
+  if (mCircuitModified) {
+    documents.append([this]() {
+      SExpression root = SExpression::createList("librepcb_circuit");
+      mCircuit->serialize(root);
+      mDirectory->write("circuit/circuit.lp", root.toByteArray());
+    });
+  }
+  foreach (Schematic* schematic, mSchematics) {
+    if (mModifiedSchematics.contains(schematic)) {
+      documents.append([schematic]() { schematic->save(); });
+    }
+  }
+  foreach (Board* board, mBoards) {
+    if (mModifiedBoards.contains(board)) {
+      documents.append([board]() { board->save(); });
+    }
+  }
+  QtConcurrent::blockingMap(
+      documents,
+      [](const std::function<void()>& document) { document(); });  // can throw
+  mCircuitModified = false;
+  mModifiedSchematics.clear();
+  mModifiedBoards.clear();
+
   // Schematics.
   {
     SExpression root = SExpression::createList("librepcb_schematics");
@@ -470,7 +525,6 @@ void Project::save() {
       root.appendChild(
           "schematic",
           "schematics/" + schematic->getDirectoryName() + "/schematic.lp");
-      schematic->save();
     }
     root.ensureLineBreak();
     mDirectory->write("schematics/schematics.lp", root.toByteArray());
@@ -483,7 +537,6 @@ void Project::save() {
       root.ensureLineBreak();
       root.appendChild("board",
                        "boards/" + board->getDirectoryName() + "/board.lp");
-      board->save();
     }
     root.ensureLineBreak();
     mDirectory->write("boards/boards.lp", root.toByteArray());
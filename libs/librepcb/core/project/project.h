@@ -491,9 +491,38 @@ public:
 
   // General Methods
 
+  /**
+   * @brief Mark the circuit as modified (see #save())
+   */
+  void setCircuitModified() noexcept { mCircuitModified = true; }
+
+  /**
+   * @brief Mark a schematic as modified (see #save())
+   *
+   * @param schematic   The modified schematic
+   */
+  void setSchematicModified(const Schematic& schematic) noexcept;
+
+  /**
+   * @brief Mark a board as modified (see #save())
+   *
+   * @param board       The modified board
+   */
+  void setBoardModified(const Board& board) noexcept;
+
+  /**
+   * @brief Mark the circuit and all schematics & boards as modified
+   */
+  void setAllDocumentsModified() noexcept;
+
   /**
    * @brief Save the project to the transactional file system
    *
+   * To avoid serializing large projects on every (auto)save, the circuit,
+   * schematics and boards are only serialized if they were marked as
+   * modified since the last save. Initially, all of them are considered as
+   * modified. All the other (small) project files are always serialized.
+   *
    * @throw Exception     If an error occurred.
    */
   void save();
@@ -634,6 +663,11 @@ private:  // Data
   /// All approved ERC messages
   QSet<SExpression> mErcMessageApprovals;
 
+  // Modification tracking (see save())
+  bool mCircuitModified;
+  QSet<const Schematic*> mModifiedSchematics;
+  QSet<const Board*> mModifiedBoards;
+
   // Cached properties
   QPointer<Board> mPrimaryBoard;
 };
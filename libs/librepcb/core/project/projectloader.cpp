@@ -31,6 +31,7 @@
 #include "../library/sym/symbol.h"
 #include "../serialization/fileformatmigration.h"
 #include "../types/pcbcolor.h"
+#include "../utils/tracer.h"
 #include "board/board.h"
 #include "board/boarddesignrules.h"
 #include "board/boardfabricationoutputsettings.h"
@@ -93,6 +94,7 @@ std::unique_ptr<Project> ProjectLoader::open(
   Q_ASSERT(directory);
   mUpgradeMessages = tl::nullopt;
 
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::open");
   QElapsedTimer timer;
   timer.start();
   const FilePath fp = directory->getAbsPath(filename);
@@ -173,6 +175,7 @@ std::unique_ptr<Project> ProjectLoader::open(
  ******************************************************************************/
 
 void ProjectLoader::loadMetadata(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadMetadata");
   qDebug() << "Load project metadata...";
   const QString fp = "project/metadata.lp";
   SExpression root = SExpression::parse(p.getDirectory().read(fp),
@@ -189,6 +192,7 @@ void ProjectLoader::loadMetadata(Project& p) {
 }
 
 void ProjectLoader::loadSettings(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadSettings");
   qDebug() << "Load project settings...";
   const QString fp = "project/settings.lp";
   const SExpression root = SExpression::parse(p.getDirectory().read(fp),
@@ -228,6 +232,7 @@ void ProjectLoader::loadSettings(Project& p) {
 }
 
 void ProjectLoader::loadOutputJobs(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadOutputJobs");
   qDebug() << "Load output jobs...";
   const QString fp = "project/jobs.lp";
   const SExpression root = SExpression::parse(p.getDirectory().read(fp),
@@ -237,6 +242,7 @@ void ProjectLoader::loadOutputJobs(Project& p) {
 }
 
 void ProjectLoader::loadLibrary(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadLibrary");
   qDebug() << "Load project library...";
 
   loadLibraryElements<Symbol>(p, "sym", "symbols", &ProjectLibrary::addSymbol);
@@ -278,6 +284,7 @@ void ProjectLoader::loadLibraryElements(
 }
 
 void ProjectLoader::loadCircuit(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadCircuit");
   qDebug() << "Load circuit...";
   const QString fp = "circuit/circuit.lp";
   SExpression root = SExpression::parse(p.getDirectory().read(fp),
@@ -379,6 +386,7 @@ void ProjectLoader::loadCircuit(Project& p) {
 }
 
 void ProjectLoader::loadErc(Project& p) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadErc");
   qDebug() << "Load ERC approvals...";
   const QString fp = "circuit/erc.lp";
   const SExpression root = SExpression::parse(p.getDirectory().read(fp),
@@ -407,6 +415,7 @@ void ProjectLoader::loadSchematics(Project& p) {
 }
 
 void ProjectLoader::loadSchematic(Project& p, const QString& relativeFilePath) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadSchematic");
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
@@ -552,6 +561,7 @@ void ProjectLoader::loadBoards(Project& p) {
 }
 
 void ProjectLoader::loadBoard(Project& p, const QString& relativeFilePath) {
+  LIBREPCB_TRACE_SCOPE("ProjectLoader::loadBoard");
   const FilePath fp = FilePath::fromRelative(p.getPath(), relativeFilePath);
   std::unique_ptr<TransactionalDirectory> dir(new TransactionalDirectory(
       p.getDirectory(), fp.getParentDir().toRelative(p.getPath())));
@@ -157,11 +157,11 @@ TextList SI_Symbol::getDefaultTexts() const noexcept {
   // identification.
   TextList texts = mSymbol->getTexts();
   Transform transform(*this);
-  for (Text& text : texts) {
-    text.setPosition(transform.map(text.getPosition()));
-    text.setRotation(transform.mapNonMirrorable(text.getRotation()));
+  for (const auto& text : texts.values()) {
+    text->setPosition(transform.map(text->getPosition()));
+    text->setRotation(transform.mapNonMirrorable(text->getRotation()));
     if (transform.getMirrored()) {
-      text.setAlign(text.getAlign().mirroredV());
+      text->setAlign(text->getAlign().mirroredV());
     }
   }
   return texts;
@@ -54,7 +54,8 @@ namespace librepcb {
  *   librepcb::SExpression.
  * - Iterators (for example to use in C++11 range based for loops).
  * - Methods to find elements by UUID and/or name (if supported by template type
- *   `T`).
+ *   `T`). For large lists, these lookups are accelerated by lazily built hash
+ *   indices.
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by
  *   UUID.
  * - Signals to get notified about added, removed and modified elements.
@@ -118,7 +119,6 @@ public:
     }
     ~Iterator() {}
   };
-  using iterator = Iterator<typename QVector<std::shared_ptr<T>>::iterator, T>;
   using const_iterator =
       Iterator<typename QVector<std::shared_ptr<T>>::const_iterator, const T>;
 
@@ -225,6 +225,10 @@ public:
     return -1;
   }
   int indexOf(const Uuid& key) const noexcept {
+    if (count() >= sMinIndexedCount) {
+      return lookup(mUuidIndex, key,
+                    [](const T& obj) { return Uuid(obj.getUuid()); });
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getUuid() == key) {
         return i;
@@ -233,6 +237,11 @@ public:
     return -1;
   }
   int indexOf(const QString& name) const noexcept {
+    if (count() >= sMinIndexedCount) {
+      return lookup(mNameIndex, name, [](const T& obj) {
+        return QString(nameToString(obj.getName()));
+      });
+    }
     for (int i = 0; i < count(); ++i) {
       if (mObjects[i]->getName() == name) {
         return i;
@@ -272,9 +281,11 @@ public:
   std::shared_ptr<const T> at(int index) const noexcept {
     return std::const_pointer_cast<const T>(mObjects.at(index));
   }  // always read-only!
-  std::shared_ptr<T>& first() noexcept { return mObjects.first(); }
+  // Note: Only const references are returned since replacing elements must
+  // go through the mutators to keep the lookup indices up to date.
+  const std::shared_ptr<T>& first() noexcept { return mObjects.first(); }
   std::shared_ptr<const T> first() const noexcept { return mObjects.first(); }
-  std::shared_ptr<T>& last() noexcept { return mObjects.last(); }
+  const std::shared_ptr<T>& last() noexcept { return mObjects.last(); }
   std::shared_ptr<const T> last() const noexcept { return mObjects.last(); }
   std::shared_ptr<T> get(const T* obj) {
     std::shared_ptr<T> ptr = find(obj);
@@ -303,12 +314,13 @@ public:
   }
 
   // Iterator Access
+  // Note: There are no mutable iterators since replacing elements must go
+  // through the mutators to keep the lookup indices up to date. Use values()
+  // to edit elements through their pointers.
   const_iterator begin() const noexcept { return mObjects.begin(); }
   const_iterator end() const noexcept { return mObjects.end(); }
-  const_iterator cbegin() noexcept { return mObjects.cbegin(); }
-  const_iterator cend() noexcept { return mObjects.cend(); }
-  iterator begin() noexcept { return mObjects.begin(); }
-  iterator end() noexcept { return mObjects.end(); }
+  const_iterator cbegin() const noexcept { return mObjects.cbegin(); }
+  const_iterator cend() const noexcept { return mObjects.cend(); }
 
   // General Methods
   int loadFromSExpression(const SExpression& node) {
@@ -443,11 +455,13 @@ public:
 
 protected:  // Methods
   void insertElement(int index, const std::shared_ptr<T>& obj) noexcept {
+    invalidateIndices(index);
     mObjects.insert(index, obj);
     obj->onEdited.attach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementAdded);
   }
   std::shared_ptr<T> takeElement(int index) noexcept {
+    invalidateIndices(index);
     std::shared_ptr<T> obj = mObjects.takeAt(index);
     obj->onEdited.detach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementRemoved);
@@ -456,6 +470,11 @@ protected:  // Methods
   void elementEditedHandler(const T& obj, OnEditedArgs... args) noexcept {
     int index = indexOf(&obj);
     if (contains(index)) {
+      {
+        QMutexLocker lock(&mIndexMutex);
+        mUuidIndex.markEdited(index);
+        mNameIndex.markEdited(index);
+      }
       onElementEdited.notify(index, at(index), args...);
       onEdited.notify(index, at(index), Event::ElementEdited);
     } else {
@@ -481,7 +500,80 @@ protected:  // Methods
             .arg(name));
   }
 
+private:  // Types
+  /**
+   * @brief Hash index to find elements by key (UUID or name)
+   *
+   * Only the first `keys.count()` elements are indexed. Elements appended to
+   * the list are indexed lazily on the next lookup, while inserting or
+   * removing elements only drops the index of all following elements.
+   * Since elements may change their key when they are edited, edited elements
+   * are remembered and their key is checked on the next lookup.
+   */
+  template <typename K>
+  struct Index {
+    QHash<K, int> indices;  ///< Key -> index of the first element with this key
+    QVector<K> keys;  ///< Keys of the indexed elements
+    QSet<int> edited;  ///< Indexed elements which may have a different key
+
+    void truncate(int count) noexcept {
+      while (keys.count() > count) {
+        auto it = indices.find(keys.last());
+        if ((it != indices.end()) && (it.value() == keys.count() - 1)) {
+          indices.erase(it);
+        }
+        keys.removeLast();
+      }
+      for (auto it = edited.begin(); it != edited.end();) {
+        if (*it >= count) {
+          it = edited.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    void markEdited(int index) noexcept {
+      if (index < keys.count()) {
+        edited.insert(index);
+      }
+    }
+  };
+
 private:  // Internal Helper Methods
+  template <typename K, typename F>
+  int lookup(Index<K>& index, const K& key, F getKey) const noexcept {
+    QMutexLocker lock(&mIndexMutex);
+    if (!index.edited.isEmpty()) {
+      int firstChanged = index.keys.count();
+      foreach (int i, index.edited) {
+        if ((i < firstChanged) && (getKey(*mObjects.at(i)) != index.keys[i])) {
+          firstChanged = i;
+        }
+      }
+      index.edited.clear();
+      index.truncate(firstChanged);
+    }
+    for (int i = index.keys.count(); i < mObjects.count(); ++i) {
+      const K objKey = getKey(*mObjects.at(i));
+      if (!index.indices.contains(objKey)) {
+        index.indices.insert(objKey, i);
+      }
+      index.keys.append(objKey);
+    }
+    return index.indices.value(key, -1);
+  }
+  void invalidateIndices(int index) noexcept {
+    QMutexLocker lock(&mIndexMutex);
+    mUuidIndex.truncate(index);
+    mNameIndex.truncate(index);
+  }
+  static const QString& nameToString(const QString& name) noexcept {
+    return name;
+  }
+  template <typename N>
+  static const QString& nameToString(const N& name) noexcept {
+    return *name;  // constrained types like ::librepcb::ElementName
+  }
   std::shared_ptr<T> copyObject(const T& other,
                                 std::true_type copyConstructable) noexcept {
     Q_UNUSED(copyConstructable);
@@ -496,6 +588,16 @@ private:  // Internal Helper Methods
 protected:  // Data
   QVector<std::shared_ptr<T>> mObjects;
   Slot<T, OnEditedArgs...> mOnEditedSlot;
+
+private:  // Data
+  /// Lists with less elements are searched linearly, without hash index
+  static constexpr int sMinIndexedCount = 16;
+
+  // Note: The indices are updated in const methods which might be called
+  // from multiple threads, thus they need to be protected by a mutex.
+  mutable QMutex mIndexMutex;
+  mutable Index<Uuid> mUuidIndex;
+  mutable Index<QString> mNameIndex;
 };
 
 }  // namespace librepcb
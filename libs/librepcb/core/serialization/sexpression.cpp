@@ -286,19 +286,17 @@ SExpression& SExpression::operator=(const SExpression& rhs) noexcept {
  ******************************************************************************/
 
 QString SExpression::escapeString(const QString& string) noexcept {
-  static QHash<QChar, QString> replacements;
-  if (replacements.isEmpty()) {
-    replacements = {
-        {'"', "\\\""},  // Double quote *must* be escaped
-        {'\\', "\\\\"},  // Backslash *must* be escaped
-        {'\b', "\\b"},  // Escape backspace to increase readability
-        {'\f', "\\f"},  // Escape form feed to increase readability
-        {'\n', "\\n"},  // Escape line feed to increase readability
-        {'\r', "\\r"},  // Escape carriage return to increase readability
-        {'\t', "\\t"},  // Escape horizontal tab to increase readability
-        {'\v', "\\v"},  // Escape vertical tab to increase readability
-    };
-  }
+  // Initialized thread-safe since it is used by concurrent save operations.
+  static const QHash<QChar, QString> replacements = {
+      {'"', "\\\""},  // Double quote *must* be escaped
+      {'\\', "\\\\"},  // Backslash *must* be escaped
+      {'\b', "\\b"},  // Escape backspace to increase readability
+      {'\f', "\\f"},  // Escape form feed to increase readability
+      {'\n', "\\n"},  // Escape line feed to increase readability
+      {'\r', "\\r"},  // Escape carriage return to increase readability
+      {'\t', "\\t"},  // Escape horizontal tab to increase readability
+      {'\v', "\\v"},  // Escape vertical tab to increase readability
+  };
 
   QString escaped;
   escaped.reserve(string.length() + (string.length() / 10));
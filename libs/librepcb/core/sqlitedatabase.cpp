@@ -93,7 +93,12 @@ SQLiteDatabase::SQLiteDatabase(const FilePath& filepath, QObject* parent)
 }
 
 SQLiteDatabase::~SQLiteDatabase() noexcept {
+  // Remove the connection to avoid accumulating them, since databases are
+  // opened frequently (e.g. for each asynchronous library query).
+  const QString connectionName = mDb.connectionName();
   mDb.close();
+  mDb = QSqlDatabase();  // Release the last reference before removing it.
+  QSqlDatabase::removeDatabase(connectionName);
 }
 
 /*******************************************************************************
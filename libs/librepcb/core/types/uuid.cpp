@@ -25,7 +25,6 @@
 #include "../exceptions.h"
 #include "../serialization/sexpression.h"
 
-#include <QRegularExpressionValidator>
 #include <QtCore>
 
 /*******************************************************************************
@@ -38,69 +37,16 @@ namespace librepcb {
  ******************************************************************************/
 
 bool Uuid::isValid(const QString& str) noexcept {
-  // Note: This used to be done using a RegEx, but when profiling and
-  // optimizing the library rescan code we found that a manually unrolled
-  // comparison loop performs much better than the previous RegEx.
-  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
-  if (str.length() != 36) return false;
-
-  // Helper function
-  auto isLowerHex = [](const QChar& chr) {
-    return (chr >= QChar('0') && chr <= QChar('9')) ||
-        (chr >= QChar('a') && chr <= QChar('f'));
-  };
-
-  if (!isLowerHex(str[0])) return false;
-  if (!isLowerHex(str[1])) return false;
-  if (!isLowerHex(str[2])) return false;
-  if (!isLowerHex(str[3])) return false;
-  if (!isLowerHex(str[4])) return false;
-  if (!isLowerHex(str[5])) return false;
-  if (!isLowerHex(str[6])) return false;
-  if (!isLowerHex(str[7])) return false;
-  if (str[8] != QChar('-')) return false;
-  if (!isLowerHex(str[9])) return false;
-  if (!isLowerHex(str[10])) return false;
-  if (!isLowerHex(str[11])) return false;
-  if (!isLowerHex(str[12])) return false;
-  if (str[13] != QChar('-')) return false;
-  if (!isLowerHex(str[14])) return false;
-  if (!isLowerHex(str[15])) return false;
-  if (!isLowerHex(str[16])) return false;
-  if (!isLowerHex(str[17])) return false;
-  if (str[18] != QChar('-')) return false;
-  if (!isLowerHex(str[19])) return false;
-  if (!isLowerHex(str[20])) return false;
-  if (!isLowerHex(str[21])) return false;
-  if (!isLowerHex(str[22])) return false;
-  if (str[23] != QChar('-')) return false;
-  if (!isLowerHex(str[24])) return false;
-  if (!isLowerHex(str[25])) return false;
-  if (!isLowerHex(str[26])) return false;
-  if (!isLowerHex(str[27])) return false;
-  if (!isLowerHex(str[28])) return false;
-  if (!isLowerHex(str[29])) return false;
-  if (!isLowerHex(str[30])) return false;
-  if (!isLowerHex(str[31])) return false;
-  if (!isLowerHex(str[32])) return false;
-  if (!isLowerHex(str[33])) return false;
-  if (!isLowerHex(str[34])) return false;
-  if (!isLowerHex(str[35])) return false;
-
-  // check type of uuid
-  QUuid quuid(str);
-  if (quuid.isNull()) return false;
-  if (quuid.variant() != QUuid::DCE) return false;
-  if (quuid.version() != QUuid::Random) return false;
-
-  return true;
+  quint64 high, low;
+  return parse(str, high, low);
 }
 
 Uuid Uuid::createRandom() noexcept {
   QString str =
       QUuid::createUuid().toString().remove("{").remove("}").toLower();
-  if (isValid(str)) {
-    return Uuid(str);
+  quint64 high, low;
+  if (parse(str, high, low)) {
+    return Uuid(high, low);
   } else {
     // Calls abort()!
     qFatal("Not able to generate valid random UUID, terminating application!");
@@ -108,8 +54,9 @@ Uuid Uuid::createRandom() noexcept {
 }
 
 Uuid Uuid::fromString(const QString& str) {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint64 high, low;
+  if (parse(str, high, low)) {
+    return Uuid(high, low);
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        tr("String is not a valid UUID: \"%1\"").arg(str));
@@ -117,13 +64,72 @@ Uuid Uuid::fromString(const QString& str) {
 }
 
 tl::optional<Uuid> Uuid::tryFromString(const QString& str) noexcept {
-  if (isValid(str)) {
-    return Uuid(str);
+  quint64 high, low;
+  if (parse(str, high, low)) {
+    return Uuid(high, low);
   } else {
     return tl::nullopt;
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QString Uuid::toStr() const noexcept {
+  static const char digits[] = "0123456789abcdef";
+  QString str(36, Qt::Uninitialized);
+  QChar* out = str.data();
+  for (int i = 0; i < 32; ++i) {
+    if ((i == 8) || (i == 12) || (i == 16) || (i == 20)) {
+      *out++ = QLatin1Char('-');
+    }
+    const quint64 value = (i < 16) ? mHigh : mLow;
+    const int shift = 60 - 4 * (i % 16);
+    *out++ = QLatin1Char(digits[(value >> shift) & 0xF]);
+  }
+  return str;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool Uuid::parse(const QString& str, quint64& high, quint64& low) noexcept {
+  // Note: This used to be done using a RegEx, but when profiling and
+  // optimizing the library rescan code we found that a manual comparison loop
+  // performs much better than the previous RegEx.
+  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
+  if (str.length() != 36) return false;
+
+  high = 0;
+  low = 0;
+  const QChar* chars = str.constData();
+  for (int i = 0; i < 36; ++i) {
+    const ushort chr = chars[i].unicode();
+    if ((i == 8) || (i == 13) || (i == 18) || (i == 23)) {
+      if (chr != '-') return false;
+      continue;
+    }
+    quint64 nibble;
+    if ((chr >= '0') && (chr <= '9')) {
+      nibble = chr - '0';
+    } else if ((chr >= 'a') && (chr <= 'f')) {
+      nibble = chr - 'a' + 10;
+    } else {
+      return false;  // uppercase characters are not allowed
+    }
+    quint64& value = (i < 18) ? high : low;
+    value = (value << 4) | nibble;
+  }
+
+  // check type of uuid (variant "DCE" and version 4 "random")
+  if (((high >> 12) & 0xF) != 4) return false;
+  if ((low >> 62) != 2) return false;
+
+  return true;
+}
+
 /*******************************************************************************
  *  Non-Member Functions
  ******************************************************************************/
@@ -50,6 +50,10 @@ namespace librepcb {
  * can be created (in opposite to QUuid which allows "Null UUIDs")! If you need
  * a nullable UUID, use tl::optional<librepcb::Uuid> instead.
  *
+ * The UUID is stored as a 128-bit number (not as a string) since it is the
+ * key type of most containers, so copying, comparing and hashing must be
+ * cheap. The ordering is still the same as when comparing the UUID strings.
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  */
@@ -69,7 +73,7 @@ public:
    *
    * @param other     Another ::librepcb::Uuid object
    */
-  Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+  Uuid(const Uuid& other) noexcept = default;
 
   /**
    * @brief Destructor
@@ -83,7 +87,7 @@ public:
    *
    * @return The UUID as a string
    */
-  QString toStr() const noexcept { return mUuid; }
+  QString toStr() const noexcept;
 
   //@{
   /**
@@ -91,18 +95,19 @@ public:
    *
    * @param rhs   The other object to compare
    *
-   * @return Result of comparing the UUIDs as strings
+   * @return Result of comparing the UUIDs (same as comparing them as strings)
    */
-  Uuid& operator=(const Uuid& rhs) noexcept {
-    mUuid = rhs.mUuid;
-    return *this;
+  Uuid& operator=(const Uuid& rhs) noexcept = default;
+  bool operator==(const Uuid& rhs) const noexcept {
+    return (mHigh == rhs.mHigh) && (mLow == rhs.mLow);
+  }
+  bool operator!=(const Uuid& rhs) const noexcept { return !(*this == rhs); }
+  bool operator<(const Uuid& rhs) const noexcept {
+    return (mHigh < rhs.mHigh) || ((mHigh == rhs.mHigh) && (mLow < rhs.mLow));
   }
-  bool operator==(const Uuid& rhs) const noexcept { return mUuid == rhs.mUuid; }
-  bool operator!=(const Uuid& rhs) const noexcept { return mUuid != rhs.mUuid; }
-  bool operator<(const Uuid& rhs) const noexcept { return mUuid < rhs.mUuid; }
-  bool operator>(const Uuid& rhs) const noexcept { return mUuid > rhs.mUuid; }
-  bool operator<=(const Uuid& rhs) const noexcept { return mUuid <= rhs.mUuid; }
-  bool operator>=(const Uuid& rhs) const noexcept { return mUuid >= rhs.mUuid; }
+  bool operator>(const Uuid& rhs) const noexcept { return rhs < *this; }
+  bool operator<=(const Uuid& rhs) const noexcept { return !(rhs < *this); }
+  bool operator>=(const Uuid& rhs) const noexcept { return !(*this < rhs); }
   //@}
 
   // Static Methods
@@ -148,14 +153,29 @@ public:
 
 private:  // Methods
   /**
-   * @brief Constructor which creates a Uuid object from a string
+   * @brief Constructor which creates a Uuid object from its numeric value
    *
-   * @param str       The uuid as a string (lowercase and without braces)
+   * @param high      The first 64 bits (first 16 hex digits)
+   * @param low       The last 64 bits (last 16 hex digits)
    */
-  explicit Uuid(const QString& str) noexcept : mUuid(str) {}
+  Uuid(quint64 high, quint64 low) noexcept : mHigh(high), mLow(low) {}
+
+  /**
+   * @brief Parse and validate a UUID string
+   *
+   * @param str       The string to parse
+   * @param high      The first 64 bits will be written into this variable
+   * @param low       The last 64 bits will be written into this variable
+   *
+   * @return Whether str is a valid UUID or not
+   */
+  static bool parse(const QString& str, quint64& high, quint64& low) noexcept;
+
+  friend uint qHash(const Uuid& key, uint seed) noexcept;
 
 private:  // Data
-  QString mUuid;  ///< Guaranteed to always contain a valid UUID
+  quint64 mHigh;  ///< First 64 bits of a valid UUID
+  quint64 mLow;  ///< Last 64 bits of a valid UUID
 };
 
 /*******************************************************************************
@@ -173,14 +193,16 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-  return ::qHash(key.toStr(), seed);
+  return ::qHash(key.mHigh, ::qHash(key.mLow, seed));
 }
 
 }  // namespace librepcb
 
+Q_DECLARE_TYPEINFO(librepcb::Uuid, Q_MOVABLE_TYPE);
+
 namespace tl {
 inline uint qHash(const optional<librepcb::Uuid>& key, uint seed) noexcept {
-  return ::qHash(key ? key->toStr() : QString(), seed);
+  return key ? librepcb::qHash(*key, seed) : ::qHash(QString(), seed);
 }
 }  // namespace tl
 
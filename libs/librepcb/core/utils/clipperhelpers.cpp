@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "clipperhelpers.h"
 
+#include "toolbox.h"
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -350,9 +352,17 @@ ClipperLib::Paths ClipperHelpers::convert(
 
 ClipperLib::Path ClipperHelpers::convert(
     const Path& path, const PositiveLength& maxArcTolerance) noexcept {
+  const QVector<Vertex>& vertices = path.getVertices();
   ClipperLib::Path p;
-  foreach (const Vertex& v, path.flattenedArcs(maxArcTolerance).getVertices()) {
-    p.push_back(convert(v.getPos()));
+  p.reserve(vertices.count());
+  for (int i = 0; i < vertices.count(); ++i) {
+    const Vertex& v = vertices.at(i);
+    if ((i < (vertices.count() - 1)) && (v.getAngle() != Angle::deg0())) {
+      flattenArc(p, v.getPos(), vertices.at(i + 1).getPos(), v.getAngle(),
+                 maxArcTolerance);
+    } else {
+      p.push_back(convert(v.getPos()));
+    }
   }
   // make sure all paths have the same orientation, otherwise we get strange
   // results
@@ -366,6 +376,140 @@ ClipperLib::IntPoint ClipperHelpers::convert(const Point& point) noexcept {
   return ClipperLib::IntPoint(point.getX().toNm(), point.getY().toNm());
 }
 
+/*******************************************************************************
+ *  Batch Conversion Methods
+ ******************************************************************************/
+
+void ClipperHelpers::flattenArc(
+    ClipperLib::Path& out, const Point& p1, const Point& p2,
+    const Angle& angle, const PositiveLength& maxArcTolerance) noexcept {
+  out.push_back(convert(p1));
+
+  // Straight line if radius is smaller than half of the allowed tolerance.
+  const Length radiusAbs = Toolbox::arcRadius(p1, p2, angle).abs();
+  if (radiusAbs <= maxArcTolerance / 2) {
+    return;
+  }
+
+  // Calculate how many lines we need to create.
+  const qreal radiusAbsNm = static_cast<qreal>(radiusAbs.toNm());
+  const qreal y =
+      qBound(qreal(0.0), static_cast<qreal>(maxArcTolerance->toNm()),
+             radiusAbsNm / qreal(4));
+  const qreal stepsPerRad =
+      qMin(qreal(0.5) / qAcos(1 - y / radiusAbsNm), radiusAbsNm / qreal(2));
+  const int steps = qCeil(stepsPerRad * angle.abs().toRad());
+
+  // Rotate the start point around the center. The arithmetic is exactly the
+  // same as in Point::rotate() to get identical results, but the per-arc
+  // constants are calculated only once and no temporary objects are needed.
+  const qreal angleDelta = angle.toMicroDeg() / (qreal)steps;
+  const Point center = Toolbox::arcCenter(p1, p2, angle);
+  const LengthBase_t cx = center.getX().toNm();
+  const LengthBase_t cy = center.getY().toNm();
+  const LengthBase_t dx = p1.getX().toNm() - cx;
+  const LengthBase_t dy = p1.getY().toNm() - cy;
+  const qreal cxMm = Length(cx).toMm();
+  const qreal cyMm = Length(cy).toMm();
+  const qreal dxMm = Length(dx).toMm();
+  const qreal dyMm = Length(dy).toMm();
+  out.reserve(out.size() + steps);
+  for (int i = 1; i < steps; ++i) {
+    const qint32 microDeg = static_cast<qint32>(angleDelta * i) % 360000000;
+    switch ((microDeg < 0) ? (microDeg + 360000000) : microDeg) {
+      case 0:
+        out.push_back(ClipperLib::IntPoint(cx + dx, cy + dy));
+        break;
+      case 90000000:
+        out.push_back(ClipperLib::IntPoint(cx - dy, cy + dx));
+        break;
+      case 180000000:
+        out.push_back(ClipperLib::IntPoint(cx - dx, cy - dy));
+        break;
+      case 270000000:
+        out.push_back(ClipperLib::IntPoint(cx + dy, cy - dx));
+        break;
+      default: {
+        const qreal rad = Angle(microDeg).toRad();
+        const qreal sin = qSin(rad);
+        const qreal cos = qCos(rad);
+        const qreal xMm = cxMm + cos * dxMm - sin * dyMm;
+        const qreal yMm = cyMm + sin * dxMm + cos * dyMm;
+        out.push_back(
+            ClipperLib::IntPoint(qRound64(xMm * 1e6), qRound64(yMm * 1e6)));
+        break;
+      }
+    }
+  }
+}
+
+ClipperLib::Path ClipperHelpers::convertObround(
+    const Point& p1, const Point& p2, const PositiveLength& width,
+    const PositiveLength& maxArcTolerance) noexcept {
+  // Same vertices as Path::obround(), but without building a Path.
+  const Point diff = p2 - p1;
+  const Angle rotation =
+      Angle::fromRad(qAtan2(diff.getY().toMm(), diff.getX().toMm()));
+  const Point offset = (p1 + p2) / 2;
+  auto map = [&rotation, &offset](const Length& x, const Length& y) {
+    return Point(x, y).rotated(rotation) + offset;
+  };
+  const PositiveLength totalWidth = diff.getLength() + width;
+  const Length rx = totalWidth / 2;
+  const Length ry = width / 2;
+
+  ClipperLib::Path p;
+  if (totalWidth > width) {
+    const Point topLeft = map(ry - rx, ry);
+    const Point bottomRight = map(rx - ry, -ry);
+    p.push_back(convert(topLeft));
+    flattenArc(p, map(rx - ry, ry), bottomRight, -Angle::deg180(),
+               maxArcTolerance);
+    p.push_back(convert(bottomRight));
+    flattenArc(p, map(ry - rx, -ry), topLeft, -Angle::deg180(),
+               maxArcTolerance);
+    p.push_back(convert(topLeft));
+  } else {
+    const Point right = map(rx, 0);
+    const Point left = map(-rx, 0);
+    flattenArc(p, right, left, -Angle::deg180(), maxArcTolerance);
+    flattenArc(p, left, right, -Angle::deg180(), maxArcTolerance);
+    p.push_back(convert(right));
+  }
+  if (!ClipperLib::Orientation(p)) {
+    ClipperLib::ReversePath(p);
+  }
+  return p;
+}
+
+ClipperLib::Paths ClipperHelpers::convertOutlineStrokes(
+    const Path& path, const PositiveLength& width,
+    const PositiveLength& maxArcTolerance) noexcept {
+  // Same result as converting Path::toOutlineStrokes(), but without building
+  // the intermediate paths for straight segments (the most common case).
+  const QVector<Vertex>& vertices = path.getVertices();
+  ClipperLib::Paths paths;
+  if (vertices.count() == 1) {
+    const Point& pos = vertices.first().getPos();
+    paths.push_back(convertObround(pos, pos, width, maxArcTolerance));
+  } else if (vertices.count() > 1) {
+    paths.reserve(vertices.count() - 1);
+    for (int i = 1; i < vertices.count(); ++i) {  // skip first vertex!
+      const Vertex& v = vertices.at(i);
+      const Vertex& v0 = vertices.at(i - 1);
+      if (v0.getAngle() == 0) {
+        paths.push_back(
+            convertObround(v0.getPos(), v.getPos(), width, maxArcTolerance));
+      } else {
+        paths.push_back(convert(
+            Path::arcObround(v0.getPos(), v.getPos(), v0.getAngle(), width),
+            maxArcTolerance));
+      }
+    }
+  }
+  return paths;
+}
+
 /*******************************************************************************
  *  Internal Helper Methods
  ******************************************************************************/
@@ -107,6 +107,31 @@ public:
       const Path& path, const PositiveLength& maxArcTolerance) noexcept;
   static ClipperLib::IntPoint convert(const Point& point) noexcept;
 
+  // Batch Conversions
+
+  /**
+   * @brief Append the flattened points of an arc to a Clipper path
+   *
+   * Same result as ::librepcb::Path::flatArc(), but without creating
+   * intermediate objects. The end point `p2` is *not* appended, thus
+   * consecutive segments can be appended one after another.
+   *
+   * @param out               The path to append the points to.
+   * @param p1                Start point of the arc.
+   * @param p2                End point of the arc.
+   * @param angle             Angle of the arc.
+   * @param maxArcTolerance   Maximum allowed tolerance.
+   */
+  static void flattenArc(ClipperLib::Path& out, const Point& p1,
+                         const Point& p2, const Angle& angle,
+                         const PositiveLength& maxArcTolerance) noexcept;
+  static ClipperLib::Path convertObround(
+      const Point& p1, const Point& p2, const PositiveLength& width,
+      const PositiveLength& maxArcTolerance) noexcept;
+  static ClipperLib::Paths convertOutlineStrokes(
+      const Path& path, const PositiveLength& width,
+      const PositiveLength& maxArcTolerance) noexcept;
+
 private:  // Internal Helper Methods
   static ClipperLib::Path convertHolesToCutIns(const ClipperLib::Path& outline,
                                                const ClipperLib::Paths& holes);
@@ -0,0 +1,172 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "tracer.h"
+
+#include "../fileio/fileutils.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+std::atomic<bool> Tracer::sEnabled(false);
+static thread_local int sThreadId = -1;
+static thread_local int sDepth = 0;
+
+/*******************************************************************************
+ *  Local Functions
+ ******************************************************************************/
+
+struct TracerData {
+  QMutex mutex;
+  QElapsedTimer timer;
+  QVector<Tracer::Event> events;
+  QMap<int, QString> threadNames;
+};
+
+static TracerData& tracerData() noexcept {
+  static TracerData data;
+  return data;
+}
+
+// Note: Must be called with the mutex locked.
+static int currentThreadId(TracerData& data) noexcept {
+  if (sThreadId < 0) {
+    sThreadId = data.threadNames.count();
+    const QCoreApplication* app = QCoreApplication::instance();
+    data.threadNames.insert(
+        sThreadId,
+        (app && (QThread::currentThread() == app->thread()))
+            ? QString("Main Thread")
+            : QString("Worker Thread %1").arg(sThreadId));
+  }
+  return sThreadId;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void Tracer::setEnabled(bool enabled) noexcept {
+  if (enabled) {
+    TracerData& d = tracerData();
+    QMutexLocker lock(&d.mutex);
+    if (!d.timer.isValid()) {
+      d.timer.start();
+    }
+  }
+  sEnabled.store(enabled);
+}
+
+qint64 Tracer::now() noexcept {
+  return tracerData().timer.nsecsElapsed();
+}
+
+int Tracer::enterSpan() noexcept {
+  return sDepth++;
+}
+
+void Tracer::leaveSpan(const char* name, qint64 startNs, int depth) noexcept {
+  const qint64 endNs = now();
+  sDepth = depth;
+  TracerData& d = tracerData();
+  QMutexLocker lock(&d.mutex);
+  d.events.append(Event{name, 'X', currentThreadId(d), depth, startNs,
+                        endNs - startNs, 0});
+}
+
+void Tracer::addCounter(const char* name, qreal value) noexcept {
+  const qint64 timestampNs = now();
+  TracerData& d = tracerData();
+  QMutexLocker lock(&d.mutex);
+  d.events.append(
+      Event{name, 'C', currentThreadId(d), sDepth, timestampNs, 0, value});
+}
+
+QVector<Tracer::Event> Tracer::getEvents() noexcept {
+  TracerData& d = tracerData();
+  QMutexLocker lock(&d.mutex);
+  return d.events;
+}
+
+void Tracer::clear() noexcept {
+  TracerData& d = tracerData();
+  QMutexLocker lock(&d.mutex);
+  d.events.clear();
+}
+
+QByteArray Tracer::toChromeTraceJson() noexcept {
+  QJsonArray array;
+  QSet<int> threadIds;
+  foreach (const Event& event, getEvents()) {
+    QJsonObject obj;
+    obj["name"] = QString(event.name);
+    obj["ph"] = QString(QChar(event.phase));
+    obj["pid"] = 1;
+    obj["tid"] = event.threadId;
+    obj["ts"] = event.timestampNs / 1000.0;  // Microseconds.
+    if (event.phase == 'X') {
+      obj["dur"] = event.durationNs / 1000.0;  // Microseconds.
+      obj["args"] = QJsonObject{{"depth", event.depth}};
+    } else {
+      obj["args"] = QJsonObject{{"value", event.value}};
+    }
+    array.append(obj);
+    threadIds.insert(event.threadId);
+  }
+  QMap<int, QString> threadNames;
+  {
+    TracerData& d = tracerData();
+    QMutexLocker lock(&d.mutex);
+    threadNames = d.threadNames;
+  }
+  foreach (int id, threadIds) {
+    array.append(QJsonObject{
+        {"name", "thread_name"},
+        {"ph", "M"},
+        {"pid", 1},
+        {"tid", id},
+        {"args", QJsonObject{{"name", threadNames.value(id)}}},
+    });
+  }
+  QJsonObject root;
+  root["traceEvents"] = array;
+  root["displayTimeUnit"] = "ms";
+  return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+void Tracer::writeChromeTrace(const FilePath& fp) {
+  FileUtils::writeFile(fp, toChromeTraceJson());  // can throw
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
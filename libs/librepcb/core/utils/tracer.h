@@ -0,0 +1,171 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_CORE_TRACER_H
+#define LIBREPCB_CORE_TRACER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <atomic>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class FilePath;
+
+/*******************************************************************************
+ *  Class Tracer
+ ******************************************************************************/
+
+/**
+ * @brief Collects timing spans and counters of hot paths for profiling
+ *
+ * Tracing is disabled by default. In this state, ::LIBREPCB_TRACE_SCOPE and
+ * ::LIBREPCB_TRACE_COUNTER only cost a relaxed atomic load, so they can be
+ * placed in performance critical code.
+ *
+ * Once enabled with #setEnabled(), all spans and counters are recorded
+ * (thread-safe) and can be exported with #toChromeTraceJson() in the
+ * [Trace Event Format](https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU)
+ * which can be opened with `chrome://tracing` or https://ui.perfetto.dev.
+ *
+ * @note  All event names must be string literals (or have static storage
+ *        duration at least) since only the pointers are stored.
+ */
+class Tracer final {
+public:
+  // Types
+  struct Event {
+    const char* name;
+    char phase;  ///< 'X' for spans, 'C' for counters
+    int threadId;
+    int depth;  ///< Nesting level of spans within the thread
+    qint64 timestampNs;  ///< Relative to the time tracing was enabled
+    qint64 durationNs;  ///< Only valid for spans
+    qreal value;  ///< Only valid for counters
+  };
+
+  // Constructors / Destructor
+  Tracer() = delete;
+  Tracer(const Tracer& other) = delete;
+  ~Tracer() = delete;
+
+  // Operator Overloadings
+  Tracer& operator=(const Tracer& rhs) = delete;
+
+  // Static Methods
+  static bool isEnabled() noexcept {
+    return sEnabled.load(std::memory_order_relaxed);
+  }
+  static void setEnabled(bool enabled) noexcept;
+  static qint64 now() noexcept;
+  static int enterSpan() noexcept;
+  static void leaveSpan(const char* name, qint64 startNs, int depth) noexcept;
+  static void addCounter(const char* name, qreal value) noexcept;
+  static QVector<Event> getEvents() noexcept;
+  static void clear() noexcept;
+  static QByteArray toChromeTraceJson() noexcept;
+
+  /**
+   * @brief Write all recorded events to a file in Chrome trace format
+   *
+   * @param fp  The output file path.
+   *
+   * @throw Exception if the file could not be written.
+   */
+  static void writeChromeTrace(const FilePath& fp);
+
+private:  // Data
+  static std::atomic<bool> sEnabled;
+};
+
+/*******************************************************************************
+ *  Class TraceScope
+ ******************************************************************************/
+
+/**
+ * @brief RAII helper to record a span with the ::librepcb::Tracer
+ *
+ * Use the ::LIBREPCB_TRACE_SCOPE macro instead of using this class directly.
+ */
+class TraceScope final {
+public:
+  TraceScope() = delete;
+  TraceScope(const TraceScope& other) = delete;
+  explicit TraceScope(const char* name) noexcept
+    : mName(Tracer::isEnabled() ? name : nullptr), mStartNs(0), mDepth(0) {
+    if (mName) {
+      mDepth = Tracer::enterSpan();
+      mStartNs = Tracer::now();
+    }
+  }
+  ~TraceScope() noexcept {
+    if (mName) {
+      Tracer::leaveSpan(mName, mStartNs, mDepth);
+    }
+  }
+  TraceScope& operator=(const TraceScope& rhs) = delete;
+
+private:
+  const char* mName;  ///< `nullptr` if tracing is disabled
+  qint64 mStartNs;
+  int mDepth;
+};
+
+/*******************************************************************************
+ *  Macros
+ ******************************************************************************/
+
+#define LIBREPCB_TRACE_CONCAT_IMPL(a, b) a##b
+#define LIBREPCB_TRACE_CONCAT(a, b) LIBREPCB_TRACE_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Record a span from this line until the end of the current scope
+ *
+ * @param name  Span name (string literal), e.g. "BoardGerberExport::export".
+ */
+#define LIBREPCB_TRACE_SCOPE(name)                                   \
+  const ::librepcb::TraceScope LIBREPCB_TRACE_CONCAT(librepcbTrace_, \
+                                                     __LINE__)(name)
+
+/**
+ * @brief Record the current value of a counter
+ *
+ * @param name  Counter name (string literal), e.g. "planes".
+ * @param value Numeric value. Not evaluated if tracing is disabled.
+ */
+#define LIBREPCB_TRACE_COUNTER(name, value)                \
+  do {                                                     \
+    if (::librepcb::Tracer::isEnabled()) {                 \
+      ::librepcb::Tracer::addCounter((name), (value));     \
+    }                                                      \
+  } while (false)
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif
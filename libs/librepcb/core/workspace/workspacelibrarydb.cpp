@@ -63,6 +63,9 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(const FilePath& librariesPath)
         QString("cache_v%1.sqlite").arg(sCurrentDbVersion))) {
   qDebug("Load workspace library database...");
 
+  // Run asynchronous queries sequentially to allow skipping cancelled ones.
+  mQueryThreadPool.setMaxThreadCount(1);
+
   // open SQLite database
   mDb.reset(new SQLiteDatabase(mFilePath));  // can throw
 
@@ -100,7 +103,15 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(const FilePath& librariesPath)
   qDebug("Successfully loaded workspace library database.");
 }
 
+WorkspaceLibraryDb::WorkspaceLibraryDb(const FilePath& librariesPath,
+                                       const FilePath& filePath)
+  : QObject(nullptr), mLibrariesPath(librariesPath), mFilePath(filePath) {
+  mDb.reset(new SQLiteDatabase(mFilePath));  // can throw
+}
+
 WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
+  mQueryThreadPool.clear();  // Don't execute pending queries anymore.
+  mQueryThreadPool.waitForDone();
 }
 
 /*******************************************************************************
@@ -108,7 +119,7 @@ WorkspaceLibraryDb::~WorkspaceLibraryDb() noexcept {
  ******************************************************************************/
 
 int WorkspaceLibraryDb::getScanProgressPercent() const noexcept {
-  return mLibraryScanner->getProgressPercent();
+  return mLibraryScanner ? mLibraryScanner->getProgressPercent() : 100;
 }
 
 template <>
@@ -267,7 +278,16 @@ QList<WorkspaceLibraryDb::Part> WorkspaceLibraryDb::getDeviceParts(
  ******************************************************************************/
 
 void WorkspaceLibraryDb::startLibraryRescan() noexcept {
-  mLibraryScanner->startScan();
+  if (mLibraryScanner) {
+    mLibraryScanner->startScan();
+  }
+}
+
+void WorkspaceLibraryDb::startLibraryElementsRescan(
+    const QSet<FilePath>& elementDirs) noexcept {
+  if (mLibraryScanner) {
+    mLibraryScanner->startScan(elementDirs);
+  }
 }
 
 /*******************************************************************************
@@ -450,6 +470,169 @@ bool WorkspaceLibraryDb::getCategoryMetadata(const QString& categoriesTable,
   return true;
 }
 
+QList<WorkspaceLibraryDb::ElementInfo> WorkspaceLibraryDb::getInfos(
+    const QString& elementsTable, const QStringList& localeOrder,
+    const FilePath& lib, const QSet<Uuid>* uuids) const {
+  const bool isLibrary = (elementsTable == getTable<Library>());
+  const bool isCategory = (elementsTable == getTable<ComponentCategory>()) ||
+      (elementsTable == getTable<PackageCategory>());
+  const bool isDevice = (elementsTable == getTable<Device>());
+  if (lib.isValid() && isLibrary) {
+    throw LogicError(__FILE__, __LINE__,
+                     "Filtering for libraries makes no sense and doesn't work "
+                     "for libraries!");
+  }
+  if (uuids && uuids->isEmpty()) {
+    return QList<ElementInfo>();
+  }
+
+  // Conditions shared by all queries. Note that the UUIDs are not bound as
+  // values since their number could exceed the limit of SQLite, but they
+  // are safe to be embedded anyway since they are validated.
+  QString joins;
+  QStringList conditions;
+  if (lib.isValid()) {
+    joins = "LEFT JOIN libraries ON %elements.library_id = libraries.id ";
+    conditions.append("libraries.filepath = :filepath");
+  }
+  if (uuids) {
+    QStringList values;
+    foreach (const Uuid& uuid, *uuids) {
+      values.append("'" % uuid.toStr() % "'");
+    }
+    conditions.append("%elements.uuid IN (" % values.join(", ") % ")");
+  }
+  const QString where = conditions.isEmpty()
+      ? QString()
+      : QString("WHERE " % conditions.join(" AND ") % " ");
+  const SQLiteDatabase::Replacements replacements = {
+      {"%elements", elementsTable},
+  };
+  auto bindValues = [this, &lib](QSqlQuery& query) {
+    if (lib.isValid()) {
+      query.bindValue(":filepath", lib.toRelative(mLibrariesPath));
+    }
+  };
+
+  SQLiteDatabase::TransactionScopeGuard sg(*mDb);  // Atomic queries!
+
+  // Elements with all their translations (one row per translation).
+  QString columns = "%elements.id, %elements.filepath, %elements.uuid, "
+                    "%elements.version, %elements.deprecated, "
+                    "%elements_tr.locale, %elements_tr.name, "
+                    "%elements_tr.description, %elements_tr.keywords";
+  if (isCategory) {
+    columns += ", %elements.parent_uuid";
+  } else if (isDevice) {
+    columns += ", %elements.component_uuid, %elements.package_uuid";
+  }
+  QSqlQuery query = mDb->prepareQuery(
+      "SELECT " % columns % " FROM %elements " %
+          "LEFT JOIN %elements_tr ON %elements.id = %elements_tr.element_id " %
+          joins % where,
+      replacements);
+  bindValues(query);
+  mDb->exec(query);
+
+  // Using LocalizedDescriptionMap for all values since it allows empty strings
+  // (in contrast to LocalizedNameMap, which is more restrictive).
+  struct Translations {
+    LocalizedDescriptionMap names;
+    LocalizedDescriptionMap descriptions;
+    LocalizedDescriptionMap keywords;
+  };
+  QList<ElementInfo> infos;
+  std::vector<Translations> translations;
+  QHash<int, int> indices;  // Element ID -> index in infos
+  while (query.next()) {
+    const int id = query.value(0).toInt();
+    auto it = indices.find(id);
+    if (it == indices.end()) {
+      const FilePath filePath =
+          FilePath::fromRelative(mLibrariesPath, query.value(1).toString());
+      if (!filePath.isValid()) {
+        throw LogicError(__FILE__, __LINE__);
+      }
+      ElementInfo info{
+          filePath,
+          Uuid::fromString(query.value(2).toString()),  // can throw
+          Version::fromString(query.value(3).toString()),  // can throw
+          query.value(4).toBool(),
+          QString(),
+          QString(),
+          QString(),
+          QSet<Uuid>(),
+          tl::nullopt,
+          tl::nullopt,
+      };
+      if (isCategory) {
+        if (auto parent = Uuid::tryFromString(query.value(9).toString())) {
+          info.categories.insert(*parent);
+        }
+      } else if (isDevice) {
+        info.componentUuid = Uuid::tryFromString(query.value(9).toString());
+        info.packageUuid = Uuid::tryFromString(query.value(10).toString());
+      }
+      it = indices.insert(id, infos.count());
+      infos.append(info);
+      translations.push_back(Translations{LocalizedDescriptionMap(QString{}),
+                                          LocalizedDescriptionMap(QString{}),
+                                          LocalizedDescriptionMap(QString{})});
+    }
+    if (!query.value(5).isNull()) {
+      Translations& t = translations.at(it.value());
+      const QString locale = query.value(5).toString();
+      const QString name = query.value(6).toString();
+      const QString description = query.value(7).toString();
+      const QString keywords = query.value(8).toString();
+      if (!name.isNull()) t.names.insert(locale, name);
+      if (!description.isNull()) t.descriptions.insert(locale, description);
+      if (!keywords.isNull()) t.keywords.insert(locale, keywords);
+    }
+  }
+  for (int i = 0; i < infos.count(); ++i) {
+    infos[i].name = translations.at(i).names.value(localeOrder);
+    infos[i].description = translations.at(i).descriptions.value(localeOrder);
+    infos[i].keywords = translations.at(i).keywords.value(localeOrder);
+  }
+
+  // Categories of elements.
+  if ((!isLibrary) && (!isCategory)) {
+    QSqlQuery catQuery = mDb->prepareQuery(
+        "SELECT %elements_cat.element_id, %elements_cat.category_uuid "
+        "FROM %elements_cat "
+        "INNER JOIN %elements ON %elements.id = %elements_cat.element_id " %
+            joins % where,
+        replacements);
+    bindValues(catQuery);
+    mDb->exec(catQuery);
+    while (catQuery.next()) {
+      auto it = indices.find(catQuery.value(0).toInt());
+      const tl::optional<Uuid> category =
+          Uuid::tryFromString(catQuery.value(1).toString());
+      if ((it != indices.end()) && category) {
+        infos[it.value()].categories.insert(*category);
+      }
+    }
+  }
+
+  return infos;
+}
+
+QHash<Uuid, WorkspaceLibraryDb::ElementInfo> WorkspaceLibraryDb::getLatestInfos(
+    const QList<ElementInfo>& infos) noexcept {
+  QHash<Uuid, ElementInfo> latest;
+  foreach (const ElementInfo& info, infos) {
+    auto it = latest.find(info.uuid);
+    if (it == latest.end()) {
+      latest.insert(info.uuid, info);
+    } else if (info.version > it.value().version) {
+      it.value() = info;
+    }
+  }
+  return latest;
+}
+
 AttributeList WorkspaceLibraryDb::getPartAttributes(int partId) const {
   QSqlQuery query = mDb->prepareQuery(
       "SELECT key, type, value, unit FROM parts_attr "
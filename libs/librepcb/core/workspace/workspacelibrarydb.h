@@ -29,8 +29,11 @@
 #include "../types/uuid.h"
 #include "../types/version.h"
 
+#include <QtConcurrent>
 #include <QtCore>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -101,6 +104,24 @@ public:
     }
   };
 
+  /**
+   * @brief Metadata and translations of a library element
+   *
+   * See #getAllInfos() and #getLatestInfos().
+   */
+  struct ElementInfo {
+    FilePath filePath;
+    Uuid uuid;
+    Version version;
+    bool deprecated;
+    QString name;  ///< Name in the requested locale (empty if not found)
+    QString description;  ///< Description in the requested locale
+    QString keywords;  ///< Keywords in the requested locale
+    QSet<Uuid> categories;  ///< Categories, or parent category of categories
+    tl::optional<Uuid> componentUuid;  ///< Component of devices
+    tl::optional<Uuid> packageUuid;  ///< Package of devices
+  };
+
   // Constructors / Destructor
   WorkspaceLibraryDb() = delete;
   WorkspaceLibraryDb(const WorkspaceLibraryDb& other) = delete;
@@ -263,6 +284,52 @@ public:
                        deprecated);
   }
 
+  /**
+   * @brief Get metadata and translations of all elements
+   *
+   * Same as #getAll() followed by #getMetadata(), #getTranslations(),
+   * #getCategoryMetadata() and #getDeviceMetadata() for each element, but
+   * with a constant number of database queries. Use this to list a lot of
+   * elements.
+   *
+   * @tparam ElementType  Type of the library element.
+   *
+   * @param localeOrder   Locale order (highest priority first).
+   * @param lib           If valid, only elements from this library are
+   *                      returned. Attention: Must not be used when
+   *                      ElementType is Library!
+   *
+   * @return Information about all elements matching the criteria (all
+   *         versions, in no particular order).
+   */
+  template <typename ElementType>
+  QList<ElementInfo> getAllInfos(const QStringList& localeOrder,
+                                 const FilePath& lib = FilePath()) const {
+    return getInfos(getTable<ElementType>(), localeOrder, lib, nullptr);
+  }
+
+  /**
+   * @brief Get metadata and translations of the latest version of elements
+   *
+   * Same as #getLatest() followed by #getMetadata(), #getTranslations(),
+   * #getCategoryMetadata() and #getDeviceMetadata() for each element, but
+   * with a constant number of database queries.
+   *
+   * @tparam ElementType  Type of the library element.
+   *
+   * @param uuids         UUIDs of the elements to get.
+   * @param localeOrder   Locale order (highest priority first).
+   *
+   * @return Information about the element with the highest version number
+   *         for each passed UUID. Elements which don't exist are omitted.
+   */
+  template <typename ElementType>
+  QHash<Uuid, ElementInfo> getLatestInfos(
+      const QSet<Uuid>& uuids, const QStringList& localeOrder) const {
+    return getLatestInfos(
+        getInfos(getTable<ElementType>(), localeOrder, FilePath(), &uuids));
+  }
+
   /**
    * @brief Get additional metadata of a specific library
    *
@@ -390,6 +457,49 @@ public:
    */
   void startLibraryRescan() noexcept;
 
+  /**
+   * @brief Rescan only specific library elements and update the database
+   *
+   * Use this instead of #startLibraryRescan() if it is known exactly which
+   * library elements have been added, modified or removed.
+   *
+   * @param elementDirs   Directories of the changed library elements.
+   */
+  void startLibraryElementsRescan(const QSet<FilePath>& elementDirs) noexcept;
+
+  /**
+   * @brief Run database queries asynchronously in a worker thread
+   *
+   * The passed function is called in a worker thread with a separate
+   * database connection, so the calling thread (usually the GUI thread) is
+   * neither blocked by the queries nor by a running library scan. Queries
+   * are executed one after another in the order they were started.
+   *
+   * @attention The passed function must only call query methods on the
+   *            passed database object, and it must not access any objects
+   *            which live in the calling thread.
+   *
+   * @tparam T    Result type of the function.
+   *
+   * @param fn    Function to run in the worker thread. Exceptions thrown by
+   *              it are rethrown by QFuture::result().
+   *
+   * @return  Future of the function result. If the result is not needed
+   *          anymore (e.g. because the user changed the filter), call
+   *          QFuture::cancel() and just ignore the future. If the query
+   *          did not start yet, it will then not be executed at all.
+   */
+  template <typename T>
+  QFuture<T> runAsync(std::function<T(const WorkspaceLibraryDb&)> fn) const {
+    const FilePath librariesPath = mLibrariesPath;
+    const FilePath filePath = mFilePath;
+    return QtConcurrent::run(&mQueryThreadPool, [librariesPath, filePath,
+                                                 fn]() {
+      const WorkspaceLibraryDb db(librariesPath, filePath);  // can throw
+      return fn(db);  // can throw
+    });
+  }
+
   // Operator Overloadings
   WorkspaceLibraryDb& operator=(const WorkspaceLibraryDb& rhs) = delete;
 
@@ -402,6 +512,14 @@ signals:
   void scanFinished();
 
 private:
+  /**
+   * @brief Constructor to open an additional connection for #runAsync()
+   *
+   * @param librariesPath   Path to the workspace libraries directory.
+   * @param filePath        Path to the existing SQLite database file.
+   */
+  WorkspaceLibraryDb(const FilePath& librariesPath, const FilePath& filePath);
+
   // Private Methods
   QMultiMap<Version, FilePath> getAll(const QString& elementsTable,
                                       const tl::optional<Uuid>& uuid,
@@ -417,6 +535,12 @@ private:
   bool getCategoryMetadata(const QString& categoriesTable,
                            const FilePath catDir,
                            tl::optional<Uuid>* parent) const;
+  QList<ElementInfo> getInfos(const QString& elementsTable,
+                              const QStringList& localeOrder,
+                              const FilePath& lib,
+                              const QSet<Uuid>* uuids) const;
+  static QHash<Uuid, ElementInfo> getLatestInfos(
+      const QList<ElementInfo>& infos) noexcept;
   AttributeList getPartAttributes(int partId) const;
   QSet<Uuid> getChilds(const QString& categoriesTable,
                        const tl::optional<Uuid>& categoryUuid) const;
@@ -434,7 +558,8 @@ private:
   const FilePath mLibrariesPath;  ///< Path to workspace libraries directory.
   const FilePath mFilePath;  ///< Path to the SQLite database file.
   QScopedPointer<SQLiteDatabase> mDb;  ///< The SQLite database.
-  QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+  QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;  ///< Optional.
+  mutable QThreadPool mQueryThreadPool;  ///< Worker for #runAsync().
 
   // Constants
   static const int sCurrentDbVersion = 5;
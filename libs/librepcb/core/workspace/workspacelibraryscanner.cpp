@@ -33,6 +33,7 @@
 #include "../library/sym/symbol.h"
 #include "../sqlitedatabase.h"
 #include "../utils/toolbox.h"
+#include "../utils/tracer.h"
 #include "workspacelibrarydbwriter.h"
 
 #include <QtCore>
@@ -52,6 +53,9 @@ WorkspaceLibraryScanner::WorkspaceLibraryScanner(
     mLibrariesPath(librariesPath),
     mDbFilePath(dbFilePath),
     mSemaphore(0),
+    mMutex(),
+    mFullScanRequested(false),
+    mElementsToScan(),
     mAbort(false),
     mLastProgressPercent(100) {
   connect(
@@ -79,6 +83,15 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept {
  ******************************************************************************/
 
 void WorkspaceLibraryScanner::startScan() noexcept {
+  QMutexLocker lock(&mMutex);
+  mFullScanRequested = true;
+  mSemaphore.release();
+}
+
+void WorkspaceLibraryScanner::startScan(
+    const QSet<FilePath>& elementDirs) noexcept {
+  QMutexLocker lock(&mMutex);
+  mElementsToScan |= elementDirs;
   mSemaphore.release();
 }
 
@@ -93,8 +106,22 @@ void WorkspaceLibraryScanner::run() noexcept {
     mSemaphore.acquire();
     if (mAbort) {
       break;
-    } else {
+    }
+
+    // Take all pending requests at once. A full scan makes any element scans
+    // obsolete.
+    bool fullScan = false;
+    QSet<FilePath> elementDirs;
+    {
+      QMutexLocker lock(&mMutex);
+      mSemaphore.tryAcquire(mSemaphore.available());
+      std::swap(fullScan, mFullScanRequested);
+      elementDirs.swap(mElementsToScan);
+    }
+    if (fullScan) {
       scan();
+    } else if (!elementDirs.isEmpty()) {
+      scanElements(elementDirs);
     }
   }
 
@@ -102,6 +129,7 @@ void WorkspaceLibraryScanner::run() noexcept {
 }
 
 void WorkspaceLibraryScanner::scan() noexcept {
+  LIBREPCB_TRACE_SCOPE("WorkspaceLibraryScanner::scan");
   try {
     QElapsedTimer timer;
     timer.start();
@@ -139,6 +167,7 @@ void WorkspaceLibraryScanner::scan() noexcept {
     int count = 0;
     qreal percent = 1;
     foreach (const std::shared_ptr<Library>& lib, libraries) {
+      LIBREPCB_TRACE_SCOPE("WorkspaceLibraryScanner::scanLibrary");
       FilePath fp = lib->getDirectory().getAbsPath();
       Q_ASSERT(libIds.contains(fp));
       int libId = libIds[fp];
@@ -171,12 +200,18 @@ void WorkspaceLibraryScanner::scan() noexcept {
     // commit transaction
     if ((!mAbort) && (mSemaphore.available() == 0)) {
       transactionGuard.commit();  // can throw
+      LIBREPCB_TRACE_COUNTER("WorkspaceLibraryScanner::elements", count);
       qDebug() << "Workspace library scan succeeded:" << count << "elements in"
                << timer.elapsed() << "ms.";
       emit scanSucceeded(count);
     } else {
       qDebug() << "Workspace library scan aborted after" << timer.elapsed()
                << "ms.";
+      if (!mAbort) {
+        // Aborted due to a new request, make sure the scan is repeated.
+        QMutexLocker lock(&mMutex);
+        mFullScanRequested = true;
+      }
     }
   } catch (const Exception& e) {
     qDebug() << "Workspace library scan failed:" << e.getMsg();
@@ -186,6 +221,69 @@ void WorkspaceLibraryScanner::scan() noexcept {
   emit scanFinished();
 }
 
+void WorkspaceLibraryScanner::scanElements(
+    const QSet<FilePath>& elementDirs) noexcept {
+  LIBREPCB_TRACE_SCOPE("WorkspaceLibraryScanner::scanElements");
+  try {
+    QElapsedTimer timer;
+    timer.start();
+    emit scanStarted();
+    emit scanProgressUpdate(0);
+    qDebug() << "Start scanning" << elementDirs.count()
+             << "workspace library elements in worker thread...";
+
+    // open SQLite database
+    SQLiteDatabase db(mDbFilePath);  // can throw
+    WorkspaceLibraryDbWriter writer(mLibrariesPath, db);
+
+    // update list of libraries since their metadata might have changed too
+    QList<std::shared_ptr<Library>> libraries;
+    getLibrariesOfDirectory("local", libraries);
+    getLibrariesOfDirectory("remote", libraries);
+    const QHash<FilePath, int> libIds =
+        updateLibraries(db, writer, libraries);  // can throw
+    emit scanLibraryListUpdated(libIds.count());
+    emit scanProgressUpdate(1);
+
+    // begin database transaction
+    SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
+
+    // replace the database entries of all passed elements
+    int count = 0;
+    qreal percent = 1;
+    foreach (const FilePath& dir, elementDirs) {
+      if (mAbort) break;
+      int libId = -1;
+      for (auto it = libIds.begin(); it != libIds.end(); ++it) {
+        if (dir.isLocatedInDir(it.key())) {
+          libId = it.value();
+          break;
+        }
+      }
+      count += updateElementInDb<ComponentCategory>(writer, dir, libId);
+      count += updateElementInDb<PackageCategory>(writer, dir, libId);
+      count += updateElementInDb<Symbol>(writer, dir, libId);
+      count += updateElementInDb<Package>(writer, dir, libId);
+      count += updateElementInDb<Component>(writer, dir, libId);
+      count += updateElementInDb<Device>(writer, dir, libId);
+      emit scanProgressUpdate(percent += qreal(98) / elementDirs.count());
+    }
+
+    // commit transaction
+    if (!mAbort) {
+      transactionGuard.commit();  // can throw
+      qDebug() << "Workspace library element scan succeeded:" << count
+               << "elements in" << timer.elapsed() << "ms.";
+      emit scanSucceeded(count);
+    }
+  } catch (const Exception& e) {
+    qDebug() << "Workspace library element scan failed:" << e.getMsg();
+    emit scanFailed(e.getMsg());
+  }
+  emit scanProgressUpdate(100);
+  emit scanFinished();
+}
+
 void WorkspaceLibraryScanner::getLibrariesOfDirectory(
     const QString& root, QList<std::shared_ptr<Library>>& libs) noexcept {
   const FilePath rootFp = mLibrariesPath.getPathTo(root);
@@ -210,6 +308,7 @@ void WorkspaceLibraryScanner::getLibrariesOfDirectory(
 QHash<FilePath, int> WorkspaceLibraryScanner::updateLibraries(
     SQLiteDatabase& db, WorkspaceLibraryDbWriter& writer,
     const QList<std::shared_ptr<Library>>& libs) {
+  LIBREPCB_TRACE_SCOPE("WorkspaceLibraryScanner::updateLibraries");
   SQLiteDatabase::TransactionScopeGuard transactionGuard(db);  // can throw
 
   // get filepaths of all libraries
@@ -287,6 +386,27 @@ int WorkspaceLibraryScanner::addElementsToDb(WorkspaceLibraryDbWriter& writer,
   return count;
 }
 
+template <typename ElementType>
+int WorkspaceLibraryScanner::updateElementInDb(WorkspaceLibraryDbWriter& writer,
+                                               const FilePath& elementDir,
+                                               int libId) {
+  writer.removeElement<ElementType>(elementDir);  // can throw
+  if ((libId >= 0) &&
+      LibraryBaseElement::isValidElementDirectory<ElementType>(elementDir)) {
+    try {
+      std::unique_ptr<ElementType> element =
+          openAndMigrate<ElementType>(elementDir);  // can throw
+      const int id = addElementToDb(writer, libId, *element);
+      addTranslationsToDb(writer, id, *element);
+      return 1;
+    } catch (const Exception& e) {
+      qWarning() << "Failed to open library element during scan:"
+                 << elementDir.toNative();
+    }
+  }
+  return 0;
+}
+
 template <typename ElementType>
 int WorkspaceLibraryScanner::addElementToDb(WorkspaceLibraryDbWriter& writer,
                                             int libId,
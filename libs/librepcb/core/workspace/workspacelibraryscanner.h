@@ -65,6 +65,17 @@ public:
   // General Methods
   void startScan() noexcept;
 
+  /**
+   * @brief Update only specific library elements in the database
+   *
+   * Much faster than a full scan when only a few elements have changed, e.g.
+   * after a delta update of a library. The library list is updated as well.
+   *
+   * @param elementDirs   Directories of all added, modified or removed
+   *                      library elements.
+   */
+  void startScan(const QSet<FilePath>& elementDirs) noexcept;
+
   // Operator Overloadings
   WorkspaceLibraryScanner& operator=(const WorkspaceLibraryScanner& rhs) =
       delete;
@@ -80,6 +91,7 @@ signals:
 private:  // Methods
   void run() noexcept override;
   void scan() noexcept;
+  void scanElements(const QSet<FilePath>& elementDirs) noexcept;
   void getLibrariesOfDirectory(const QString& root,
                                QList<std::shared_ptr<Library>>& libs) noexcept;
 
@@ -90,6 +102,9 @@ private:  // Methods
   int addElementsToDb(WorkspaceLibraryDbWriter& writer, const FilePath& libPath,
                       const QStringList& dirs, int libId);
   template <typename ElementType>
+  int updateElementInDb(WorkspaceLibraryDbWriter& writer,
+                        const FilePath& elementDir, int libId);
+  template <typename ElementType>
   int addElementToDb(WorkspaceLibraryDbWriter& writer, int libId,
                      const ElementType& element);
   template <typename ElementType>
@@ -105,6 +120,9 @@ private:  // Data
   const FilePath mLibrariesPath;  ///< Path to workspace libraries directory.
   const FilePath mDbFilePath;  ///< Path to the SQLite database file.
   QSemaphore mSemaphore;
+  QMutex mMutex;  ///< Protects #mFullScanRequested and #mElementsToScan
+  bool mFullScanRequested;
+  QSet<FilePath> mElementsToScan;
   volatile bool mAbort;
   int mLastProgressPercent;
 };
@@ -36,6 +36,7 @@
 #include <librepcb/core/utils/toolbox.h>
 #include <parseagle/library.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -306,13 +307,318 @@ bool EagleLibraryImport::setElementDependent(T& element,
   return false;
 }
 
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertSymbol(
+    const Symbol& sym) const noexcept {
+  // Note: This method is called from the thread pool, thus it must not
+  //       modify any state of this object!
+  ConversionResult result{sym.symbol->getName(), sym.displayName, false, {},
+                          tl::nullopt, {}, {}};
+  if (mAbort) {
+    return result;
+  }
+  result.processed = true;
+  QStringList& errors = result.errors;
+  try {
+    auto symbol = std::make_shared<librepcb::Symbol>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
+        EagleTypeConverter::convertElementDescription(sym.description),
+        mKeywords);
+    symbol->setCategories(mSymbolCategories);
+    foreach (const auto& obj, convertWires(sym.symbol->getWires(), errors)) {
+      if (obj->getPath().isClosed()) {
+        obj->setIsGrabArea(true);
+      }
+      symbol->getPolygons().append(obj);
+    }
+    foreach (const auto& obj, sym.symbol->getRectangles()) {
+      tryOrAddError(errors, [&]() {
+        symbol->getPolygons().append(
+            EagleTypeConverter::convertRectangle(obj, true));
+      });
+    }
+    foreach (const auto& obj, sym.symbol->getPolygons()) {
+      tryOrAddError(errors, [&]() {
+        symbol->getPolygons().append(
+            EagleTypeConverter::convertPolygon(obj, true));
+      });
+    }
+    foreach (const auto& obj, sym.symbol->getCircles()) {
+      tryOrAddError(errors, [&]() {
+        symbol->getCircles().append(
+            EagleTypeConverter::convertCircle(obj, true));
+      });
+    }
+    foreach (const auto& obj, sym.symbol->getTexts()) {
+      tryOrAddError(errors, [&]() {
+        symbol->getTexts().append(
+            EagleTypeConverter::convertSchematicText(obj));
+      });
+    }
+    foreach (const auto& obj, sym.symbol->getPins()) {
+      tryOrAddError(errors, [&]() {
+        auto pin = EagleTypeConverter::convertSymbolPin(obj);
+        symbol->getPins().append(pin);
+        result.childUuids[obj.getName()] = pin->getUuid();
+      });
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Symbol::getShortElementName())
+            .getPathTo(symbol->getUuid().toStr())));
+    symbol->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = symbol->getUuid();
+  } catch (const Exception& e) {
+    errors.append(tr("Skipped symbol due to error: %1").arg(e.getMsg()));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertPackage(
+    const Package& pkg) const noexcept {
+  // Note: This method is called from the thread pool, thus it must not
+  //       modify any state of this object!
+  ConversionResult result{pkg.package->getName(), pkg.displayName, false, {},
+                          tl::nullopt, {}, {}};
+  if (mAbort) {
+    return result;
+  }
+  result.processed = true;
+  QStringList& errors = result.errors;
+  try {
+    auto package = std::make_shared<librepcb::Package>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
+        EagleTypeConverter::convertElementDescription(pkg.description),
+        mKeywords, librepcb::Package::AssemblyType::Auto);
+    package->setCategories(mPackageCategories);
+    auto footprint = std::make_shared<Footprint>(Uuid::createRandom(),
+                                                 ElementName("default"), "");
+    package->getFootprints().append(footprint);
+    foreach (const auto& obj, convertWires(pkg.package->getWires(), errors)) {
+      footprint->getPolygons().append(obj);
+    }
+    foreach (const auto& obj, pkg.package->getRectangles()) {
+      tryOrAddError(errors, [&]() {
+        footprint->getPolygons().append(
+            EagleTypeConverter::convertRectangle(obj, false));
+      });
+    }
+    foreach (const auto& obj, pkg.package->getPolygons()) {
+      tryOrAddError(errors, [&]() {
+        footprint->getPolygons().append(
+            EagleTypeConverter::convertPolygon(obj, false));
+      });
+    }
+    foreach (const auto& obj, pkg.package->getCircles()) {
+      tryOrAddError(errors, [&]() {
+        footprint->getCircles().append(
+            EagleTypeConverter::convertCircle(obj, false));
+      });
+    }
+    foreach (const auto& obj, pkg.package->getTexts()) {
+      tryOrAddError(errors, [&]() {
+        footprint->getStrokeTexts().append(
+            EagleTypeConverter::convertBoardText(obj));
+      });
+    }
+    foreach (const auto& obj, pkg.package->getHoles()) {
+      tryOrAddError(errors, [&]() {
+        footprint->getHoles().append(EagleTypeConverter::convertHole(obj));
+      });
+    }
+    foreach (const auto& obj, pkg.package->getThtPads()) {
+      tryOrAddError(errors, [&]() {
+        auto pair = EagleTypeConverter::convertThtPad(obj);
+        package->getPads().append(pair.first);
+        footprint->getPads().append(pair.second);
+        result.childUuids[obj.getName()] = pair.first->getUuid();
+      });
+    }
+    foreach (const auto& obj, pkg.package->getSmtPads()) {
+      tryOrAddError(errors, [&]() {
+        auto pair = EagleTypeConverter::convertSmtPad(obj);
+        package->getPads().append(pair.first);
+        footprint->getPads().append(pair.second);
+        result.childUuids[obj.getName()] = pair.first->getUuid();
+      });
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Package::getShortElementName())
+            .getPathTo(package->getUuid().toStr())));
+    package->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = package->getUuid();
+  } catch (const Exception& e) {
+    errors.append(tr("Skipped package due to error: %1").arg(e.getMsg()));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertComponent(
+    const Component& cmp,
+    const QHash<QString, ConversionResult>& symbols) const noexcept {
+  // Note: This method is called from the thread pool, thus it must not
+  //       modify any state of this object!
+  ConversionResult result{cmp.deviceSet->getName(), cmp.displayName, false,
+                          {}, tl::nullopt, {}, {}};
+  if (mAbort) {
+    return result;
+  }
+  result.processed = true;
+  try {
+    auto component = std::make_shared<librepcb::Component>(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
+        EagleTypeConverter::convertElementDescription(cmp.description),
+        mKeywords);
+    component->setCategories(mComponentCategories);
+    component->setPrefixes(NormDependentPrefixMap(
+        ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
+    component->setDefaultValue("{{ MPN or DEVICE }}");
+    auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
+        Uuid::createRandom(), "", ElementName("default"), "");
+    component->getSymbolVariants().append(symbolVariant);
+    QHash<QString, int> pinCount;
+    foreach (const auto& gate, cmp.deviceSet->getGates()) {
+      const auto pins = symbols.value(gate.getSymbol()).childUuids;
+      for (auto pinIt = pins.constBegin(); pinIt != pins.constEnd(); pinIt++) {
+        pinCount[pinIt.key()]++;
+      }
+    }
+    foreach (const auto& gate, cmp.deviceSet->getGates()) {
+      const ConversionResult symbol = symbols.value(gate.getSymbol());
+      if (!symbol.uuid) {
+        throw RuntimeError(__FILE__, __LINE__,
+                           tr("Dependent symbol \"%1\" not imported.")
+                               .arg(gate.getSymbol()));
+      }
+      auto item = std::make_shared<ComponentSymbolVariantItem>(
+          Uuid::createRandom(), *symbol.uuid,
+          EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0), true,
+          EagleTypeConverter::convertGateName(gate.getName()));
+      symbolVariant->getSymbolItems().append(item);
+      for (auto pinIt = symbol.childUuids.constBegin();
+           pinIt != symbol.childUuids.constEnd(); pinIt++) {
+        Uuid signalUuid = Uuid::createRandom();
+        QString signalName = pinIt.key();
+        if ((pinCount[signalName] > 1) ||
+            (component->getSignals().contains(signalName))) {
+          // Name conflict -> add prefix to ensure unique signal names.
+          signalName.prepend(*item->getSuffix() % "_");
+        }
+        component->getSignals().append(std::make_shared<ComponentSignal>(
+            signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
+            SignalRole::passive(), QString(), false, false, false));
+        item->getPinSignalMap().append(
+            std::make_shared<ComponentPinSignalMapItem>(
+                pinIt->value(), signalUuid,
+                CmpSigPinDisplayType::componentSignal()));
+        result.signalUuids[gate.getName()][pinIt.key()] = signalUuid;
+      }
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Component::getShortElementName())
+            .getPathTo(component->getUuid().toStr())));
+    component->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = component->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(
+        tr("Skipped component due to error: %1").arg(e.getMsg()));
+  }
+  return result;
+}
+
+EagleLibraryImport::ConversionResult EagleLibraryImport::convertDevice(
+    const Device& dev, const QHash<QString, ConversionResult>& packages,
+    const QHash<QString, ConversionResult>& components) const noexcept {
+  // Note: This method is called from the thread pool, thus it must not
+  //       modify any state of this object!
+  ConversionResult result{dev.displayName, dev.displayName, false, {},
+                          tl::nullopt, {}, {}};
+  if (mAbort) {
+    return result;
+  }
+  result.processed = true;
+  try {
+    const ConversionResult component =
+        components.value(dev.deviceSet->getName());
+    if (!component.uuid) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Dependent component \"%1\" not imported.")
+                             .arg(dev.componentDisplayName));
+    }
+    const ConversionResult package = packages.value(dev.device->getPackage());
+    if (!package.uuid) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Dependent package \"%1\" not imported.")
+                             .arg(dev.packageDisplayName));
+    }
+    std::unique_ptr<librepcb::Device> device(new librepcb::Device(
+        Uuid::createRandom(), mVersion, mAuthor,
+        EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
+        EagleTypeConverter::convertElementDescription(dev.description),
+        mKeywords, *component.uuid, *package.uuid));
+    device->setCategories(mDeviceCategories);
+    for (auto padIt = package.childUuids.constBegin();
+         padIt != package.childUuids.constEnd(); padIt++) {
+      tl::optional<Uuid> signalUuid;
+      foreach (const auto& connection, dev.device->getConnections()) {
+        if (connection.getPads().contains(padIt.key())) {
+          signalUuid = component.signalUuids.value(connection.getGate())
+                           .value(connection.getPin());
+        }
+      }
+      device->getPadSignalMap().append(
+          std::make_shared<DevicePadSignalMapItem>(padIt->value(),
+                                                   signalUuid));
+    }
+    TransactionalDirectory dir(TransactionalFileSystem::openRW(
+        mDestinationLibraryFp
+            .getPathTo(librepcb::Device::getShortElementName())
+            .getPathTo(device->getUuid().toStr())));
+    device->saveTo(dir);
+    dir.getFileSystem()->save();
+    result.uuid = device->getUuid();
+  } catch (const Exception& e) {
+    result.errors.append(
+        tr("Skipped device due to error: %1").arg(e.getMsg()));
+  }
+  return result;
+}
+
+void EagleLibraryImport::collectResults(
+    const QVector<QFuture<ConversionResult> >& futures,
+    QHash<QString, ConversionResult>& results, int& count,
+    int totalCount) noexcept {
+  // Wait for the results in the order of the elements to report progress and
+  // errors deterministically, no matter which task finishes first.
+  foreach (const QFuture<ConversionResult>& future, futures) {
+    const ConversionResult result = future.result();
+    if (!result.processed) {
+      continue;
+    }
+    emit progressStatus(result.displayName);
+    foreach (const QString& error, result.errors) {
+      raiseImportError(result.displayName, error);
+    }
+    results.insert(result.name, result);
+    ++count;
+    emit progressPercent((100 * count) / std::max(totalCount, 1));
+  }
+}
+
 QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
-    const QString& element, const QList<parseagle::Wire>& wires) {
+    const QList<parseagle::Wire>& wires, QStringList& errors) {
   QMap<std::pair<const Layer*, UnsignedLength>,
        QVector<std::shared_ptr<Polygon> > >
       joinablePolygons;
   foreach (const parseagle::Wire& wire, wires) {
-    tryOrRaiseError(element, [&joinablePolygons, &wire]() {
+    tryOrAddError(errors, [&joinablePolygons, &wire]() {
       auto polygon = EagleTypeConverter::convertWire(wire);
       auto key = std::make_pair(&polygon->getLayer(), polygon->getLineWidth());
       joinablePolygons[key].append(polygon);
@@ -335,12 +641,12 @@ QVector<std::shared_ptr<Polygon> > EagleLibraryImport::convertWires(
   return polygons;
 }
 
-void EagleLibraryImport::tryOrRaiseError(const QString& element,
-                                         std::function<void()> func) {
+void EagleLibraryImport::tryOrAddError(QStringList& errors,
+                                       std::function<void()> func) {
   try {
     func();
   } catch (const Exception& e) {
-    raiseImportError(element, e.getMsg());
+    errors.append(e.getMsg());
   }
 }
 
@@ -359,296 +665,52 @@ void EagleLibraryImport::run() noexcept {
   int totalCount = getCheckedElementsCount();
   int count = 0;
 
-  QHash<QString, tl::optional<Uuid> > symbolMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > symbolPinMap;
+  // Symbols and packages don't have any dependencies, so all of them are
+  // converted concurrently.
+  QVector<QFuture<ConversionResult> > symbolFutures;
   foreach (const Symbol& sym, mSymbols) {
-    if (mAbort) {
-      break;
-    }
-    if (sym.checkState == Qt::Unchecked) {
-      continue;
+    if (sym.checkState != Qt::Unchecked) {
+      symbolFutures.append(
+          QtConcurrent::run([this, sym]() { return convertSymbol(sym); }));
     }
-    try {
-      emit progressStatus(sym.displayName);
-      auto symbol = std::make_shared<librepcb::Symbol>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + sym.displayName),
-          EagleTypeConverter::convertElementDescription(sym.description),
-          mKeywords);
-      symbol->setCategories(mSymbolCategories);
-      foreach (const auto& obj,
-               convertWires(sym.displayName, sym.symbol->getWires())) {
-        if (obj->getPath().isClosed()) {
-          obj->setIsGrabArea(true);
-        }
-        symbol->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, sym.symbol->getRectangles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPolygons()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getCircles()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, true));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getTexts()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          symbol->getTexts().append(
-              EagleTypeConverter::convertSchematicText(obj));
-        });
-      }
-      foreach (const auto& obj, sym.symbol->getPins()) {
-        tryOrRaiseError(sym.displayName, [&]() {
-          auto pin = EagleTypeConverter::convertSymbolPin(obj);
-          symbol->getPins().append(pin);
-          symbolPinMap[sym.symbol->getName()][obj.getName()] = pin->getUuid();
-        });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Symbol::getShortElementName())
-              .getPathTo(symbol->getUuid().toStr())));
-      symbol->saveTo(dir);
-      dir.getFileSystem()->save();
-      symbolMap[sym.symbol->getName()] = symbol->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(sym.displayName,
-                       tr("Skipped symbol due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
-
-  QHash<QString, tl::optional<Uuid> > packageMap;
-  QHash<QString, QHash<QString, tl::optional<Uuid> > > packagePadMap;
+  QVector<QFuture<ConversionResult> > packageFutures;
   foreach (const Package& pkg, mPackages) {
-    if (mAbort) {
-      break;
-    }
-    if (pkg.checkState == Qt::Unchecked) {
-      continue;
+    if (pkg.checkState != Qt::Unchecked) {
+      packageFutures.append(
+          QtConcurrent::run([this, pkg]() { return convertPackage(pkg); }));
     }
-    try {
-      emit progressStatus(pkg.displayName);
-      auto package = std::make_shared<librepcb::Package>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + pkg.displayName),
-          EagleTypeConverter::convertElementDescription(pkg.description),
-          mKeywords, librepcb::Package::AssemblyType::Auto);
-      package->setCategories(mPackageCategories);
-      auto footprint = std::make_shared<Footprint>(Uuid::createRandom(),
-                                                   ElementName("default"), "");
-      package->getFootprints().append(footprint);
-      foreach (const auto& obj,
-               convertWires(pkg.displayName, pkg.package->getWires())) {
-        footprint->getPolygons().append(obj);
-      }
-      foreach (const auto& obj, pkg.package->getRectangles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertRectangle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getPolygons()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getPolygons().append(
-              EagleTypeConverter::convertPolygon(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getCircles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getCircles().append(
-              EagleTypeConverter::convertCircle(obj, false));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getTexts()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getStrokeTexts().append(
-              EagleTypeConverter::convertBoardText(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getHoles()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          footprint->getHoles().append(EagleTypeConverter::convertHole(obj));
-        });
-      }
-      foreach (const auto& obj, pkg.package->getThtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertThtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
-        });
-      }
-      foreach (const auto& obj, pkg.package->getSmtPads()) {
-        tryOrRaiseError(pkg.displayName, [&]() {
-          auto pair = EagleTypeConverter::convertSmtPad(obj);
-          package->getPads().append(pair.first);
-          footprint->getPads().append(pair.second);
-          packagePadMap[pkg.package->getName()][obj.getName()] =
-              pair.first->getUuid();
-        });
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Package::getShortElementName())
-              .getPathTo(package->getUuid().toStr())));
-      package->saveTo(dir);
-      dir.getFileSystem()->save();
-      packageMap[pkg.package->getName()] = package->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(pkg.displayName,
-                       tr("Skipped package due to error: %1").arg(e.getMsg()));
-    }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
+  QHash<QString, ConversionResult> symbols;
+  collectResults(symbolFutures, symbols, count, totalCount);
 
-  QHash<QString, tl::optional<Uuid> > componentMap;
-  QHash<QString, QHash<QString, QHash<QString, tl::optional<Uuid> > > >
-      componentSignalMap;
+  // Components only depend on symbols, so start converting them while the
+  // packages are still being converted.
+  QVector<QFuture<ConversionResult> > componentFutures;
   foreach (const Component& cmp, mComponents) {
-    if (mAbort) {
-      break;
-    }
-    if (cmp.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(cmp.displayName);
-      auto component = std::make_shared<librepcb::Component>(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + cmp.displayName),
-          EagleTypeConverter::convertElementDescription(cmp.description),
-          mKeywords);
-      component->setCategories(mComponentCategories);
-      component->setPrefixes(NormDependentPrefixMap(
-          ComponentPrefix(cmp.deviceSet->getPrefix().trimmed())));
-      component->setDefaultValue("{{ MPN or DEVICE }}");
-      auto symbolVariant = std::make_shared<ComponentSymbolVariant>(
-          Uuid::createRandom(), "", ElementName("default"), "");
-      component->getSymbolVariants().append(symbolVariant);
-      QHash<QString, int> pinCount;
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          pinCount[pinIt.key()]++;
-        }
-      }
-      foreach (const auto& gate, cmp.deviceSet->getGates()) {
-        tl::optional<Uuid> symbolUuid = symbolMap[gate.getSymbol()];
-        if (!symbolUuid) {
-          throw RuntimeError(__FILE__, __LINE__,
-                             tr("Dependent symbol \"%1\" not imported.")
-                                 .arg(gate.getSymbol()));
-        }
-        auto item = std::make_shared<ComponentSymbolVariantItem>(
-            Uuid::createRandom(), *symbolUuid,
-            EagleTypeConverter::convertPoint(gate.getPosition()), Angle(0),
-            true, EagleTypeConverter::convertGateName(gate.getName()));
-        symbolVariant->getSymbolItems().append(item);
-        for (auto pinIt = symbolPinMap[gate.getSymbol()].constBegin();
-             pinIt != symbolPinMap[gate.getSymbol()].constEnd(); pinIt++) {
-          Uuid signalUuid = Uuid::createRandom();
-          QString signalName = pinIt.key();
-          if ((pinCount[signalName] > 1) ||
-              (component->getSignals().contains(signalName))) {
-            // Name conflict -> add prefix to ensure unique signal names.
-            signalName.prepend(*item->getSuffix() % "_");
-          }
-          component->getSignals().append(std::make_shared<ComponentSignal>(
-              signalUuid, EagleTypeConverter::convertPinOrPadName(signalName),
-              SignalRole::passive(), QString(), false, false, false));
-          item->getPinSignalMap().append(
-              std::make_shared<ComponentPinSignalMapItem>(
-                  pinIt->value(), signalUuid,
-                  CmpSigPinDisplayType::componentSignal()));
-          componentSignalMap[cmp.deviceSet->getName()][gate.getName()]
-                            [pinIt.key()] = signalUuid;
-        }
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Component::getShortElementName())
-              .getPathTo(component->getUuid().toStr())));
-      component->saveTo(dir);
-      dir.getFileSystem()->save();
-      componentMap[cmp.deviceSet->getName()] = component->getUuid();
-    } catch (const Exception& e) {
-      raiseImportError(
-          cmp.displayName,
-          tr("Skipped component due to error: %1").arg(e.getMsg()));
+    if ((cmp.checkState != Qt::Unchecked) && (!mAbort)) {
+      componentFutures.append(QtConcurrent::run([this, cmp, &symbols]() {
+        return convertComponent(cmp, symbols);
+      }));
     }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
+  QHash<QString, ConversionResult> packages;
+  collectResults(packageFutures, packages, count, totalCount);
+  QHash<QString, ConversionResult> components;
+  collectResults(componentFutures, components, count, totalCount);
 
+  // Devices depend on components and packages.
+  QVector<QFuture<ConversionResult> > deviceFutures;
   foreach (const Device& dev, mDevices) {
-    if (mAbort) {
-      break;
-    }
-    if (dev.checkState == Qt::Unchecked) {
-      continue;
-    }
-    try {
-      emit progressStatus(dev.displayName);
-      tl::optional<Uuid> componentUuid = componentMap[dev.deviceSet->getName()];
-      if (!componentUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent component \"%1\" not imported.")
-                               .arg(dev.componentDisplayName));
-      }
-      tl::optional<Uuid> packageUuid = packageMap[dev.device->getPackage()];
-      if (!packageUuid) {
-        throw RuntimeError(__FILE__, __LINE__,
-                           tr("Dependent package \"%1\" not imported.")
-                               .arg(dev.packageDisplayName));
-      }
-      std::unique_ptr<librepcb::Device> device(new librepcb::Device(
-          Uuid::createRandom(), mVersion, mAuthor,
-          EagleTypeConverter::convertElementName(mNamePrefix + dev.displayName),
-          EagleTypeConverter::convertElementDescription(dev.description),
-          mKeywords, *componentUuid, *packageUuid));
-      device->setCategories(mDeviceCategories);
-      for (auto padIt = packagePadMap[dev.device->getPackage()].constBegin();
-           padIt != packagePadMap[dev.device->getPackage()].constEnd();
-           padIt++) {
-        tl::optional<Uuid> signalUuid;
-        foreach (const auto& connection, dev.device->getConnections()) {
-          if (connection.getPads().contains(padIt.key())) {
-            signalUuid =
-                componentSignalMap[dev.deviceSet->getName()]
-                                  [connection.getGate()][connection.getPin()];
-          }
-        }
-        device->getPadSignalMap().append(
-            std::make_shared<DevicePadSignalMapItem>(padIt->value(),
-                                                     signalUuid));
-      }
-      TransactionalDirectory dir(TransactionalFileSystem::openRW(
-          mDestinationLibraryFp
-              .getPathTo(librepcb::Device::getShortElementName())
-              .getPathTo(device->getUuid().toStr())));
-      device->saveTo(dir);
-      dir.getFileSystem()->save();
-    } catch (const Exception& e) {
-      raiseImportError(dev.displayName,
-                       tr("Skipped device due to error: %1").arg(e.getMsg()));
+    if ((dev.checkState != Qt::Unchecked) && (!mAbort)) {
+      deviceFutures.append(
+          QtConcurrent::run([this, dev, &packages, &components]() {
+            return convertDevice(dev, packages, components);
+          }));
     }
-    ++count;
-    emit progressPercent((100 * count) / std::max(totalCount, 1));
   }
+  QHash<QString, ConversionResult> devices;
+  collectResults(deviceFutures, devices, count, totalCount);
 
   emit progressPercent(100);
   emit progressStatus(tr("Finished: %1 of %2 element(s) imported",
@@ -26,9 +26,11 @@
 #include <librepcb/core/fileio/filepath.h>
 #include <librepcb/core/types/uuid.h>
 #include <librepcb/core/types/version.h>
+#include <optional/tl/optional.hpp>
 
 #include <QtCore>
 
+#include <atomic>
 #include <memory>
 
 /*******************************************************************************
@@ -54,6 +56,12 @@ namespace eagleimport {
 
 /**
  * @brief EAGLE library (*.lbr) import
+ *
+ * The import (see #run()) converts elements of the same type concurrently in
+ * the global thread pool. Symbols and packages are converted first, then
+ * components (depending on symbols) and finally devices (depending on
+ * components and packages). Results and errors are still reported in the
+ * order of the elements.
  */
 class EagleLibraryImport final : public QThread {
   Q_OBJECT
@@ -91,6 +99,23 @@ public:
     std::shared_ptr<parseagle::DeviceSet> deviceSet;
   };
 
+private:
+  /// Result of converting a single element
+  struct ConversionResult {
+    QString name;  ///< Element name in the EAGLE library
+    QString displayName;
+    bool processed;  ///< False if skipped due to abort
+    QStringList errors;
+    tl::optional<Uuid> uuid;  ///< Only set if the element was imported
+
+    /// Symbols: Pin UUIDs, packages: pad UUIDs (key: EAGLE name)
+    QHash<QString, tl::optional<Uuid> > childUuids;
+
+    /// Components: Signal UUIDs (keys: EAGLE gate name, EAGLE pin name)
+    QHash<QString, QHash<QString, tl::optional<Uuid> > > signalUuids;
+  };
+
+public:
   // Constructors / Destructor
   EagleLibraryImport(const EagleLibraryImport& other) = delete;
   EagleLibraryImport(const FilePath& dstLibFp,
@@ -156,9 +181,20 @@ private:  // Methods
   void updateDependencies() noexcept;
   template <typename T>
   bool setElementDependent(T& element, bool dependent) noexcept;
-  QVector<std::shared_ptr<Polygon> > convertWires(
-      const QString& element, const QList<parseagle::Wire>& wires);
-  void tryOrRaiseError(const QString& element, std::function<void()> func);
+  ConversionResult convertSymbol(const Symbol& sym) const noexcept;
+  ConversionResult convertPackage(const Package& pkg) const noexcept;
+  ConversionResult convertComponent(
+      const Component& cmp,
+      const QHash<QString, ConversionResult>& symbols) const noexcept;
+  ConversionResult convertDevice(
+      const Device& dev, const QHash<QString, ConversionResult>& packages,
+      const QHash<QString, ConversionResult>& components) const noexcept;
+  void collectResults(const QVector<QFuture<ConversionResult> >& futures,
+                      QHash<QString, ConversionResult>& results, int& count,
+                      int totalCount) noexcept;
+  static QVector<std::shared_ptr<Polygon> > convertWires(
+      const QList<parseagle::Wire>& wires, QStringList& errors);
+  static void tryOrAddError(QStringList& errors, std::function<void()> func);
   void raiseImportError(const QString& element, const QString& error) noexcept;
   void run() noexcept override;
 
@@ -175,7 +211,7 @@ private:  // Data
   QSet<Uuid> mDeviceCategories;
 
   // State
-  bool mAbort;
+  std::atomic<bool> mAbort;  ///< Also read by the conversion threads
   FilePath mLoadedFilePath;
   QStringList mImportErrors;
 
@@ -124,64 +124,108 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
                      .arg(Layer::boardOutlines().getNameTr());
     }
 
-    // Convert holes to areas.
-    ClipperLib::Paths platedHoles =
-        getPaths(data, {Layer::boardPlatedCutouts().getId()});
-    ClipperLib::Paths nonPlatedHoles =
-        getPaths(data, {Layer::boardCutouts().getId()});
-    QHash<QString, ClipperLib::Paths> copperHoles;
-    for (auto& hole : data->getHoles()) {
-      const auto paths = ClipperHelpers::convert(
-          hole.path->toOutlineStrokes(hole.diameter), mMaxArcTolerance);
-      if (hole.copperLayer) {
-        ClipperLib::Paths& holes = copperHoles[hole.copperLayer->getId()];
-        holes.insert(holes.end(), paths.begin(), paths.end());
-      } else if (hole.plated) {
-        platedHoles.insert(platedHoles.end(), paths.begin(), paths.end());
-      } else {
-        nonPlatedHoles.insert(nonPlatedHoles.end(), paths.begin(), paths.end());
+    // Calculate fingerprints of the input data to skip the (expensive)
+    // regeneration of objects which did not change since the last build.
+    const QHash<QString, QByteArray> layerKeys = calcLayerKeys(*data);
+    auto layersKey = [&layerKeys](const QStringList& layers) {
+      QByteArray key;
+      foreach (const QString& layer, layers) {
+        key += layer.toUtf8() + layerKeys.value(layer);
       }
+      return key;
+    };
+    QByteArray paramsKey;
+    {
+      QDataStream stream(&paramsKey, QIODevice::WriteOnly);
+      stream << scaleFactor << d;
     }
-    ClipperLib::Paths allHoles = platedHoles;
-    ClipperHelpers::unite(allHoles, nonPlatedHoles, ClipperLib::pftNonZero,
-                          ClipperLib::pftNonZero);
-    if (mAbort) return;
+    const QByteArray outlinesKey =
+        layersKey({Layer::boardOutlines().getId()}) + paramsKey;
+    const QByteArray holesKey = outlinesKey +
+        layersKey({Layer::boardCutouts().getId(),
+                   Layer::boardPlatedCutouts().getId()}) +
+        calcHolesKey(*data);
+
+    // Convert holes to areas (only if needed).
+    bool holesConverted = false;
+    ClipperLib::Paths platedHoles;
+    ClipperLib::Paths nonPlatedHoles;
+    ClipperLib::Paths allHoles;
+    QHash<QString, ClipperLib::Paths> copperHoles;
+    auto convertHoles = [&]() {
+      if (holesConverted) return;
+      platedHoles = getPaths(data, {Layer::boardPlatedCutouts().getId()});
+      nonPlatedHoles = getPaths(data, {Layer::boardCutouts().getId()});
+      for (auto& hole : data->getHoles()) {
+        const auto paths = ClipperHelpers::convert(
+            hole.path->toOutlineStrokes(hole.diameter), mMaxArcTolerance);
+        if (hole.copperLayer) {
+          ClipperLib::Paths& holes = copperHoles[hole.copperLayer->getId()];
+          holes.insert(holes.end(), paths.begin(), paths.end());
+        } else if (hole.plated) {
+          platedHoles.insert(platedHoles.end(), paths.begin(), paths.end());
+        } else {
+          nonPlatedHoles.insert(nonPlatedHoles.end(), paths.begin(),
+                                paths.end());
+        }
+      }
+      allHoles = platedHoles;
+      ClipperHelpers::unite(allHoles, nonPlatedHoles, ClipperLib::pftNonZero,
+                            ClipperLib::pftNonZero);
+      holesConverted = true;
+    };
 
     // Board body.
     QStringList layers = {Layer::boardOutlines().getId()};
-    const ClipperLib::Paths boardOutlines = getPaths(data, layers);
-    std::unique_ptr<ClipperLib::PolyTree> tree = ClipperHelpers::subtractToTree(
-        boardOutlines, allHoles, ClipperLib::pftNonZero,
-        ClipperLib::pftNonZero);
-    const ClipperLib::Paths boardArea = ClipperHelpers::flattenTree(*tree);
-    tree = ClipperHelpers::subtractToTree(boardOutlines, allHoles,
-                                          ClipperLib::pftNonZero,
-                                          ClipperLib::pftNonZero, false);
-    const ClipperLib::Paths boardEdges = ClipperHelpers::treeToPaths(*tree);
-    publishTriangleData(
-        Layer::boardOutlines().getId(), QColor(70, 80, 70),
-        extrude(boardArea, -d, 2 * d, scaleFactor, true, false) +
-            extrude(boardEdges, -d, 2 * d, scaleFactor, false, true, false));
+    const ClipperLib::Paths boardOutlines =
+        getCachedPaths("outlines", outlinesKey,
+                       [&]() { return getPaths(data, layers); });
+    std::unique_ptr<ClipperLib::PolyTree> tree;
+    const ClipperLib::Paths boardArea =
+        getCachedPaths("area", holesKey, [&]() {
+          convertHoles();
+          tree = ClipperHelpers::subtractToTree(boardOutlines, allHoles,
+                                                ClipperLib::pftNonZero,
+                                                ClipperLib::pftNonZero);
+          return ClipperHelpers::flattenTree(*tree);
+        });
+    if (!isUpToDate(Layer::boardOutlines().getId(), holesKey)) {
+      convertHoles();
+      tree = ClipperHelpers::subtractToTree(boardOutlines, allHoles,
+                                            ClipperLib::pftNonZero,
+                                            ClipperLib::pftNonZero, false);
+      const ClipperLib::Paths boardEdges = ClipperHelpers::treeToPaths(*tree);
+      publishTriangleData(
+          Layer::boardOutlines().getId(), holesKey, QColor(70, 80, 70),
+          extrude(boardArea, -d, 2 * d, scaleFactor, true, false) +
+              extrude(boardEdges, -d, 2 * d, scaleFactor, false, true, false));
+    }
     if (mAbort) return;
 
     // Plated holes.
-    tree = ClipperHelpers::intersectToTree(platedHoles, boardOutlines,
-                                           ClipperLib::pftNonZero,
-                                           ClipperLib::pftNonZero, false);
-    platedHoles = ClipperHelpers::treeToPaths(*tree);
-    publishTriangleData(
-        "pth", QColor(124, 104, 71),
-        extrude(platedHoles, -d, 2 * d, scaleFactor, false, true, false));
+    if (!isUpToDate("pth", holesKey)) {
+      convertHoles();
+      tree = ClipperHelpers::intersectToTree(platedHoles, boardOutlines,
+                                             ClipperLib::pftNonZero,
+                                             ClipperLib::pftNonZero, false);
+      const ClipperLib::Paths paths = ClipperHelpers::treeToPaths(*tree);
+      publishTriangleData(
+          "pth", holesKey, QColor(124, 104, 71),
+          extrude(paths, -d, 2 * d, scaleFactor, false, true, false));
+    }
     if (mAbort) return;
 
     // Non-plated holes.
-    tree = ClipperHelpers::intersectToTree(nonPlatedHoles, boardOutlines,
-                                           ClipperLib::pftNonZero,
-                                           ClipperLib::pftNonZero, false);
-    nonPlatedHoles = ClipperHelpers::treeToPaths(*tree);
-    publishTriangleData(
-        "npth", QColor(50, 50, 50),
-        extrude(nonPlatedHoles, -d, 2 * d, scaleFactor, false, true, false));
+    if (!isUpToDate("npth", holesKey)) {
+      convertHoles();
+      tree = ClipperHelpers::intersectToTree(nonPlatedHoles, boardOutlines,
+                                             ClipperLib::pftNonZero,
+                                             ClipperLib::pftNonZero, false);
+      const ClipperLib::Paths paths = ClipperHelpers::treeToPaths(*tree);
+      publishTriangleData(
+          "npth", holesKey, QColor(50, 50, 50),
+          extrude(paths, -d, 2 * d, scaleFactor, false, true, false));
+    }
     if (mAbort) return;
 
     for (bool top : {false, true}) {
@@ -190,55 +234,77 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
 
       // Copper.
       layers = QStringList{transform.map(Layer::topCopper()).getId()};
-      ClipperLib::Paths copperArea = boardArea;
-      if (copperHoles.contains(layers.first())) {
-        ClipperHelpers::subtract(copperArea, copperHoles[layers.first()],
-                                 ClipperLib::pftEvenOdd,
-                                 ClipperLib::pftNonZero);
+      QByteArray key = holesKey + layersKey(layers);
+      if (!isUpToDate(layers.first(), key)) {
+        const ClipperLib::Paths copperArea =
+            getCachedPaths("area:" % layers.first(), holesKey, [&]() {
+              convertHoles();
+              ClipperLib::Paths area = boardArea;
+              if (copperHoles.contains(layers.first())) {
+                ClipperHelpers::subtract(area, copperHoles[layers.first()],
+                                         ClipperLib::pftEvenOdd,
+                                         ClipperLib::pftNonZero);
+              }
+              return area;
+            });
+        tree = ClipperHelpers::intersectToTree(
+            copperArea, getPaths(data, layers), ClipperLib::pftEvenOdd,
+            ClipperLib::pftNonZero);
+        const ClipperLib::Paths paths = ClipperHelpers::flattenTree(*tree);
+        publishTriangleData(
+            layers.first(), key, QColor(188, 156, 105),
+            extrude(paths, (d - 0.001) * side, 0.035 * side, scaleFactor));
       }
-      tree = ClipperHelpers::intersectToTree(copperArea, getPaths(data, layers),
-                                             ClipperLib::pftEvenOdd,
-                                             ClipperLib::pftNonZero);
-      ClipperLib::Paths paths = ClipperHelpers::flattenTree(*tree);
-      publishTriangleData(
-          layers.first(), QColor(188, 156, 105),
-          extrude(paths, (d - 0.001) * side, 0.035 * side, scaleFactor));
       if (mAbort) return;
 
       // Solder resist.
       layers = QStringList{transform.map(Layer::topStopMask()).getId(),
                            Layer::boardCutouts().getId(),
                            Layer::boardPlatedCutouts().getId()};
+      const PcbColor* solderResistColor = data->getSolderResist();
+      const QByteArray solderResistKey = outlinesKey + layersKey(layers) +
+          (solderResistColor ? solderResistColor->getId().toUtf8()
+                             : QByteArray());
       ClipperLib::Paths solderResist;
-      if (const PcbColor* color = data->getSolderResist()) {
-        solderResist = boardOutlines;
-        ClipperHelpers::subtract(solderResist, getPaths(data, layers),
-                                 ClipperLib::pftEvenOdd,
-                                 ClipperLib::pftNonZero);
-        // Shrink the solder resist very slightly to give copper the higher
-        // priority if copper edges and solder resist edges are exactly
-        // overlapping (also avoids ugly rendering due to faces within the same
-        // 3D plane).
-        tree = ClipperHelpers::offsetToTree(solderResist, Length(-50),
-                                            mMaxArcTolerance);
-        solderResist = ClipperHelpers::flattenTree(*tree);
-        publishTriangleData(layers.first(), color->toSolderResistColor(),
-                            extrude(solderResist, (d + 0.001) * side,
-                                    0.05 * side, scaleFactor));
-      } else {
-        publishTriangleData(layers.first(), Qt::transparent, {});
+      if (solderResistColor) {
+        solderResist = getCachedPaths(
+            "solderresist:" % layers.first(), solderResistKey, [&]() {
+              ClipperLib::Paths paths = boardOutlines;
+              ClipperHelpers::subtract(paths, getPaths(data, layers),
+                                       ClipperLib::pftEvenOdd,
+                                       ClipperLib::pftNonZero);
+              // Shrink the solder resist very slightly to give copper the
+              // higher priority if copper edges and solder resist edges are
+              // exactly overlapping (also avoids ugly rendering due to faces
+              // within the same 3D plane).
+              tree = ClipperHelpers::offsetToTree(paths, Length(-50),
+                                                  mMaxArcTolerance);
+              return ClipperHelpers::flattenTree(*tree);
+            });
+        if (!isUpToDate(layers.first(), solderResistKey)) {
+          publishTriangleData(layers.first(), solderResistKey,
+                              solderResistColor->toSolderResistColor(),
+                              extrude(solderResist, (d + 0.001) * side,
+                                      0.05 * side, scaleFactor));
+        }
+      } else if (!isUpToDate(layers.first(), solderResistKey)) {
+        publishTriangleData(layers.first(), solderResistKey, Qt::transparent,
+                            {});
       }
       if (mAbort) return;
 
       // Solder paste.
       layers = QStringList{transform.map(Layer::topSolderPaste()).getId()};
-      tree = ClipperHelpers::intersectToTree(boardArea, getPaths(data, layers),
-                                             ClipperLib::pftEvenOdd,
-                                             ClipperLib::pftNonZero);
-      paths = ClipperHelpers::flattenTree(*tree);
-      publishTriangleData(
-          layers.first(), Qt::darkGray,
-          extrude(paths, (d + 0.036) * side, 0.03 * side, scaleFactor));
+      key = holesKey + layersKey(layers);
+      if (!isUpToDate(layers.first(), key)) {
+        tree = ClipperHelpers::intersectToTree(
+            boardArea, getPaths(data, layers), ClipperLib::pftEvenOdd,
+            ClipperLib::pftNonZero);
+        const ClipperLib::Paths paths = ClipperHelpers::flattenTree(*tree);
+        publishTriangleData(
+            layers.first(), key, Qt::darkGray,
+            extrude(paths, (d + 0.036) * side, 0.03 * side, scaleFactor));
+      }
       if (mAbort) return;
 
       // Silkscreen.
@@ -248,18 +314,21 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
                    : data->getSilkscreenLayersBot()) {
         layers.append(layer->getId());
       }
+      layers.sort();  // Deterministic key, QSet has no defined order.
+      const QString silkscreenId = transform.map(Layer::topLegend()).getId();
       if (const PcbColor* color = data->getSilkscreen()) {
-        tree = ClipperHelpers::intersectToTree(
-            solderResist, getPaths(data, layers), ClipperLib::pftEvenOdd,
-            ClipperLib::pftNonZero);
-        paths = ClipperHelpers::flattenTree(*tree);
-        publishTriangleData(
-            transform.map(Layer::topLegend()).getId(),
-            color->toSilkscreenColor(),
-            extrude(paths, (d + 0.052) * side, 0.01 * side, scaleFactor));
-      } else {
-        publishTriangleData(transform.map(Layer::topLegend()).getId(),
-                            Qt::transparent, {});
+        key = solderResistKey + layersKey(layers) + color->getId().toUtf8();
+        if (!isUpToDate(silkscreenId, key)) {
+          tree = ClipperHelpers::intersectToTree(
+              solderResist, getPaths(data, layers), ClipperLib::pftEvenOdd,
+              ClipperLib::pftNonZero);
+          const ClipperLib::Paths paths = ClipperHelpers::flattenTree(*tree);
+          publishTriangleData(
+              silkscreenId, key, color->toSilkscreenColor(),
+              extrude(paths, (d + 0.052) * side, 0.01 * side, scaleFactor));
+        }
+      } else if (!isUpToDate(silkscreenId, QByteArray())) {
+        publishTriangleData(silkscreenId, QByteArray(), Qt::transparent, {});
       }
       if (mAbort) return;
     }
@@ -269,8 +338,15 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
     if (std::shared_ptr<FileSystem> fs = data->getFileSystem()) {
       for (const auto& obj : data->getDevices()) {
         const QByteArray content = fs->readIfExists(obj.stepFile);
-        publishDevice(obj, content, d + 0.067, scaleFactor,
-                      data->getStepAlphaValue());
+        const QByteArray key = calcDeviceKey(obj, content, d + 0.067,
+                                             scaleFactor,
+                                             data->getStepAlphaValue());
+        if (mDeviceKeys.value(obj.uuid) != key) {
+          mDeviceKeys.remove(obj.uuid);  // In case of abort.
+          publishDevice(obj, content, d + 0.067, scaleFactor,
+                        data->getStepAlphaValue());
+          mDeviceKeys.insert(obj.uuid, key);
+        }
         deviceUuids.insert(obj.uuid);
         if (mAbort) return;
       }
@@ -278,6 +354,7 @@ void OpenGlSceneBuilder::run(std::shared_ptr<SceneData3D> data) noexcept {
 
     // Remove all no longer existing devices.
     foreach (const Uuid& uuid, mDevices.keys().toSet() - deviceUuids) {
+      mDeviceKeys.remove(uuid);
       foreach (auto obj, mDevices.take(uuid)) {
         emit objectRemoved(obj);
       }
@@ -395,8 +472,27 @@ QVector<QVector3D> OpenGlSceneBuilder::tesselate(const ClipperLib::Path& path,
   return result;
 }
 
+ClipperLib::Paths OpenGlSceneBuilder::getCachedPaths(
+    const QString& id, const QByteArray& key,
+    const std::function<ClipperLib::Paths()>& builder) {
+  auto it = mPathsCache.find(id);
+  if ((it != mPathsCache.end()) && (it->first == key)) {
+    return it->second;
+  }
+  const ClipperLib::Paths paths = builder();
+  mPathsCache.insert(id, std::make_pair(key, paths));
+  return paths;
+}
+
+bool OpenGlSceneBuilder::isUpToDate(const QString& id,
+                                    const QByteArray& key) const noexcept {
+  auto it = mBoardObjectKeys.find(id);
+  return (it != mBoardObjectKeys.end()) && (*it == key) &&
+      mBoardObjects.contains(id);
+}
+
 void OpenGlSceneBuilder::publishTriangleData(
-    const QString& id, const QColor& color,
+    const QString& id, const QByteArray& key, const QColor& color,
     const QVector<QVector3D>& triangles) {
   std::shared_ptr<OpenGlTriangleObject> obj = mBoardObjects.value(id);
   if (obj) {
@@ -408,6 +504,7 @@ void OpenGlSceneBuilder::publishTriangleData(
     mBoardObjects[id] = obj;
     emit objectAdded(obj);
   }
+  mBoardObjectKeys[id] = key;
 }
 
 void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
@@ -475,6 +572,68 @@ void OpenGlSceneBuilder::publishDevice(const SceneData3D::DeviceData& obj,
   }
 }
 
+QHash<QString, QByteArray> OpenGlSceneBuilder::calcLayerKeys(
+    const SceneData3D& data) noexcept {
+  QHash<QString, std::shared_ptr<QCryptographicHash>> hashes;
+  foreach (const auto& area, data.getAreas()) {
+    std::shared_ptr<QCryptographicHash>& hash = hashes[area.layer->getId()];
+    if (!hash) {
+      hash = std::make_shared<QCryptographicHash>(QCryptographicHash::Md5);
+    }
+    for (const Vertex& vertex : area.outline.getVertices()) {
+      const qint64 values[] = {vertex.getPos().getX().toNm(),
+                               vertex.getPos().getY().toNm(),
+                               vertex.getAngle().toMicroDeg()};
+      hash->addData(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+    hash->addData("|", 1);  // Separator between areas.
+  }
+  QHash<QString, QByteArray> keys;
+  for (auto it = hashes.begin(); it != hashes.end(); it++) {
+    keys.insert(it.key(), it.value()->result());
+  }
+  return keys;
+}
+
+QByteArray OpenGlSceneBuilder::calcHolesKey(const SceneData3D& data) noexcept {
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  foreach (const auto& hole, data.getHoles()) {
+    for (const Vertex& vertex : hole.path->getVertices()) {
+      const qint64 values[] = {vertex.getPos().getX().toNm(),
+                               vertex.getPos().getY().toNm(),
+                               vertex.getAngle().toMicroDeg()};
+      hash.addData(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+    const qint64 values[] = {hole.diameter->toNm(), hole.plated ? 1 : 0};
+    hash.addData(reinterpret_cast<const char*>(values), sizeof(values));
+    if (hole.copperLayer) {
+      hash.addData(hole.copperLayer->getId().toUtf8());
+    }
+    hash.addData("|", 1);  // Separator between holes.
+  }
+  return hash.result();
+}
+
+QByteArray OpenGlSceneBuilder::calcDeviceKey(
+    const SceneData3D::DeviceData& obj, const QByteArray& stepContent, qreal z,
+    qreal scaleFactor, qreal alpha) noexcept {
+  QByteArray key;
+  QDataStream stream(&key, QIODevice::WriteOnly);
+  stream << QCryptographicHash::hash(stepContent, QCryptographicHash::Md5)
+         << obj.transform.getPosition().getX().toNm()
+         << obj.transform.getPosition().getY().toNm()
+         << obj.transform.getRotation().toMicroDeg()
+         << obj.transform.getMirrored()
+         << std::get<0>(obj.stepPosition).toNm()
+         << std::get<1>(obj.stepPosition).toNm()
+         << std::get<2>(obj.stepPosition).toNm()
+         << std::get<0>(obj.stepRotation).toMicroDeg()
+         << std::get<1>(obj.stepRotation).toMicroDeg()
+         << std::get<2>(obj.stepRotation).toMicroDeg() << z << scaleFactor
+         << alpha;
+  return key;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -28,6 +28,7 @@
 
 #include <QtCore>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -45,6 +46,12 @@ class OpenGlTriangleObject;
 
 /**
  * @brief Asynchronously generates a 3D board scene for OpenGL rendering
+ *
+ * The builder keeps the generated objects between subsequent builds and
+ * memorizes a fingerprint of the input data of each object. On a rebuild,
+ * only objects with modified input data are regenerated and published,
+ * i.e. moving a device only updates the transformation of that device and
+ * modifying the copper of one side only recomputes that layer.
  */
 class OpenGlSceneBuilder final : public QObject {
   Q_OBJECT
@@ -103,11 +110,22 @@ private:  // Methods
                              bool edges = true, bool closed = true) const;
   static QVector<QVector3D> tesselate(const ClipperLib::Path& path, qreal z,
                                       qreal scaleFactor);
-  void publishTriangleData(const QString& id, const QColor& color,
+  ClipperLib::Paths getCachedPaths(
+      const QString& id, const QByteArray& key,
+      const std::function<ClipperLib::Paths()>& builder);
+  bool isUpToDate(const QString& id, const QByteArray& key) const noexcept;
+  void publishTriangleData(const QString& id, const QByteArray& key,
+                           const QColor& color,
                            const QVector<QVector3D>& triangles);
   void publishDevice(const SceneData3D::DeviceData& obj,
                      const QByteArray& stepContent, qreal z, qreal scaleFactor,
                      qreal alpha);
+  static QHash<QString, QByteArray> calcLayerKeys(
+      const SceneData3D& data) noexcept;
+  static QByteArray calcHolesKey(const SceneData3D& data) noexcept;
+  static QByteArray calcDeviceKey(const SceneData3D::DeviceData& obj,
+                                  const QByteArray& stepContent, qreal z,
+                                  qreal scaleFactor, qreal alpha) noexcept;
 
 private:  // Data
   const PositiveLength mMaxArcTolerance;
@@ -116,7 +134,10 @@ private:  // Data
 
   // Thread data.
   QHash<QString, std::shared_ptr<OpenGlTriangleObject>> mBoardObjects;
+  QHash<QString, QByteArray> mBoardObjectKeys;  ///< Input fingerprints
+  QHash<QString, std::pair<QByteArray, ClipperLib::Paths>> mPathsCache;
   QHash<Uuid, QMap<Color, std::shared_ptr<OpenGlTriangleObject>>> mDevices;
+  QHash<Uuid, QByteArray> mDeviceKeys;  ///< Input fingerprints
   QHash<QByteArray, StepModel> mStepModels;  ///< Cache
 };
 
@@ -86,6 +86,8 @@ DxfImportDialog::DxfImportDialog(const QSet<const Layer*>& layers,
     mUi->cbxCirclesAsDrills->setChecked(
         clientSettings.value(settingsPrefix % "/circles_as_drills", false)
             .toBool());
+    mUi->edtDxfLayers->setText(
+        clientSettings.value(settingsPrefix % "/dxf_layers").toString());
     restoreGeometry(clientSettings.value(settingsPrefix % "/window_geometry")
                         .toByteArray());
   } catch (const Exception& e) {
@@ -113,6 +115,8 @@ DxfImportDialog::~DxfImportDialog() noexcept {
                           mUi->cbxJoinTangentPolylines->isChecked());
   clientSettings.setValue(mSettingsPrefix % "/circles_as_drills",
                           mUi->cbxCirclesAsDrills->isChecked());
+  clientSettings.setValue(mSettingsPrefix % "/dxf_layers",
+                          mUi->edtDxfLayers->text());
   clientSettings.setValue(mSettingsPrefix % "/window_geometry", saveGeometry());
 }
 
@@ -152,6 +156,17 @@ bool DxfImportDialog::getImportCirclesAsDrills() const noexcept {
   return mUi->cbxCirclesAsDrills->isChecked();
 }
 
+QSet<QString> DxfImportDialog::getDxfLayers() const noexcept {
+  QSet<QString> layers;
+  foreach (const QString& layer,
+           mUi->edtDxfLayers->text().split(",", QString::SkipEmptyParts)) {
+    if (!layer.trimmed().isEmpty()) {
+      layers.insert(layer.trimmed());
+    }
+  }
+  return layers;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
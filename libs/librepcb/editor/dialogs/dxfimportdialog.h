@@ -74,6 +74,7 @@ public:
   tl::optional<Point> getPlacementPosition() const noexcept;
   bool getJoinTangentPolylines() const noexcept;
   bool getImportCirclesAsDrills() const noexcept;
+  QSet<QString> getDxfLayers() const noexcept;
 
   // General Methods
   FilePath chooseFile() const noexcept;
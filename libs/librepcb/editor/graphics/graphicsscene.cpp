@@ -82,6 +82,18 @@ void GraphicsScene::clearSelectionRect() noexcept {
   mSelectionRectItem->setRect(QRectF());
 }
 
+QSet<QGraphicsItem*> GraphicsScene::getItemsInArea(
+    const QRectF& rect) const noexcept {
+  QSet<QGraphicsItem*> result;
+  foreach (QGraphicsItem* item,
+           items(rect, Qt::IntersectsItemBoundingRect, Qt::AscendingOrder)) {
+    for (; item && (!result.contains(item)); item = item->parentItem()) {
+      result.insert(item);
+    }
+  }
+  return result;
+}
+
 QPixmap GraphicsScene::toPixmap(int dpi, const QColor& background) noexcept {
   QRectF rect = itemsBoundingRect();
   return toPixmap(QSize(qCeil(dpi * Length::fromPx(rect.width()).toInch()),
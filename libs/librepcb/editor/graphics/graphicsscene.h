@@ -26,6 +26,8 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -61,6 +63,55 @@ public:
   QPixmap toPixmap(const QSize& size,
                    const QColor& background = Qt::transparent) noexcept;
 
+  /**
+   * @brief Get all items located within a given area
+   *
+   * Uses the spatial index of the scene (which Qt keeps up to date on every
+   * geometry change), so the cost depends only on the number of items in the
+   * area, not on the total number of items in the scene.
+   *
+   * @note  Since the bounding rect of a QGraphicsItemGroup is not updated
+   *        when its children change, the parents of all found items are
+   *        returned as well.
+   *
+   * @param rect    The area in scene coordinates.
+   *
+   * @return All visible items whose bounding rect intersects the area, plus
+   *         all of their parent items.
+   */
+  QSet<QGraphicsItem*> getItemsInArea(const QRectF& rect) const noexcept;
+
+  /**
+   * @brief Filter a map of graphics items by a set of items
+   *
+   * Typically used together with #getItemsInArea() to reduce the items of a
+   * specific type to those located within an area. The cost depends only on
+   * the size of the filter set, not on the number of items in the map.
+   *
+   * @param items       Map of all items of a specific type, with the
+   *                    corresponding project item as key.
+   * @param filter      Set of items to keep.
+   * @param getKey      Getter of the graphics item to get the map key.
+   *
+   * @return All entries of `items` which are contained in `filter`.
+   */
+  template <typename TKey, typename TItem>
+  static QHash<TKey*, std::shared_ptr<TItem>> filterItems(
+      const QHash<TKey*, std::shared_ptr<TItem>>& items,
+      const QSet<QGraphicsItem*>& filter,
+      TKey& (TItem::*getKey)()) noexcept {
+    QHash<TKey*, std::shared_ptr<TItem>> result;
+    foreach (QGraphicsItem* item, filter) {
+      if (TItem* graphicsItem = dynamic_cast<TItem*>(item)) {
+        TKey* key = &(graphicsItem->*getKey)();
+        if (std::shared_ptr<TItem> ptr = items.value(key)) {
+          result.insert(key, ptr);
+        }
+      }
+    }
+    return result;
+  }
+
 private:
   QGraphicsRectItem* mSelectionRectItem;
 };
@@ -55,6 +55,7 @@ PrimitiveFootprintPadGraphicsItem::PrimitiveFootprintPadGraphicsItem(
   : QGraphicsItemGroup(parent),
     mLayerProvider(lp),
     mMirror(false),
+    mLevelOfDetailEnabled(false),
     mCopperLayer(nullptr),
     mOriginCrossGraphicsItem(new OriginCrossGraphicsItem(this)),
     mTextGraphicsItem(new PrimitivePathGraphicsItem(this)),
@@ -169,6 +170,7 @@ void PrimitiveFootprintPadGraphicsItem::setGeometries(
       item->setRotation(mOriginCrossGraphicsItem->rotation());
       item->setMirrored(mMirror);
       item->setPath(shape);
+      item->setLevelOfDetailEnabled(mLevelOfDetailEnabled);
       item->setShapeMode(
           isCopperLayer ? PrimitivePathGraphicsItem::ShapeMode::FilledOutline
                         : PrimitivePathGraphicsItem::ShapeMode::None);
@@ -186,6 +188,7 @@ void PrimitiveFootprintPadGraphicsItem::setGeometries(
           clrItem->setPath(
               geometry.withOffset(clearance).toFilledQPainterPathPx());
           clrItem->setShapeMode(PrimitivePathGraphicsItem::ShapeMode::None);
+          clrItem->setLevelOfDetailEnabled(mLevelOfDetailEnabled);
           clrItem->setZValue(item->zValue());
           mPathGraphicsItems.append(PathItem{layer, true, true, clrItem});
         }
@@ -197,6 +200,14 @@ void PrimitiveFootprintPadGraphicsItem::setGeometries(
   updateRegisteredLayers();
 }
 
+void PrimitiveFootprintPadGraphicsItem::setLevelOfDetailEnabled(
+    bool enabled) noexcept {
+  mLevelOfDetailEnabled = enabled;
+  foreach (auto& item, mPathGraphicsItems) {
+    item.item->setLevelOfDetailEnabled(enabled);
+  }
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsItem
  ******************************************************************************/
@@ -73,6 +73,10 @@ public:
   void setGeometries(const QHash<const Layer*, QList<PadGeometry>>& geometries,
                      const Length& clearance) noexcept;
 
+  /// Enable level of detail rendering of the pad and clearance paths, see
+  /// ::librepcb::editor::PrimitivePathGraphicsItem::setLevelOfDetailEnabled()
+  void setLevelOfDetailEnabled(bool enabled) noexcept;
+
   // Inherited from QGraphicsItem
   QPainterPath shape() const noexcept override;
 
@@ -92,6 +96,7 @@ private:  // Methods
 private:  // Data
   const IF_GraphicsLayerProvider& mLayerProvider;
   bool mMirror;
+  bool mLevelOfDetailEnabled;
   std::shared_ptr<GraphicsLayer> mCopperLayer;
   QScopedPointer<OriginCrossGraphicsItem> mOriginCrossGraphicsItem;
   QScopedPointer<PrimitivePathGraphicsItem> mTextGraphicsItem;
@@ -45,6 +45,7 @@ PrimitivePathGraphicsItem::PrimitivePathGraphicsItem(
     mFillLayer(nullptr),
     mLighterColors(false),
     mShapeMode(ShapeMode::StrokeAndAreaByLayer),
+    mLevelOfDetailEnabled(false),
     mBoundingRectMarginPx(0),
     mOnLayerEditedSlot(*this, &PrimitivePathGraphicsItem::layerEdited) {
   setFlag(QGraphicsItem::ItemIsSelectable, true);
@@ -130,6 +131,11 @@ void PrimitivePathGraphicsItem::setShapeMode(ShapeMode mode) noexcept {
   updateBoundingRectAndShape();
 }
 
+void PrimitivePathGraphicsItem::setLevelOfDetailEnabled(bool enabled) noexcept {
+  mLevelOfDetailEnabled = enabled;
+  update();
+}
+
 /*******************************************************************************
  *  Inherited from QGraphicsItem
  ******************************************************************************/
@@ -148,12 +154,30 @@ void PrimitivePathGraphicsItem::paint(QPainter* painter,
 
   const bool isSelected = option->state.testFlag(QStyle::State_Selected);
 
+  const QPen& pen = isSelected ? mPenHighlighted : mPen;
+  const QBrush& brush = isSelected ? mBrushHighlighted : mBrush;
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+
   if (mMirror) {
     painter->scale(-1, 1);
   }
 
-  painter->setPen(isSelected ? mPenHighlighted : mPen);
-  painter->setBrush(isSelected ? mBrushHighlighted : mBrush);
+  // If the whole item is smaller than about two device pixels, the exact
+  // path is not distinguishable anyway, so just fill its bounding rect. This
+  // is much faster for complex paths like texts of zoomed out boards.
+  if (mLevelOfDetailEnabled && (!mPainterPath.isEmpty()) &&
+      (std::max(mBoundingRect.width(), mBoundingRect.height()) * lod < 2)) {
+    const qreal margin = (pen.style() != Qt::NoPen) ? (pen.widthF() / 2) : 0;
+    painter->setPen(Qt::NoPen);
+    painter->setBrush((pen.style() != Qt::NoPen) ? pen.brush() : brush);
+    painter->drawRect(mPainterPath.boundingRect() +
+                      QMarginsF(margin, margin, margin, margin));
+    return;
+  }
+
+  painter->setPen(pen);
+  painter->setBrush(brush);
   painter->drawPath(mPainterPath);
 }
 
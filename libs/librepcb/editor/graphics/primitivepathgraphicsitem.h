@@ -81,6 +81,10 @@ public:
   void setLighterColors(bool lighter) noexcept;
   void setShapeMode(ShapeMode mode) noexcept;
 
+  /// Draw the bounding rect instead of the path if the item is tiny (off by
+  /// default, intended for huge scenes like boards)
+  void setLevelOfDetailEnabled(bool enabled) noexcept;
+
   // Inherited from QGraphicsItem
   QRectF boundingRect() const noexcept override {
     return mBoundingRect +
@@ -109,6 +113,7 @@ protected:  // Data
   std::shared_ptr<GraphicsLayer> mFillLayer;
   bool mLighterColors;
   ShapeMode mShapeMode;
+  bool mLevelOfDetailEnabled;
   QPen mPen;
   QPen mPenHighlighted;
   QBrush mBrush;
@@ -109,19 +109,19 @@ void ComponentPinSignalMapModel::autoAssignSignals() noexcept {
   }
 
   try {
-    for (ComponentSymbolVariantItem& item : mSymbolVariant->getSymbolItems()) {
+    for (const auto& item : mSymbolVariant->getSymbolItems().values()) {
       std::shared_ptr<const Symbol> symbol =
-          mSymbolsCache->getSymbol(item.getSymbolUuid());
+          mSymbolsCache->getSymbol(item->getSymbolUuid());
       if (symbol) {
-        for (ComponentPinSignalMapItem& map : item.getPinSignalMap()) {
+        for (const auto& map : item->getPinSignalMap().values()) {
           CircuitIdentifier pinName =
-              symbol->getPins().get(map.getPinUuid())->getName();
+              symbol->getPins().get(map->getPinUuid())->getName();
           std::shared_ptr<const ComponentSignal> signal =
               mSignals->find(*pinName);
           tl::optional<Uuid> signalUuid =
               signal ? tl::make_optional(signal->getUuid()) : tl::nullopt;
           QScopedPointer<CmdComponentPinSignalMapItemEdit> cmd(
-              new CmdComponentPinSignalMapItemEdit(map));
+              new CmdComponentPinSignalMapItemEdit(*map));
           cmd->setSignalUuid(signalUuid);
           execCmd(cmd.take());  // can throw
         }
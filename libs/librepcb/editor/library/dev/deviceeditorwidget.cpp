@@ -297,11 +297,11 @@ void DeviceEditorWidget::btnChooseComponentClicked() noexcept {
         QScopedPointer<CmdDeviceEdit> cmdDevEdit(new CmdDeviceEdit(*mDevice));
         cmdDevEdit->setComponentUuid(*cmpUuid);
         cmdGroup->appendChild(cmdDevEdit.take());
-        for (DevicePadSignalMapItem& item : mDevice->getPadSignalMap()) {
-          tl::optional<Uuid> signalUuid = item.getSignalUuid();
+        for (const auto& item : mDevice->getPadSignalMap().values()) {
+          tl::optional<Uuid> signalUuid = item->getSignalUuid();
           if (!signalUuid || !cmp->getSignals().contains(*signalUuid)) {
             QScopedPointer<CmdDevicePadSignalMapItemEdit> cmdItem(
-                new CmdDevicePadSignalMapItemEdit(item));
+                new CmdDevicePadSignalMapItemEdit(*item));
             cmdItem->setSignalUuid(tl::nullopt);
             cmdGroup->appendChild(cmdItem.take());
           }
@@ -400,6 +400,38 @@ void LibraryOverviewWidget::updateElementLists() noexcept {
 template <typename ElementType>
 void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
                                               const QIcon& icon) noexcept {
+  // Query the library database in a worker thread to not block the GUI while
+  // the workspace libraries are being scanned. A pending query for the same
+  // list is cancelled since its result would be outdated anyway.
+  if (QFutureWatcherBase* previous = mElementListWatchers.take(&listWidget)) {
+    previous->cancel();
+    delete previous;
+  }
+  const QStringList localeOrder = getLibLocaleOrder();
+  const FilePath libDir = mLibrary->getDirectory().getAbsPath();
+  auto watcher =
+      new QFutureWatcher<QList<WorkspaceLibraryDb::ElementInfo>>(this);
+  connect(watcher, &QFutureWatcherBase::finished, this,
+          [this, &listWidget, icon, watcher]() {
+            mElementListWatchers.remove(&listWidget);
+            watcher->deleteLater();
+            if (!watcher->isCanceled()) {
+              updateElementListItems(listWidget, icon, watcher->future());
+            }
+          });
+  mElementListWatchers.insert(&listWidget, watcher);
+  watcher->setFuture(
+      mContext.workspace.getLibraryDb()
+          .runAsync<QList<WorkspaceLibraryDb::ElementInfo>>(
+              [localeOrder, libDir](const WorkspaceLibraryDb& db) {
+                return db.getAllInfos<ElementType>(localeOrder,
+                                                   libDir);  // can throw
+              }));
+}
+
+void LibraryOverviewWidget::updateElementListItems(
+    QListWidget& listWidget, const QIcon& icon,
+    const QFuture<QList<WorkspaceLibraryDb::ElementInfo>>& future) noexcept {
   struct Element {
     QString name;
     bool deprecated;
@@ -408,17 +440,10 @@ void LibraryOverviewWidget::updateElementList(QListWidget& listWidget,
 
   try {
     // get all library element names
-    QMultiMap<Version, FilePath> dbElements =
-        mContext.workspace.getLibraryDb().getAll<ElementType>(
-            tl::nullopt,
-            mLibrary->getDirectory().getAbsPath());  // can throw
-    foreach (const FilePath& filepath, dbElements) {
-      Element element;
-      mContext.workspace.getLibraryDb().getMetadata<ElementType>(
-          filepath, nullptr, nullptr, &element.deprecated);  // can throw
-      mContext.workspace.getLibraryDb().getTranslations<ElementType>(
-          filepath, getLibLocaleOrder(), &element.name);  // can throw
-      elements.insert(filepath, element);
+    const QList<WorkspaceLibraryDb::ElementInfo> infos =
+        future.result();  // can throw
+    foreach (const WorkspaceLibraryDb::ElementInfo& info, infos) {
+      elements.insert(info.filePath, Element{info.name, info.deprecated});
     }
   } catch (const Exception& e) {
     listWidget.clear();
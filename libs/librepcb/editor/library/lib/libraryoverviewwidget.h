@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "../editorwidgetbase.h"
 
+#include <librepcb/core/workspace/workspacelibrarydb.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -121,6 +123,9 @@ private:  // Methods
   void updateElementLists() noexcept;
   template <typename ElementType>
   void updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept;
+  void updateElementListItems(
+      QListWidget& listWidget, const QIcon& icon,
+      const QFuture<QList<WorkspaceLibraryDb::ElementInfo>>& future) noexcept;
   QHash<QListWidgetItem*, FilePath> getElementListItemFilePaths(
       const QList<QListWidgetItem*>& items) const noexcept;
   void updateElementListFilter(QListWidget& listWidget) noexcept;
@@ -146,6 +151,7 @@ private:  // Data
   std::unique_ptr<Library> mLibrary;
   QByteArray mIcon;
   QString mCurrentFilter;
+  QHash<QListWidget*, QFutureWatcherBase*> mElementListWatchers;
 };
 
 /*******************************************************************************
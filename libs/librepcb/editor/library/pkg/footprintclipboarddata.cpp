@@ -129,25 +129,25 @@ QPixmap FootprintClipboardData::generatePixmap(
     const IF_GraphicsLayerProvider& lp) noexcept {
   GraphicsScene scene;
   QVector<std::shared_ptr<QGraphicsItem>> items;
-  for (auto it = mFootprintPads.begin(); it != mFootprintPads.end(); ++it) {
-    items.append(std::make_shared<FootprintPadGraphicsItem>(it.ptr(), lp,
-                                                            &mPackagePads));
+  for (const auto& pad : mFootprintPads.values()) {
+    items.append(
+        std::make_shared<FootprintPadGraphicsItem>(pad, lp, &mPackagePads));
   }
-  for (Polygon& polygon : mPolygons) {
-    items.append(std::make_shared<PolygonGraphicsItem>(polygon, lp));
+  for (const auto& polygon : mPolygons.values()) {
+    items.append(std::make_shared<PolygonGraphicsItem>(*polygon, lp));
   }
-  for (Circle& circle : mCircles) {
-    items.append(std::make_shared<CircleGraphicsItem>(circle, lp));
+  for (const auto& circle : mCircles.values()) {
+    items.append(std::make_shared<CircleGraphicsItem>(*circle, lp));
   }
-  for (StrokeText& text : mStrokeTexts) {
+  for (const auto& text : mStrokeTexts.values()) {
     items.append(std::make_shared<StrokeTextGraphicsItem>(
-        text, lp, Application::getDefaultStrokeFont()));
+        *text, lp, Application::getDefaultStrokeFont()));
   }
-  for (Zone& zone : mZones) {
-    items.append(std::make_shared<ZoneGraphicsItem>(zone, lp));
+  for (const auto& zone : mZones.values()) {
+    items.append(std::make_shared<ZoneGraphicsItem>(*zone, lp));
   }
-  for (Hole& hole : mHoles) {
-    items.append(std::make_shared<HoleGraphicsItem>(hole, lp, false));
+  for (const auto& hole : mHoles.values()) {
+    items.append(std::make_shared<HoleGraphicsItem>(*hole, lp, false));
   }
   foreach (const auto& item, items) {
     scene.addItem(*item);
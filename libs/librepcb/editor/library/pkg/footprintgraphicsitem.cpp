@@ -335,12 +335,11 @@ void FootprintGraphicsItem::syncPads() noexcept {
   }
 
   // Add new items.
-  for (auto it = mFootprint->getPads().begin();
-       it != mFootprint->getPads().end(); ++it) {
-    if (!mPadGraphicsItems.contains(it.ptr())) {
+  for (const auto& pad : mFootprint->getPads().values()) {
+    if (!mPadGraphicsItems.contains(pad)) {
       auto i = std::make_shared<FootprintPadGraphicsItem>(
-          it.ptr(), mLayerProvider, mPackagePadList, this);
-      mPadGraphicsItems.insert(it.ptr(), i);
+          pad, mLayerProvider, mPackagePadList, this);
+      mPadGraphicsItems.insert(pad, i);
     }
   }
 }
@@ -639,6 +639,8 @@ bool PackageEditorState_Select::processImportDxf() noexcept {
     // Read DXF file.
     DxfReader import;
     import.setScaleFactor(dialog.getScaleFactor());
+    import.setLayerFilter(dialog.getDxfLayers());
+    import.setMergePolylines(dialog.getJoinTangentPolylines());
     import.parse(fp);  // can throw
 
     // If enabled, join tangent paths.
@@ -1135,7 +1137,7 @@ bool PackageEditorState_Select::generateOutline() noexcept {
     for (bool bottom : {false, true}) {
       const Transform transform(Point(), Angle(), bottom);
       QPainterPath p;
-      for (Polygon& polygon : mContext.currentFootprint->getPolygons()) {
+      for (const Polygon& polygon : mContext.currentFootprint->getPolygons()) {
         if (transform.map(polygon.getLayer()) == Layer::topDocumentation()) {
           if (polygon.getLineWidth() > 0) {
             foreach (const Path& path,
@@ -1148,7 +1150,7 @@ bool PackageEditorState_Select::generateOutline() noexcept {
           }
         }
       }
-      for (Circle& circle : mContext.currentFootprint->getCircles()) {
+      for (const Circle& circle : mContext.currentFootprint->getCircles()) {
         if (transform.map(circle.getLayer()) == Layer::topDocumentation()) {
           const qreal radiusPx =
               (circle.getDiameter() + circle.getLineWidth())->toPx() / 2;
@@ -1158,7 +1160,7 @@ bool PackageEditorState_Select::generateOutline() noexcept {
       // Generate bottom outlines only if there is documentation on the
       // bottom side!
       if ((!p.isEmpty()) || (!bottom)) {
-        for (FootprintPad& pad : mContext.currentFootprint->getPads()) {
+        for (const FootprintPad& pad : mContext.currentFootprint->getPads()) {
           const Transform padTransform(pad.getPosition(), pad.getRotation());
           if (pad.isOnLayer(transform.map(Layer::topCopper()))) {
             p.addPath(Path::toQPainterPathPx(
@@ -1173,17 +1175,19 @@ bool PackageEditorState_Select::generateOutline() noexcept {
                                      Point::fromPx(boundingRect.bottomRight()))
                               .toOpenPath();
         bool outlineSet = false;
-        for (Polygon& polygon : mContext.currentFootprint->getPolygons()) {
-          if (polygon.getLayer() == layer) {
+        // Note: Iterate over a copy since polygons are removed in the loop.
+        const auto polygons = mContext.currentFootprint->getPolygons().values();
+        for (const auto& polygon : polygons) {
+          if (polygon->getLayer() == layer) {
             if (!outlineSet) {
-              QScopedPointer<CmdPolygonEdit> cmd(new CmdPolygonEdit(polygon));
+              QScopedPointer<CmdPolygonEdit> cmd(new CmdPolygonEdit(*polygon));
               cmd->setLineWidth(UnsignedLength(0), false);
               cmd->setPath(path, false);
               transaction.append(cmd.take());
               outlineSet = true;
             } else {
               transaction.append(new CmdPolygonRemove(
-                  mContext.currentFootprint->getPolygons(), &polygon));
+                  mContext.currentFootprint->getPolygons(), polygon.get()));
             }
           }
         }
@@ -1264,19 +1268,22 @@ bool PackageEditorState_Select::generateCourtyard() noexcept {
         }
       }
     }
-    // Update existing courtyards / remove obsolete courtyards.
-    for (Polygon& polygon : mContext.currentFootprint->getPolygons()) {
-      if (polygon.getLayer().isPackageCourtyard()) {
+    // Update existing courtyards / remove obsolete courtyards. Note: Iterate
+    // over a copy since polygons are removed in the loop.
+    const auto existingPolygons =
+        mContext.currentFootprint->getPolygons().values();
+    for (const auto& polygon : existingPolygons) {
+      if (polygon->getLayer().isPackageCourtyard()) {
         if (!polygons.isEmpty()) {
           const auto pair = polygons.takeFirst();
-          QScopedPointer<CmdPolygonEdit> cmd(new CmdPolygonEdit(polygon));
+          QScopedPointer<CmdPolygonEdit> cmd(new CmdPolygonEdit(*polygon));
           cmd->setLayer(*pair.first, false);
           cmd->setLineWidth(UnsignedLength(0), false);
           cmd->setPath(pair.second, false);
           transaction.append(cmd.take());
         } else {
           transaction.append(new CmdPolygonRemove(
-              mContext.currentFootprint->getPolygons(), &polygon));
+              mContext.currentFootprint->getPolygons(), polygon.get()));
         }
       }
     }
@@ -1300,12 +1307,15 @@ bool PackageEditorState_Select::generateCourtyard() noexcept {
                             circle.getDiameter() + getOffset() + getOffset()));
       }
     }
-    // Update existing courtyards / remove obsolete courtyards.
-    for (Circle& circle : mContext.currentFootprint->getCircles()) {
-      if (circle.getLayer().isPackageCourtyard()) {
+    // Update existing courtyards / remove obsolete courtyards. Note: Iterate
+    // over a copy since circles are removed in the loop.
+    const auto existingCircles =
+        mContext.currentFootprint->getCircles().values();
+    for (const auto& circle : existingCircles) {
+      if (circle->getLayer().isPackageCourtyard()) {
         if (!circles.isEmpty()) {
           const auto tuple = circles.takeFirst();
-          QScopedPointer<CmdCircleEdit> cmd(new CmdCircleEdit(circle));
+          QScopedPointer<CmdCircleEdit> cmd(new CmdCircleEdit(*circle));
           cmd->setLayer(*std::get<0>(tuple), false);
           cmd->setLineWidth(UnsignedLength(0), false);
           cmd->setCenter(std::get<1>(tuple), false);
@@ -1313,7 +1323,7 @@ bool PackageEditorState_Select::generateCourtyard() noexcept {
           transaction.append(cmd.take());
         } else {
           transaction.append(new CmdCircleRemove(
-              mContext.currentFootprint->getCircles(), &circle));
+              mContext.currentFootprint->getCircles(), circle.get()));
         }
       }
     }
@@ -944,11 +944,11 @@ void PackageEditorWidget::fixPadFunction(const MessageType& msg) {
     if (aAll->isChecked()) {
       UndoStackTransaction transaction(*mUndoStack,
                                        tr("Fix Unspecified Pad Functions"));
-      for (auto& footprint : mPackage->getFootprints()) {
-        for (auto& pad : footprint.getPads()) {
-          if (pad.getFunction() == FootprintPad::Function::Unspecified) {
+      for (const auto& footprint : mPackage->getFootprints().values()) {
+        for (const auto& pad : footprint->getPads().values()) {
+          if (pad->getFunction() == FootprintPad::Function::Unspecified) {
             QScopedPointer<CmdFootprintPadEdit> cmd(
-                new CmdFootprintPadEdit(pad));
+                new CmdFootprintPadEdit(*pad));
             cmd->setFunction(action->data().value<FootprintPad::Function>(),
                              false);
             transaction.append(cmd.take());
@@ -115,14 +115,14 @@ QPixmap SymbolClipboardData::generatePixmap(
   for (auto ptr : mPins.values()) {
     items.append(std::make_shared<SymbolPinGraphicsItem>(ptr, lp));
   }
-  for (Polygon& polygon : mPolygons) {
-    items.append(std::make_shared<PolygonGraphicsItem>(polygon, lp));
+  for (const auto& polygon : mPolygons.values()) {
+    items.append(std::make_shared<PolygonGraphicsItem>(*polygon, lp));
   }
-  for (Circle& circle : mCircles) {
-    items.append(std::make_shared<CircleGraphicsItem>(circle, lp));
+  for (const auto& circle : mCircles.values()) {
+    items.append(std::make_shared<CircleGraphicsItem>(*circle, lp));
   }
-  for (Text& text : mTexts) {
-    items.append(std::make_shared<TextGraphicsItem>(text, lp));
+  for (const auto& text : mTexts.values()) {
+    items.append(std::make_shared<TextGraphicsItem>(*text, lp));
   }
   foreach (const auto& item, items) {
     scene.addItem(*item);
@@ -334,50 +334,65 @@ void AddComponentDialog::searchComponents(
   setSelectedComponent(nullptr);
   mUi->treeComponents->clear();
 
-  QTreeWidgetItem* selectedDeviceItem = nullptr;
-
   // min. 2 chars to avoid freeze on entering first character due to huge result
   if (input.length() > 1) {
-    SearchResult result = search(input);
-    const bool expandAllDevices =
-        (result.partsCount <= 15) || (result.deviceCount <= 1);
-    const bool expandAllComponents =
-        (result.deviceCount <= 10) || (result.components.count() <= 1);
-    for (auto cmpIt = result.components.begin();
-         cmpIt != result.components.end(); ++cmpIt) {
-      QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
-      cmpItem->setIcon(0, QIcon(":/img/library/symbol.png"));
-      cmpItem->setText(0, cmpIt.value().name);
-      cmpItem->setForeground(
-          0, cmpIt.value().deprecated ? QBrush(Qt::red) : QBrush());
-      cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
-      for (auto devIt = cmpIt->devices.begin(); devIt != cmpIt->devices.end();
-           ++devIt) {
-        QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
-        devItem->setIcon(0, QIcon(":/img/library/device.png"));
-        devItem->setText(0, devIt.value().name);
-        devItem->setForeground(
-            0, devIt.value().deprecated ? QBrush(Qt::red) : QBrush());
-        devItem->setData(0, Qt::UserRole, devIt.key().toStr());
-        devItem->setText(1, devIt.value().pkgName);
-        devItem->setTextAlignment(1, Qt::AlignRight);
-        QFont font = devItem->font(1);
-        font.setItalic(true);
-        devItem->setFont(1, font);
-        for (const auto& partPtr : devIt->parts.values()) {
-          addPartItem(partPtr, devItem);
-        }
-        devItem->setExpanded(
-            ((!cmpIt.value().match) && (!devIt.value().match)) ||
-            expandAllDevices);
-        if (devIt.value().uuid == selectedDevice) {
-          selectedDeviceItem = devItem;
-        }
+    const QStringList localeOrder = mLocaleOrder;
+    startQuery(
+        [input, localeOrder](const WorkspaceLibraryDb& db) {
+          return search(db, input, localeOrder);  // can throw
+        },
+        [this, input, selectedDevice,
+         selectFirstDevice](const SearchResult& result) {
+          showSearchResult(input, result, selectedDevice, selectFirstDevice);
+        });
+  } else {
+    cancelQuery();
+  }
+}
+
+void AddComponentDialog::showSearchResult(
+    const QString& input, const SearchResult& result,
+    const tl::optional<Uuid>& selectedDevice, bool selectFirstDevice) noexcept {
+  QTreeWidgetItem* selectedDeviceItem = nullptr;
+
+  const bool expandAllDevices =
+      (result.partsCount <= 15) || (result.deviceCount <= 1);
+  const bool expandAllComponents =
+      (result.deviceCount <= 10) || (result.components.count() <= 1);
+  for (auto cmpIt = result.components.begin();
+       cmpIt != result.components.end(); ++cmpIt) {
+    QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
+    cmpItem->setIcon(0, QIcon(":/img/library/symbol.png"));
+    cmpItem->setText(0, cmpIt.value().name);
+    cmpItem->setForeground(
+        0, cmpIt.value().deprecated ? QBrush(Qt::red) : QBrush());
+    cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
+    for (auto devIt = cmpIt->devices.begin(); devIt != cmpIt->devices.end();
+         ++devIt) {
+      QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
+      devItem->setIcon(0, QIcon(":/img/library/device.png"));
+      devItem->setText(0, devIt.value().name);
+      devItem->setForeground(
+          0, devIt.value().deprecated ? QBrush(Qt::red) : QBrush());
+      devItem->setData(0, Qt::UserRole, devIt.key().toStr());
+      devItem->setText(1, devIt.value().pkgName);
+      devItem->setTextAlignment(1, Qt::AlignRight);
+      QFont font = devItem->font(1);
+      font.setItalic(true);
+      devItem->setFont(1, font);
+      for (const auto& partPtr : devIt->parts.values()) {
+        addPartItem(partPtr, devItem);
+      }
+      devItem->setExpanded(
+          ((!cmpIt.value().match) && (!devIt.value().match)) ||
+          expandAllDevices);
+      if (devIt.value().uuid == selectedDevice) {
+        selectedDeviceItem = devItem;
       }
-      cmpItem->setText(1, QString("[%1]").arg(cmpIt.value().devices.count()));
-      cmpItem->setTextAlignment(1, Qt::AlignRight);
-      cmpItem->setExpanded((!cmpIt.value().match) || expandAllComponents);
     }
+    cmpItem->setText(1, QString("[%1]").arg(cmpIt.value().devices.count()));
+    cmpItem->setTextAlignment(1, Qt::AlignRight);
+    cmpItem->setExpanded((!cmpIt.value().match) || expandAllComponents);
   }
 
   mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
@@ -413,38 +428,39 @@ void AddComponentDialog::searchComponents(
 }
 
 AddComponentDialog::SearchResult AddComponentDialog::search(
-    const QString& input) {
+    const WorkspaceLibraryDb& db, const QString& input,
+    const QStringList& localeOrder) {
   SearchResult result;
 
   // Find in library database.
   const QList<Uuid> matchingComponents =
-      mDb.find<Component>(input);  // can throw
-  const QList<Uuid> matchingDevices = mDb.find<Device>(input);  // can throw
+      db.find<Component>(input);  // can throw
+  const QList<Uuid> matchingDevices = db.find<Device>(input);  // can throw
   const QList<Uuid> matchingPartDevices =
-      mDb.findDevicesOfParts(input);  // can throw
+      db.findDevicesOfParts(input);  // can throw
 
   // Add matching components and all their devices and parts.
   QSet<Uuid> fullyAddedDevices;
   foreach (const Uuid& cmpUuid, matchingComponents) {
-    FilePath cmpFp = mDb.getLatest<Component>(cmpUuid);  // can throw
+    FilePath cmpFp = db.getLatest<Component>(cmpUuid);  // can throw
     if (!cmpFp.isValid()) continue;
-    QSet<Uuid> devices = mDb.getComponentDevices(cmpUuid);  // can throw
+    QSet<Uuid> devices = db.getComponentDevices(cmpUuid);  // can throw
     SearchResultComponent& resCmp = result.components[cmpFp];
     resCmp.match = true;
     foreach (const Uuid& devUuid, devices) {
-      FilePath devFp = mDb.getLatest<Device>(devUuid);  // can throw
+      FilePath devFp = db.getLatest<Device>(devUuid);  // can throw
       if (!devFp.isValid()) continue;
       if (resCmp.devices.contains(devFp)) continue;
       Uuid pkgUuid = Uuid::createRandom();
-      mDb.getDeviceMetadata(devFp, nullptr,
-                            &pkgUuid);  // can throw
-      FilePath pkgFp = mDb.getLatest<Package>(pkgUuid);  // can throw
+      db.getDeviceMetadata(devFp, nullptr,
+                           &pkgUuid);  // can throw
+      FilePath pkgFp = db.getLatest<Package>(pkgUuid);  // can throw
       SearchResultDevice& resDev = resCmp.devices[devFp];
       resDev.uuid = devUuid;
       resDev.pkgFp = pkgFp;
       resDev.match = matchingDevices.contains(devUuid);
       const QList<WorkspaceLibraryDb::Part> parts =
-          mDb.getDeviceParts(devUuid);  // can throw
+          db.getDeviceParts(devUuid);  // can throw
       foreach (const WorkspaceLibraryDb::Part& part, parts) {
         resDev.parts.append(std::make_shared<Part>(
             SimpleString(part.mpn), SimpleString(part.manufacturer),
@@ -467,16 +483,16 @@ AddComponentDialog::SearchResult AddComponentDialog::search(
                                }),
                 devices.end());
   foreach (const Uuid& devUuid, devices) {
-    FilePath devFp = mDb.getLatest<Device>(devUuid);  // can throw
+    FilePath devFp = db.getLatest<Device>(devUuid);  // can throw
     if (!devFp.isValid()) continue;
     Uuid cmpUuid = Uuid::createRandom();
     Uuid pkgUuid = Uuid::createRandom();
-    mDb.getDeviceMetadata(devFp, &cmpUuid,
-                          &pkgUuid);  // can throw
-    const FilePath cmpFp = mDb.getLatest<Component>(cmpUuid);  // can throw
+    db.getDeviceMetadata(devFp, &cmpUuid,
+                         &pkgUuid);  // can throw
+    const FilePath cmpFp = db.getLatest<Component>(cmpUuid);  // can throw
     if (!cmpFp.isValid()) continue;
     SearchResultDevice& resDev = result.components[cmpFp].devices[devFp];
-    FilePath pkgFp = mDb.getLatest<Package>(pkgUuid);  // can throw
+    FilePath pkgFp = db.getLatest<Package>(pkgUuid);  // can throw
     resDev.uuid = devUuid;
     resDev.pkgFp = pkgFp;
     resDev.match = matchingDevices.contains(devUuid);
@@ -484,10 +500,10 @@ AddComponentDialog::SearchResult AddComponentDialog::search(
     QList<WorkspaceLibraryDb::Part> parts;
     if (resDev.match) {
       // List all parts of device.
-      parts = mDb.getDeviceParts(devUuid);  // can throw
+      parts = db.getDeviceParts(devUuid);  // can throw
     } else {
       // List only matched parts of device.
-      parts = mDb.findPartsOfDevice(devUuid, input);  // can throw
+      parts = db.findPartsOfDevice(devUuid, input);  // can throw
     }
     foreach (const WorkspaceLibraryDb::Part& part, parts) {
       resDev.parts.append(std::make_shared<Part>(
@@ -501,21 +517,21 @@ AddComponentDialog::SearchResult AddComponentDialog::search(
       result.components);
   while (cmpIt.hasNext()) {
     cmpIt.next();
-    mDb.getTranslations<Component>(cmpIt.key(), mLocaleOrder,
-                                   &cmpIt.value().name);
-    mDb.getMetadata<Component>(cmpIt.key(), nullptr, nullptr,
-                               &cmpIt.value().deprecated);
+    db.getTranslations<Component>(cmpIt.key(), localeOrder,
+                                  &cmpIt.value().name);
+    db.getMetadata<Component>(cmpIt.key(), nullptr, nullptr,
+                              &cmpIt.value().deprecated);
     QMutableHashIterator<FilePath, SearchResultDevice> devIt(
         cmpIt.value().devices);
     while (devIt.hasNext()) {
       devIt.next();
-      mDb.getTranslations<Device>(devIt.key(), mLocaleOrder,
-                                  &devIt.value().name);
-      mDb.getMetadata<Device>(devIt.key(), nullptr, nullptr,
-                              &devIt.value().deprecated);
+      db.getTranslations<Device>(devIt.key(), localeOrder,
+                                 &devIt.value().name);
+      db.getMetadata<Device>(devIt.key(), nullptr, nullptr,
+                             &devIt.value().deprecated);
       if (devIt.value().pkgFp.isValid()) {
-        mDb.getTranslations<Package>(devIt.value().pkgFp, mLocaleOrder,
-                                     &devIt.value().pkgName);
+        db.getTranslations<Package>(devIt.value().pkgFp, localeOrder,
+                                    &devIt.value().pkgName);
       }
     }
   }
@@ -538,67 +554,151 @@ void AddComponentDialog::setSelectedCategory(
   mUi->treeComponents->clear();
 
   mSelectedCategoryUuid = categoryUuid;
-  QSet<Uuid> components = mDb.getByCategory<Component>(categoryUuid);
-  foreach (const Uuid& cmpUuid, components) {
+
+  const QStringList localeOrder = mLocaleOrder;
+  startQuery(
+      [categoryUuid, localeOrder](const WorkspaceLibraryDb& db) {
+        return getCategoryElements(db, categoryUuid, localeOrder);  // can throw
+      },
+      [this](const SearchResult& result) { showCategoryElements(result); });
+}
+
+void AddComponentDialog::showCategoryElements(
+    const SearchResult& result) noexcept {
+  for (auto cmpIt = result.components.begin();
+       cmpIt != result.components.end(); ++cmpIt) {
     // component
-    FilePath cmpFp = mDb.getLatest<Component>(cmpUuid);
-    if (!cmpFp.isValid()) continue;
-    QString cmpName;
-    mDb.getTranslations<Component>(cmpFp, mLocaleOrder, &cmpName);
-    bool cmpDeprecated = false;
-    mDb.getMetadata<Component>(cmpFp, nullptr, nullptr, &cmpDeprecated);
+    const SearchResultComponent& cmp = cmpIt.value();
     QTreeWidgetItem* cmpItem = new QTreeWidgetItem(mUi->treeComponents);
     cmpItem->setIcon(0, QIcon(":/img/library/symbol.png"));
-    cmpItem->setText(0, cmpName);
-    cmpItem->setForeground(0, cmpDeprecated ? QBrush(Qt::red) : QBrush());
-    cmpItem->setData(0, Qt::UserRole, cmpFp.toStr());
+    cmpItem->setText(0, cmp.name);
+    cmpItem->setForeground(0, cmp.deprecated ? QBrush(Qt::red) : QBrush());
+    cmpItem->setData(0, Qt::UserRole, cmpIt.key().toStr());
     // devices
-    QSet<Uuid> devices = mDb.getComponentDevices(cmpUuid);
-    foreach (const Uuid& devUuid, devices) {
+    for (auto devIt = cmp.devices.begin(); devIt != cmp.devices.end();
+         ++devIt) {
+      const SearchResultDevice& dev = devIt.value();
+      QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
+      devItem->setIcon(0, QIcon(":/img/library/device.png"));
+      devItem->setText(0, dev.name);
+      devItem->setForeground(0, dev.deprecated ? QBrush(Qt::red) : QBrush());
+      devItem->setData(0, Qt::UserRole, devIt.key().toStr());
+      // package
+      if (dev.pkgFp.isValid()) {
+        devItem->setText(1, dev.pkgName);
+        devItem->setTextAlignment(1, Qt::AlignRight);
+        QFont font = devItem->font(1);
+        font.setItalic(true);
+        devItem->setFont(1, font);
+      }
+      // Parts
+      for (const auto& partPtr : dev.parts.values()) {
+        addPartItem(partPtr, devItem);
+      }
+    }
+    cmpItem->setText(1, QString("[%1]").arg(cmp.devices.count()));
+    cmpItem->setTextAlignment(1, Qt::AlignRight);
+  }
+
+  mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
+}
+
+AddComponentDialog::SearchResult AddComponentDialog::getCategoryElements(
+    const WorkspaceLibraryDb& db, const tl::optional<Uuid>& categoryUuid,
+    const QStringList& localeOrder) {
+  // Fetch metadata of all elements at once instead of querying each element
+  // separately.
+  const QHash<Uuid, WorkspaceLibraryDb::ElementInfo> components =
+      db.getLatestInfos<Component>(db.getByCategory<Component>(categoryUuid),
+                                   localeOrder);  // can throw
+  QHash<Uuid, QSet<Uuid>> componentDevices;
+  QSet<Uuid> deviceUuids;
+  for (auto it = components.begin(); it != components.end(); ++it) {
+    const QSet<Uuid> devices = db.getComponentDevices(it.key());  // can throw
+    componentDevices.insert(it.key(), devices);
+    deviceUuids.unite(devices);
+  }
+  const QHash<Uuid, WorkspaceLibraryDb::ElementInfo> devices =
+      db.getLatestInfos<Device>(deviceUuids, localeOrder);  // can throw
+  QSet<Uuid> packageUuids;
+  foreach (const WorkspaceLibraryDb::ElementInfo& dev, devices) {
+    if (dev.packageUuid) {
+      packageUuids.insert(*dev.packageUuid);
+    }
+  }
+  const QHash<Uuid, WorkspaceLibraryDb::ElementInfo> packages =
+      db.getLatestInfos<Package>(packageUuids, localeOrder);  // can throw
+
+  SearchResult result;
+  for (auto cmpIt = components.begin(); cmpIt != components.end(); ++cmpIt) {
+    // component
+    SearchResultComponent& resCmp = result.components[cmpIt->filePath];
+    resCmp.name = cmpIt->name;
+    resCmp.deprecated = cmpIt->deprecated;
+    // devices
+    foreach (const Uuid& devUuid, componentDevices.value(cmpIt.key())) {
+      auto devIt = devices.find(devUuid);
+      if (devIt == devices.end()) continue;
+      SearchResultDevice& resDev = resCmp.devices[devIt->filePath];
+      resDev.uuid = devUuid;
+      resDev.name = devIt->name;
+      resDev.deprecated = devIt->deprecated;
+      // package
+      auto pkgIt = devIt->packageUuid ? packages.find(*devIt->packageUuid)
+                                      : packages.end();
+      if (pkgIt != packages.end()) {
+        resDev.pkgFp = pkgIt->filePath;
+        resDev.pkgName = pkgIt->name;
+      }
+      // Parts
       try {
-        FilePath devFp = mDb.getLatest<Device>(devUuid);
-        if (!devFp.isValid()) continue;
-        QString devName;
-        mDb.getTranslations<Device>(devFp, mLocaleOrder, &devName);
-        bool devDeprecated = false;
-        mDb.getMetadata<Device>(devFp, nullptr, nullptr, &devDeprecated);
-        QTreeWidgetItem* devItem = new QTreeWidgetItem(cmpItem);
-        devItem->setIcon(0, QIcon(":/img/library/device.png"));
-        devItem->setText(0, devName);
-        devItem->setForeground(0, devDeprecated ? QBrush(Qt::red) : QBrush());
-        devItem->setData(0, Qt::UserRole, devFp.toStr());
-        // package
-        Uuid pkgUuid = Uuid::createRandom();  // only for initialization, will
-                                              // be overwritten
-        mDb.getDeviceMetadata(devFp, nullptr, &pkgUuid);
-        FilePath pkgFp = mDb.getLatest<Package>(pkgUuid);
-        if (pkgFp.isValid()) {
-          QString pkgName;
-          mDb.getTranslations<Package>(pkgFp, mLocaleOrder, &pkgName);
-          devItem->setText(1, pkgName);
-          devItem->setTextAlignment(1, Qt::AlignRight);
-          QFont font = devItem->font(1);
-          font.setItalic(true);
-          devItem->setFont(1, font);
-        }
-        // Parts
         const QList<WorkspaceLibraryDb::Part> parts =
-            mDb.getDeviceParts(devUuid);
-        foreach (const WorkspaceLibraryDb::Part& partInfo, parts) {
-          std::shared_ptr<Part> part = std::make_shared<Part>(
-              SimpleString(partInfo.mpn), SimpleString(partInfo.manufacturer),
-              partInfo.attributes);
-          addPartItem(part, devItem);
+            db.getDeviceParts(devUuid);  // can throw
+        foreach (const WorkspaceLibraryDb::Part& part, parts) {
+          resDev.parts.append(std::make_shared<Part>(
+              SimpleString(part.mpn), SimpleString(part.manufacturer),
+              part.attributes));
         }
       } catch (const Exception& e) {
         // what could we do here?
       }
+      result.partsCount += resDev.parts.count();
     }
-    cmpItem->setText(1, QString("[%1]").arg(devices.count()));
-    cmpItem->setTextAlignment(1, Qt::AlignRight);
+    result.deviceCount += resCmp.devices.count();
   }
+  return result;
+}
 
-  mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
+void AddComponentDialog::startQuery(
+    std::function<SearchResult(const WorkspaceLibraryDb&)> query,
+    std::function<void(const SearchResult&)> callback) noexcept {
+  // Query the library database in a worker thread to keep the GUI responsive
+  // while the workspace libraries are being scanned. A pending query is
+  // cancelled since its result would be outdated anyway.
+  cancelQuery();
+  mQueryCallback = callback;
+  mQueryFuture = mDb.runAsync<SearchResult>(query);
+  mQueryWatcher.setFuture(mQueryFuture);
+}
+
+void AddComponentDialog::cancelQuery() noexcept {
+  mQueryFuture.cancel();
+  mQueryCallback = nullptr;
+}
+
+void AddComponentDialog::queryFinished() noexcept {
+  if (mQueryWatcher.isCanceled() || (!mQueryCallback)) {
+    return;
+  }
+  // Reset the callback to mark the query as done. Note that the callback
+  // might start a new query.
+  const auto callback = mQueryCallback;
+  mQueryCallback = nullptr;
+  try {
+    callback(mQueryFuture.result());  // can throw
+  } catch (const Exception& e) {
+    mUi->lblErrorMsg->setText(e.getMsg());
+  }
 }
 
 void AddComponentDialog::setSelectedComponent(
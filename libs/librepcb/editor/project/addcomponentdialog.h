@@ -34,6 +34,7 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <functional>
 #include <memory>
 
 /*******************************************************************************
@@ -131,6 +132,16 @@ public:
    */
   bool getAutoOpenAgain() const noexcept;
 
+  /**
+   * @brief Check if a library database query is currently in progress
+   *
+   * @retval true   The components list is going to be updated.
+   * @retval false  The components list is up to date.
+   */
+  bool isQueryInProgress() const noexcept {
+    return static_cast<bool>(mQueryCallback);
+  }
+
   // Setters
   void setLocaleOrder(const QStringList& order) noexcept;
   void setNormOrder(const QStringList& order) noexcept { mNormOrder = order; }
@@ -155,8 +166,22 @@ private:
   void searchComponents(const QString& input,
                         const tl::optional<Uuid>& selectedDevice = tl::nullopt,
                         bool selectFirstDevice = false);
-  SearchResult search(const QString& input);
+  void showSearchResult(const QString& input, const SearchResult& result,
+                        const tl::optional<Uuid>& selectedDevice,
+                        bool selectFirstDevice) noexcept;
+  static SearchResult search(const WorkspaceLibraryDb& db,
+                             const QString& input,
+                             const QStringList& localeOrder);
   void setSelectedCategory(const tl::optional<Uuid>& categoryUuid);
+  void showCategoryElements(const SearchResult& result) noexcept;
+  static SearchResult getCategoryElements(
+      const WorkspaceLibraryDb& db, const tl::optional<Uuid>& categoryUuid,
+      const QStringList& localeOrder);
+  void startQuery(
+      std::function<SearchResult(const WorkspaceLibraryDb&)> query,
+      std::function<void(const SearchResult&)> callback) noexcept;
+  void cancelQuery() noexcept;
+  void queryFinished() noexcept;
   void setSelectedComponent(std::shared_ptr<const Component> cmp);
   void setSelectedSymbVar(
       std::shared_ptr<const ComponentSymbolVariant> symbVar);
@@ -175,6 +200,9 @@ private:
   QScopedPointer<DefaultGraphicsLayerProvider> mGraphicsLayerProvider;
   QScopedPointer<CategoryTreeModel> mCategoryTreeModel;
   QString mCurrentSearchTerm;
+  QFuture<SearchResult> mQueryFuture;
+  QFutureWatcher<SearchResult> mQueryWatcher;
+  std::function<void(const SearchResult&)> mQueryCallback;
 
   // Attributes
   tl::optional<Uuid> mSelectedCategoryUuid;
@@ -23,6 +23,7 @@
 #include "boardclipboarddata.h"
 
 #include <librepcb/core/application.h>
+#include <librepcb/core/exceptions.h>
 #include <librepcb/core/fileio/transactionaldirectory.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
 #include <librepcb/core/project/circuit/netsignal.h>
@@ -36,6 +37,117 @@
 namespace librepcb {
 namespace editor {
 
+/*******************************************************************************
+ *  Non-Member Functions
+ ******************************************************************************/
+
+static QStringList getFilesRecursively(const TransactionalFileSystem& fs,
+                                       const QString& dir = QString()) {
+  const QString prefix = dir.isEmpty() ? dir : (dir % "/");
+  QStringList files;
+  foreach (const QString& dirName, fs.getDirs(dir)) {
+    if (!dirName.startsWith('.')) {
+      files += getFilesRecursively(fs, prefix % dirName);
+    }
+  }
+  foreach (const QString& fileName, fs.getFiles(dir)) {
+    if (fileName != ".lock") {
+      files.append(prefix % fileName);
+    }
+  }
+  return files;
+}
+
+/*******************************************************************************
+ *  Class BoardClipboardData::MimeData
+ ******************************************************************************/
+
+/**
+ * @brief MIME data which serializes the clipboard content only on demand
+ *
+ * Keeps a copy of the clipboard data in memory, so pasting within the same
+ * application instance doesn't need to serialize and parse anything. The
+ * (costly) serialized formats are only generated when they are actually
+ * requested, e.g. by another application, and then cached.
+ */
+class BoardClipboardData::MimeData final : public QMimeData {
+public:
+  // Constructors / Destructor
+  MimeData() = delete;
+  MimeData(const MimeData& other) = delete;
+  explicit MimeData(std::unique_ptr<const BoardClipboardData> data) noexcept
+    : QMimeData(), mId(Uuid::createRandom().toStr()), mData(std::move(data)) {
+    instances().insert(mId, mData.get());
+  }
+  ~MimeData() noexcept { instances().remove(mId); }
+
+  // General Methods
+  static const BoardClipboardData* find(const QString& id) noexcept {
+    return instances().value(id, nullptr);
+  }
+  QStringList formats() const override {
+    return QStringList{
+        getInstanceMimeType(), getBinaryMimeType(), getMimeType(),
+        "application/zip", "text/plain",
+    };
+  }
+
+  // Operator Overloadings
+  MimeData& operator=(const MimeData& rhs) = delete;
+
+protected:
+  QVariant retrieveData(const QString& mimeType,
+                        QVariant::Type type) const override {
+    try {
+      if (mimeType == getInstanceMimeType()) {
+        return mId.toUtf8();
+      } else if (mimeType == getBinaryMimeType()) {
+        if (mBinary.isNull()) {
+          getBoardFile();  // can throw
+          mBinary = mData->exportToBinary();  // can throw
+        }
+        return mBinary;
+      } else if ((mimeType == getMimeType()) ||
+                 (mimeType == "application/zip")) {
+        if (mZip.isNull()) {
+          getBoardFile();  // can throw
+          mZip = mData->mFileSystem->exportToZip();  // can throw
+        }
+        return mZip;
+      } else if (mimeType == "text/plain") {
+        // Note: At least on one system the clipboard didn't work if no text
+        // was set, so let's also copy the SExpression as text as a
+        // workaround. This might be useful anyway, e.g. for debugging.
+        return QString::fromUtf8(getBoardFile());  // can throw
+      }
+    } catch (const Exception& e) {
+      qCritical() << "Failed to serialize clipboard data:" << e.getMsg();
+      return QVariant();
+    }
+    return QMimeData::retrieveData(mimeType, type);
+  }
+
+private:  // Methods
+  const QByteArray& getBoardFile() const {
+    if (mBoardFile.isNull()) {
+      mBoardFile = mData->serializeBoardFile();  // can throw
+      mData->mFileSystem->write("board.lp", mBoardFile);  // can throw
+    }
+    return mBoardFile;
+  }
+  static QHash<QString, const BoardClipboardData*>& instances() noexcept {
+    static QHash<QString, const BoardClipboardData*> instances;
+    return instances;
+  }
+
+private:  // Data
+  const QString mId;
+  const std::unique_ptr<const BoardClipboardData> mData;
+  mutable QByteArray mBoardFile;
+  mutable QByteArray mBinary;
+  mutable QByteArray mZip;
+};
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -55,40 +167,26 @@ BoardClipboardData::BoardClipboardData(const Uuid& boardUuid,
     mPadPositions() {
 }
 
+BoardClipboardData::BoardClipboardData(const BoardClipboardData& other)
+  : BoardClipboardData(other.mBoardUuid, other.mCursorPos) {
+  mDevices = other.mDevices;
+  mNetSegments = other.mNetSegments;
+  mPlanes = other.mPlanes;
+  mZones = other.mZones;
+  mPolygons = other.mPolygons;
+  mStrokeTexts = other.mStrokeTexts;
+  mHoles = other.mHoles;
+  mPadPositions = other.mPadPositions;
+  foreach (const QString& filePath, getFilesRecursively(*other.mFileSystem)) {
+    const QByteArray content = other.mFileSystem->read(filePath);  // can throw
+    mFileSystem->write(filePath, content);  // can throw
+  }
+}
+
 BoardClipboardData::BoardClipboardData(const QByteArray& mimeData)
   : BoardClipboardData(Uuid::createRandom(), Point()) {
   mFileSystem->loadFromZip(mimeData);  // can throw
-
-  SExpression root =
-      SExpression::parse(mFileSystem->read("board.lp"), FilePath());
-  mBoardUuid = deserialize<Uuid>(root.getChild("board/@0"));
-  mCursorPos = Point(root.getChild("cursor_position"));
-  mDevices.loadFromSExpression(root);
-  mNetSegments.loadFromSExpression(root);
-  mPlanes.loadFromSExpression(root);
-
-  foreach (const SExpression* child, root.getChildren("zone")) {
-    mZones.append(BoardZoneData(*child));
-  }
-
-  foreach (const SExpression* child, root.getChildren("polygon")) {
-    mPolygons.append(BoardPolygonData(*child));
-  }
-
-  foreach (const SExpression* child, root.getChildren("stroke_text")) {
-    mStrokeTexts.append(BoardStrokeTextData(*child));
-  }
-
-  foreach (const SExpression* child, root.getChildren("hole")) {
-    mHoles.append(BoardHoleData(*child));
-  }
-
-  foreach (const SExpression* child, root.getChildren("pad_position")) {
-    mPadPositions.insert(
-        std::make_pair(deserialize<Uuid>(child->getChild("device/@0")),
-                       deserialize<Uuid>(child->getChild("pad/@0"))),
-        Point(child->getChild("position")));
-  }
+  loadBoardFile();  // can throw
 }
 
 BoardClipboardData::~BoardClipboardData() noexcept {
@@ -120,6 +218,46 @@ std::unique_ptr<TransactionalDirectory> BoardClipboardData::getDirectory(
  ******************************************************************************/
 
 std::unique_ptr<QMimeData> BoardClipboardData::toMimeData() const {
+  return std::unique_ptr<QMimeData>(new MimeData(
+      std::unique_ptr<const BoardClipboardData>(
+          new BoardClipboardData(*this))));  // can throw
+}
+
+std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
+    const QMimeData* mime) {
+  if (!mime) {
+    return nullptr;
+  }
+
+  // Fast path: If the data was copied within this application instance and is
+  // still on the clipboard, just take a copy of the in-memory data.
+  const QString id = QString::fromUtf8(mime->data(getInstanceMimeType()));
+  if (const BoardClipboardData* data = MimeData::find(id)) {
+    return std::unique_ptr<BoardClipboardData>(
+        new BoardClipboardData(*data));  // can throw
+  }
+
+  // Data copied from another application instance.
+  const QByteArray binary = mime->data(getBinaryMimeType());
+  if (!binary.isNull()) {
+    return importFromBinary(binary);  // can throw
+  }
+
+  // Fallback for applications providing only the ZIP format.
+  const QByteArray zip = mime->data(getMimeType());
+  if (!zip.isNull()) {
+    return std::unique_ptr<BoardClipboardData>(
+        new BoardClipboardData(zip));  // can throw
+  } else {
+    return nullptr;
+  }
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QByteArray BoardClipboardData::serializeBoardFile() const {
   SExpression root = SExpression::createList("librepcb_clipboard_board");
   root.ensureLineBreak();
   mCursorPos.serialize(root.appendList("cursor_position"));
@@ -160,41 +298,87 @@ std::unique_ptr<QMimeData> BoardClipboardData::toMimeData() const {
     root.appendChild(child);
   }
   root.ensureLineBreak();
+  return root.toByteArray();
+}
 
-  const QByteArray sexpr = root.toByteArray();
-  mFileSystem->write("board.lp", sexpr);
-  const QByteArray zip = mFileSystem->exportToZip();
-
-  std::unique_ptr<QMimeData> data(new QMimeData());
-  data->setData(getMimeType(), zip);
-  data->setData("application/zip", zip);
-  // Note: At least on one system the clipboard didn't work if no text was
-  // set, so let's also copy the SExpression as text as a workaround. This
-  // might be useful anyway, e.g. for debugging purposes.
-  data->setText(QString::fromUtf8(sexpr));
-  return data;
+void BoardClipboardData::loadBoardFile() {
+  SExpression root =
+      SExpression::parse(mFileSystem->read("board.lp"), FilePath());
+  mBoardUuid = deserialize<Uuid>(root.getChild("board/@0"));
+  mCursorPos = Point(root.getChild("cursor_position"));
+  mDevices.loadFromSExpression(root);
+  mNetSegments.loadFromSExpression(root);
+  mPlanes.loadFromSExpression(root);
+
+  foreach (const SExpression* child, root.getChildren("zone")) {
+    mZones.append(BoardZoneData(*child));
+  }
+
+  foreach (const SExpression* child, root.getChildren("polygon")) {
+    mPolygons.append(BoardPolygonData(*child));
+  }
+
+  foreach (const SExpression* child, root.getChildren("stroke_text")) {
+    mStrokeTexts.append(BoardStrokeTextData(*child));
+  }
+
+  foreach (const SExpression* child, root.getChildren("hole")) {
+    mHoles.append(BoardHoleData(*child));
+  }
+
+  foreach (const SExpression* child, root.getChildren("pad_position")) {
+    mPadPositions.insert(
+        std::make_pair(deserialize<Uuid>(child->getChild("device/@0")),
+                       deserialize<Uuid>(child->getChild("pad/@0"))),
+        Point(child->getChild("position")));
+  }
 }
 
-std::unique_ptr<BoardClipboardData> BoardClipboardData::fromMimeData(
-    const QMimeData* mime) {
-  QByteArray content = mime ? mime->data(getMimeType()) : QByteArray();
-  if (!content.isNull()) {
-    return std::unique_ptr<BoardClipboardData>(
-        new BoardClipboardData(content));  // can throw
-  } else {
-    return nullptr;
+QByteArray BoardClipboardData::exportToBinary() const {
+  QMap<QString, QByteArray> files;
+  foreach (const QString& filePath, getFilesRecursively(*mFileSystem)) {
+    files.insert(filePath, mFileSystem->read(filePath));  // can throw
   }
+  QByteArray data;
+  QDataStream stream(&data, QIODevice::WriteOnly);
+  stream.setVersion(QDataStream::Qt_5_5);
+  stream << files;
+  return data;
 }
 
-/*******************************************************************************
- *  Private Methods
- ******************************************************************************/
+std::unique_ptr<BoardClipboardData> BoardClipboardData::importFromBinary(
+    const QByteArray& data) {
+  QMap<QString, QByteArray> files;
+  QDataStream stream(data);
+  stream.setVersion(QDataStream::Qt_5_5);
+  stream >> files;
+  if ((stream.status() != QDataStream::Ok) || (!files.contains("board.lp"))) {
+    throw RuntimeError(__FILE__, __LINE__, "Invalid binary clipboard data.");
+  }
+  std::unique_ptr<BoardClipboardData> obj(
+      new BoardClipboardData(Uuid::createRandom(), Point()));
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    obj->mFileSystem->write(it.key(), it.value());  // can throw
+  }
+  obj->loadBoardFile();  // can throw
+  return obj;
+}
 
 QString BoardClipboardData::getMimeType() noexcept {
   return QString("application/x-librepcb-clipboard.board; version=%1")
       .arg(Application::getVersion());
 }
 
+QString BoardClipboardData::getBinaryMimeType() noexcept {
+  return QString("application/x-librepcb-clipboard.board.binary; version=%1")
+      .arg(Application::getVersion());
+}
+
+QString BoardClipboardData::getInstanceMimeType() noexcept {
+  return QString("application/x-librepcb-clipboard.board.instance; version=%1")
+      .arg(Application::getVersion());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -94,6 +94,18 @@ public:
         strokeTexts(strokeTexts),
         onEdited(*this) {}
 
+    Device(const Device& other) noexcept
+      : componentUuid(other.componentUuid),
+        libDeviceUuid(other.libDeviceUuid),
+        libFootprintUuid(other.libFootprintUuid),
+        position(other.position),
+        rotation(other.rotation),
+        mirrored(other.mirrored),
+        locked(other.locked),
+        attributes(other.attributes),
+        strokeTexts(other.strokeTexts),
+        onEdited(*this) {}
+
     explicit Device(const SExpression& node)
       : componentUuid(deserialize<Uuid>(node.getChild("@0"))),
         libDeviceUuid(deserialize<Uuid>(node.getChild("lib_device/@0"))),
@@ -152,6 +164,13 @@ public:
     explicit NetSegment(const tl::optional<CircuitIdentifier>& netName)
       : netName(netName), vias(), junctions(), traces(), onEdited(*this) {}
 
+    NetSegment(const NetSegment& other) noexcept
+      : netName(other.netName),
+        vias(other.vias),
+        junctions(other.junctions),
+        traces(other.traces),
+        onEdited(*this) {}
+
     explicit NetSegment(const SExpression& node)
       : netName(deserialize<tl::optional<CircuitIdentifier>>(
             node.getChild("net/@0"))),
@@ -215,6 +234,21 @@ public:
         locked(locked),
         onEdited(*this) {}
 
+    Plane(const Plane& other) noexcept
+      : uuid(other.uuid),
+        layer(other.layer),
+        netSignalName(other.netSignalName),
+        outline(other.outline),
+        minWidth(other.minWidth),
+        minClearance(other.minClearance),
+        keepIslands(other.keepIslands),
+        priority(other.priority),
+        connectStyle(other.connectStyle),
+        thermalGap(other.thermalGap),
+        thermalSpokeWidth(other.thermalSpokeWidth),
+        locked(other.locked),
+        onEdited(*this) {}
+
     explicit Plane(const SExpression& node)
       : uuid(deserialize<Uuid>(node.getChild("@0"))),
         layer(deserialize<const Layer*>(node.getChild("layer/@0"))),
@@ -269,7 +303,7 @@ public:
 
   // Constructors / Destructor
   BoardClipboardData() = delete;
-  BoardClipboardData(const BoardClipboardData& other) = delete;
+  BoardClipboardData(const BoardClipboardData& other);
   BoardClipboardData(const Uuid& boardUuid, const Point& cursorPos) noexcept;
   explicit BoardClipboardData(const QByteArray& mimeData);
   ~BoardClipboardData() noexcept;
@@ -304,7 +338,17 @@ public:
   BoardClipboardData& operator=(const BoardClipboardData& rhs) = delete;
 
 private:  // Methods
+  QByteArray serializeBoardFile() const;
+  void loadBoardFile();
+  QByteArray exportToBinary() const;
+  static std::unique_ptr<BoardClipboardData> importFromBinary(
+      const QByteArray& data);
   static QString getMimeType() noexcept;
+  static QString getBinaryMimeType() noexcept;
+  static QString getInstanceMimeType() noexcept;
+
+private:  // Types
+  class MimeData;
 
 private:  // Data
   std::shared_ptr<TransactionalFileSystem> mFileSystem;
@@ -523,7 +523,10 @@ void BoardEditor::storeLayersVisibility() noexcept {
         visibility[layer->getName()] = layer->isVisible();
       }
     }
-    board->setLayersVisibility(visibility);
+    if (visibility != board->getLayersVisibility()) {
+      board->setLayersVisibility(visibility);
+      mProject.setBoardModified(*board);
+    }
   }
 }
 
@@ -613,6 +616,8 @@ void BoardEditor::createActions() noexcept {
                     mProjectEditor.execOrderPcbDialog(&dialog);
                   });
           dialog.exec();
+          // The dialog might have modified the settings (without undo command).
+          mProject.setBoardModified(*board);
         }
       }));
   mActionGeneratePickPlace.reset(
@@ -1618,6 +1623,7 @@ void BoardEditor::setGridProperties(const PositiveLength& interval,
   if (activeBoard && applyToBoard) {
     activeBoard->setGridInterval(interval);
     activeBoard->setGridUnit(unit);
+    mProject.setBoardModified(*activeBoard);
   }
 }
 
@@ -47,6 +47,9 @@
 #include <librepcb/core/project/board/items/bi_stroketext.h>
 #include <librepcb/core/project/board/items/bi_via.h>
 #include <librepcb/core/project/board/items/bi_zone.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/componentsignalinstance.h>
+#include <librepcb/core/project/circuit/netsignal.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/types/layer.h>
 
@@ -70,7 +73,8 @@ BoardGraphicsScene::BoardGraphicsScene(
   : GraphicsScene(parent),
     mBoard(board),
     mLayerProvider(lp),
-    mHighlightedNetSignals(highlightedNetSignals) {
+    mHighlightedNetSignals(highlightedNetSignals),
+    mAppliedHighlightedNetSignals(*highlightedNetSignals) {
   foreach (BI_Device* obj, mBoard.getDeviceInstances()) {
     addDevice(*obj);
   }
@@ -164,6 +168,17 @@ BoardGraphicsScene::~BoardGraphicsScene() noexcept {
  *  General Methods
  ******************************************************************************/
 
+QHash<BI_Device*, std::shared_ptr<BGI_Device>>
+    BoardGraphicsScene::getDevicesInArea(const QRectF& rect) const noexcept {
+  QHash<BI_Device*, std::shared_ptr<BGI_Device>> result;
+  for (auto it = mDevices.begin(); it != mDevices.end(); it++) {
+    if (it.value()->sceneBoundingRect().intersects(rect)) {
+      result.insert(it.key(), it.value());
+    }
+  }
+  return result;
+}
+
 void BoardGraphicsScene::selectAll() noexcept {
   foreach (auto item, mDevices) {
     item->setSelected(true);
@@ -296,20 +311,54 @@ void BoardGraphicsScene::clearSelection() noexcept {
 }
 
 void BoardGraphicsScene::updateHighlightedNetSignals() noexcept {
-  foreach (auto item, mFootprintPads) {
-    item->updateHighlightedNetSignals();
-  }
-  foreach (auto item, mVias) {
-    item->update();
-  }
-  foreach (auto item, mNetLines) {
-    item->update();
-  }
-  foreach (auto item, mPlanes) {
-    item->update();
-  }
-  foreach (auto item, mAirWires) {
-    item->update();
+  // Only repaint the items of nets whose highlight state has changed. The
+  // items of a net are determined by the elements registered in the net
+  // signal, so we don't need to iterate over all items of the board. Note
+  // that Qt merges the dirty regions of all updated items into a single
+  // viewport update. The net signals are looked up in the circuit since the
+  // previously highlighted ones might have been removed in the meantime.
+  const QSet<const NetSignal*>& highlighted = *mHighlightedNetSignals;
+  const QSet<const NetSignal*> changed =
+      (highlighted | mAppliedHighlightedNetSignals) -
+      (highlighted & mAppliedHighlightedNetSignals);
+  mAppliedHighlightedNetSignals = highlighted;
+
+  foreach (const NetSignal* netSignal,
+           mBoard.getProject().getCircuit().getNetSignals()) {
+    if (!changed.contains(netSignal)) {
+      continue;
+    }
+    foreach (const ComponentSignalInstance* cmpSig,
+             netSignal->getComponentSignals()) {
+      foreach (BI_FootprintPad* pad, cmpSig->getRegisteredFootprintPads()) {
+        if (auto item = mFootprintPads.value(pad)) {
+          item->updateHighlightedNetSignals();
+        }
+      }
+    }
+    foreach (const BI_NetSegment* netSegment,
+             netSignal->getBoardNetSegments()) {
+      foreach (BI_Via* via, netSegment->getVias()) {
+        if (auto item = mVias.value(via)) {
+          item->update();
+        }
+      }
+      foreach (BI_NetLine* netLine, netSegment->getNetLines()) {
+        if (auto item = mNetLines.value(netLine)) {
+          item->update();
+        }
+      }
+    }
+    foreach (BI_Plane* plane, netSignal->getBoardPlanes()) {
+      if (auto item = mPlanes.value(plane)) {
+        item->update();
+      }
+    }
+    foreach (BI_AirWire* airWire, mAirWiresByNetSignal.values(netSignal)) {
+      if (auto item = mAirWires.value(airWire)) {
+        item->update();
+      }
+    }
   }
 }
 
@@ -583,10 +632,12 @@ void BoardGraphicsScene::addAirWire(BI_AirWire& airWire) noexcept {
       airWire, mLayerProvider, mHighlightedNetSignals);
   addItem(*item);
   mAirWires.insert(&airWire, item);
+  mAirWiresByNetSignal.insert(&airWire.getNetSignal(), &airWire);
 }
 
 void BoardGraphicsScene::removeAirWire(BI_AirWire& airWire) noexcept {
   if (std::shared_ptr<BGI_AirWire> item = mAirWires.take(&airWire)) {
+    mAirWiresByNetSignal.remove(&airWire.getNetSignal(), &airWire);
     removeItem(*item);
   } else {
     Q_ASSERT(false);
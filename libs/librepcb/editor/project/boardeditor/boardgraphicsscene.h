@@ -164,6 +164,22 @@ public:
   }
 
   // General Methods
+
+  /**
+   * @brief Get all devices whose bounding rect intersects a given area
+   *
+   * Device items have no contents on their own, thus the scene index only
+   * reports their (visible) child items. Use this method instead of
+   * ::librepcb::editor::GraphicsScene::getItemsInArea() to find devices,
+   * independent of the visibility of their child items.
+   *
+   * @param rect    The area in scene coordinates.
+   *
+   * @return All devices located within the area.
+   */
+  QHash<BI_Device*, std::shared_ptr<BGI_Device>> getDevicesInArea(
+      const QRectF& rect) const noexcept;
+
   void selectAll() noexcept;
   void selectItemsInRect(const Point& p1, const Point& p2) noexcept;
   void selectNetSegment(BI_NetSegment& netSegment) noexcept;
@@ -211,6 +227,7 @@ private:  // Data
   Board& mBoard;
   const IF_GraphicsLayerProvider& mLayerProvider;
   std::shared_ptr<const QSet<const NetSignal*>> mHighlightedNetSignals;
+  QSet<const NetSignal*> mAppliedHighlightedNetSignals;
   QHash<BI_Device*, std::shared_ptr<BGI_Device>> mDevices;
   QHash<BI_FootprintPad*, std::shared_ptr<BGI_FootprintPad>> mFootprintPads;
   QHash<BI_Via*, std::shared_ptr<BGI_Via>> mVias;
@@ -222,6 +239,7 @@ private:  // Data
   QHash<BI_StrokeText*, std::shared_ptr<BGI_StrokeText>> mStrokeTexts;
   QHash<BI_Hole*, std::shared_ptr<BGI_Hole>> mHoles;
   QHash<BI_AirWire*, std::shared_ptr<BGI_AirWire>> mAirWires;
+  QMultiHash<const NetSignal*, BI_AirWire*> mAirWiresByNetSignal;
 };
 
 /*******************************************************************************
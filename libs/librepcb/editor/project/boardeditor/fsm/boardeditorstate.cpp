@@ -177,6 +177,16 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   const QPainterPath posAreaLarge =
       mContext.editorGraphicsView.calcPosWithTolerance(pos, 1.5);
 
+  // Only process items close to the cursor, determined by the spatial index
+  // of the graphics scene. Checking the exact shape of every item on the
+  // board would be way too slow for large boards.
+  const QRectF posAreaRect = posAreaLarge.boundingRect();
+  const QRectF areaRect = QPolygonF(QVector<QPointF>{posAreaRect.topLeft(),
+                                                     posAreaRect.bottomRight(),
+                                                     posOnGrid})
+                              .boundingRect();
+  const QSet<QGraphicsItem*> itemsInArea = scene->getItemsInArea(areaRect);
+
   // Note: The order of adding the items is very important (the top most item
   // must appear as the first item in the list)! For that, we work with
   // priorities (0 = highest priority):
@@ -287,8 +297,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   };
 
   if (flags.testFlag(FindFlag::Holes)) {
-    for (auto it = scene->getHoles().begin(); it != scene->getHoles().end();
-         it++) {
+    const auto holes =
+        GraphicsScene::filterItems(scene->getHoles(), itemsInArea,
+                                   &BGI_Hole::getHole);
+    for (auto it = holes.begin(); it != holes.end(); it++) {
       processItem(it.value(),
                   it.key()->getData().getPath()->getVertices().first().getPos(),
                   5, false);
@@ -296,8 +308,9 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Vias)) {
-    for (auto it = scene->getVias().begin(); it != scene->getVias().end();
-         it++) {
+    const auto vias = GraphicsScene::filterItems(scene->getVias(), itemsInArea,
+                                                 &BGI_Via::getVia);
+    for (auto it = vias.begin(); it != vias.end(); it++) {
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         if ((!cuLayer) || (it.key()->getVia().isOnLayer(*cuLayer))) {
@@ -308,8 +321,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::NetPoints)) {
-    for (auto it = scene->getNetPoints().begin();
-         it != scene->getNetPoints().end(); it++) {
+    const auto netPoints =
+        GraphicsScene::filterItems(scene->getNetPoints(), itemsInArea,
+                                   &BGI_NetPoint::getNetPoint);
+    for (auto it = netPoints.begin(); it != netPoints.end(); it++) {
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         const Layer* layer = it.key()->getLayerOfTraces();
@@ -322,8 +337,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::NetLines)) {
-    for (auto it = scene->getNetLines().begin();
-         it != scene->getNetLines().end(); it++) {
+    const auto netLines =
+        GraphicsScene::filterItems(scene->getNetLines(), itemsInArea,
+                                   &BGI_NetLine::getNetLine);
+    for (auto it = netLines.begin(); it != netLines.end(); it++) {
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getNetSegment().getNetSignal())) {
         const Layer& layer = it.key()->getLayer();
@@ -340,8 +357,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Planes)) {
-    for (auto it = scene->getPlanes().begin(); it != scene->getPlanes().end();
-         it++) {
+    const auto planes =
+        GraphicsScene::filterItems(scene->getPlanes(), itemsInArea,
+                                   &BGI_Plane::getPlane);
+    for (auto it = planes.begin(); it != planes.end(); it++) {
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getNetSignal())) {
         if ((!cuLayer) || (*cuLayer == it.key()->getLayer())) {
@@ -356,8 +375,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Zones)) {
-    for (auto it = scene->getZones().begin(); it != scene->getZones().end();
-         it++) {
+    const auto zones =
+        GraphicsScene::filterItems(scene->getZones(), itemsInArea,
+                                   &BGI_Zone::getZone);
+    for (auto it = zones.begin(); it != zones.end(); it++) {
       if ((!cuLayer) || (it.key()->getData().getLayers().contains(&*cuLayer))) {
         QList<const Layer*> layers = it.key()->getData().getLayers().toList();
         std::sort(layers.begin(), layers.end(), &Layer::lessThan);
@@ -376,16 +397,20 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Devices)) {
-    for (auto it = scene->getDevices().begin(); it != scene->getDevices().end();
-         it++) {
+    // Note: Devices are not reported by getItemsInArea() if all of their
+    // child items are invisible, e.g. when the grab area layer is hidden.
+    const auto devices = scene->getDevicesInArea(areaRect);
+    for (auto it = devices.begin(); it != devices.end(); it++) {
       processItem(it.value(), it.key()->getPosition(),
                   40 + (it.key()->getMirrored() ? 300 : 100), false);
     }
   }
 
   if (flags.testFlag(FindFlag::FootprintPads)) {
-    for (auto it = scene->getFootprintPads().begin();
-         it != scene->getFootprintPads().end(); it++) {
+    const auto pads =
+        GraphicsScene::filterItems(scene->getFootprintPads(), itemsInArea,
+                                   &BGI_FootprintPad::getPad);
+    for (auto it = pads.begin(); it != pads.end(); it++) {
       if (netsignals.isEmpty() ||
           netsignals.contains(it.key()->getCompSigInstNetSignal())) {
         if ((!cuLayer) || (it.key()->isOnLayer(*cuLayer))) {
@@ -397,8 +422,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Polygons)) {
-    for (auto it = scene->getPolygons().begin();
-         it != scene->getPolygons().end(); it++) {
+    const auto polygons =
+        GraphicsScene::filterItems(scene->getPolygons(), itemsInArea,
+                                   &BGI_Polygon::getPolygon);
+    for (auto it = polygons.begin(); it != polygons.end(); it++) {
       processItem(
           it.value(),
           it.key()->getData().getPath().calcNearestPointBetweenVertices(pos),
@@ -408,8 +435,10 @@ QList<std::shared_ptr<QGraphicsItem>> BoardEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::StrokeTexts)) {
-    for (auto it = scene->getStrokeTexts().begin();
-         it != scene->getStrokeTexts().end(); it++) {
+    const auto strokeTexts =
+        GraphicsScene::filterItems(scene->getStrokeTexts(), itemsInArea,
+                                   &BGI_StrokeText::getStrokeText);
+    for (auto it = strokeTexts.begin(); it != strokeTexts.end(); it++) {
       processItem(it.value(), it.key()->getData().getPosition(),
                   60 + priorityFromLayer(it.key()->getData().getLayer()),
                   false);
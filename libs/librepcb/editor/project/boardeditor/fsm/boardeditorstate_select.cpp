@@ -175,6 +175,8 @@ bool BoardEditorState_Select::processImportDxf() noexcept {
       // Read DXF file.
       DxfReader import;
       import.setScaleFactor(dialog.getScaleFactor());
+      import.setLayerFilter(dialog.getDxfLayers());
+      import.setMergePolylines(dialog.getJoinTangentPolylines());
       import.parse(fp);  // can throw
 
       // If enabled, join tangent paths.
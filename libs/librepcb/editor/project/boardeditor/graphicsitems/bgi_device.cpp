@@ -84,6 +84,7 @@ BGI_Device::BGI_Device(BI_Device& device,
     auto i = std::make_shared<PrimitivePathGraphicsItem>(this);
     i->setPath(obj.getPathForRendering().toQPainterPathPx());
     i->setLineWidth(obj.getLineWidth());
+    i->setLevelOfDetailEnabled(true);
     i->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
     if (obj.isGrabArea()) {
       mShape |= Toolbox::shapeFromPath(obj.getPath().toQPainterPathPx(),
@@ -108,6 +109,12 @@ BGI_Device::BGI_Device(BI_Device& device,
     mHoleGraphicsItems.append(i);
   }
 
+  // Note: Since this item has no contents on its own, its bounding rect is
+  // not used for painting, but it allows to find devices by area even if
+  // all of their child items are invisible.
+  mBoundingRect =
+      mShape.boundingRect() | mOriginCrossGraphicsItem->boundingRect();
+
   updatePosition();
   updateRotationAndMirrored();
   updateBoardSide();
@@ -74,6 +74,7 @@ public:
   BI_Device& getDevice() noexcept { return mDevice; }
 
   // Inherited from QGraphicsItem
+  QRectF boundingRect() const noexcept override { return mBoundingRect; }
   QPainterPath shape() const noexcept override;
 
   // Operator Overloadings
@@ -102,6 +103,7 @@ private:  // Data
   QVector<std::shared_ptr<PrimitiveZoneGraphicsItem>> mZoneGraphicsItems;
   QVector<std::shared_ptr<PrimitiveHoleGraphicsItem>> mHoleGraphicsItems;
   QPainterPath mShape;
+  QRectF mBoundingRect;
 
   // Slots
   BI_Device::OnEditedSlot mOnEditedSlot;
@@ -62,6 +62,7 @@ BGI_FootprintPad::BGI_FootprintPad(BI_FootprintPad& pad,
   mGraphicsItem->setRotation(mPad.getRotation());
   mGraphicsItem->setMirrored(mPad.getMirrored());
   mGraphicsItem->setText(mPad.getText());
+  mGraphicsItem->setLevelOfDetailEnabled(true);
   mGraphicsItem->setGeometries(mPad.getGeometries(),
                                *mPad.getLibPad().getCopperClearance());
   updateLayer();
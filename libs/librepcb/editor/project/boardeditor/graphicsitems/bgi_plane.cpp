@@ -39,6 +39,33 @@
 namespace librepcb {
 namespace editor {
 
+/*******************************************************************************
+ *  Local Functions
+ ******************************************************************************/
+
+static QPainterPath decimatePath(const Path& path,
+                                 const Length& tolerance) noexcept {
+  const QVector<Vertex>& vertices = path.getVertices();
+  QVector<QPointF> points;
+  points.reserve(vertices.count());
+  Point lastPos;
+  for (int i = 0; i < vertices.count(); ++i) {
+    const Point& pos = vertices.at(i).getPos();
+    if (vertices.at(i).getAngle() != Angle::deg0()) {
+      return path.toQPainterPathPx();  // Arcs are not supported, keep as-is.
+    } else if (points.isEmpty() || (i == vertices.count() - 1) ||
+               (*(pos - lastPos).getLength() >= tolerance)) {
+      points.append(pos.toPxQPointF());
+      lastPos = pos;
+    }
+  }
+  QPainterPath result;
+  if (points.count() > 3) {  // Fragments smaller than a pixel are omitted.
+    result.addPolygon(QPolygonF(points));
+  }
+  return result;
+}
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -59,6 +86,10 @@ BGI_Plane::BGI_Plane(BI_Plane& plane, const IF_GraphicsLayerProvider& lp,
     mOnLayerEditedSlot(*this, &BGI_Plane::layerEdited) {
   setFlag(QGraphicsItem::ItemIsSelectable, true);
 
+  // Planes might consist of a huge number of vertices, so keep the rendered
+  // pixmap and only repaint it when the plane or the zoom level has changed.
+  setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+
   updateOutlineAndFragments();
   updateLayer();
   updateVisibility();
@@ -180,7 +211,7 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     if (mPlane.isVisible()) {
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(highlight));
-      foreach (const QPainterPath& area, mAreas) {
+      foreach (const QPainterPath& area, getAreas(lod)) {
         painter->drawPath(area);
       }
     }
@@ -264,6 +295,7 @@ void BGI_Plane::updateOutlineAndFragments() noexcept {
 
   // get areas
   mAreas.clear();
+  mDecimatedAreas.clear();
   for (const Path& r : mPlane.getFragments()) {
     mAreas.append(r.toQPainterPathPx());
     mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
@@ -272,6 +304,27 @@ void BGI_Plane::updateOutlineAndFragments() noexcept {
   updateBoundingRectMargin();
 }
 
+const QVector<QPainterPath>& BGI_Plane::getAreas(qreal lod) noexcept {
+  // Unless zoomed in very far, draw decimated areas with a tolerance of less
+  // than one device pixel since rendering all vertices (e.g. of flattened
+  // arcs) is slow and makes no visible difference. The LOD is quantized to
+  // powers of two to limit the number of cached paths.
+  if ((!(lod > 0)) || (lod >= 64)) {
+    return mAreas;
+  }
+  const int level = std::max(qFloor(std::log2(lod)), -30);
+  auto it = mDecimatedAreas.find(level);
+  if (it == mDecimatedAreas.end()) {
+    const Length tolerance = Length::fromPx(std::ldexp(0.5, -level));
+    QVector<QPainterPath> areas;
+    for (const Path& fragment : mPlane.getFragments()) {
+      areas.append(decimatePath(fragment, tolerance));
+    }
+    it = mDecimatedAreas.insert(level, areas);
+  }
+  return *it;
+}
+
 void BGI_Plane::updateLayer() noexcept {
   if (mPlane.getLayer() == Layer::topCopper()) {
     setZValue(BoardGraphicsScene::ZValue_PlanesTop);
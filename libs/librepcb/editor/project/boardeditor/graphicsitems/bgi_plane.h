@@ -101,6 +101,7 @@ private:  // Methods
   void layerEdited(const GraphicsLayer& layer,
                    GraphicsLayer::Event event) noexcept;
   void updateOutlineAndFragments() noexcept;
+  const QVector<QPainterPath>& getAreas(qreal lod) noexcept;
   void updateLayer() noexcept;
   void updateVisibility() noexcept;
   void updateBoundingRectMargin() noexcept;
@@ -118,6 +119,7 @@ private:  // Data
   QPainterPath mShape;
   QPainterPath mOutline;
   QVector<QPainterPath> mAreas;
+  QHash<int, QVector<QPainterPath>> mDecimatedAreas;  ///< Key: LOD level
   qreal mLineWidthPx;
   qreal mVertexHandleRadiusPx;
   struct VertexHandle {
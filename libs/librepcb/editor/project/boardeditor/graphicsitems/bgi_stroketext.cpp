@@ -59,6 +59,7 @@ BGI_StrokeText::BGI_StrokeText(BI_StrokeText& text,
   setFlag(QGraphicsItem::ItemIsSelectable, true);
 
   mOriginCrossGraphicsItem->setSize(UnsignedLength(1000000));
+  mPathGraphicsItem->setLevelOfDetailEnabled(true);
 
   updatePosition();
   updateTransform();
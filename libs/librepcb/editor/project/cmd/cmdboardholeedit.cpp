@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardholeedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_hole.h>
 
 #include <QtCore>
@@ -109,6 +110,12 @@ void CmdBoardHoleEdit::setLocked(bool locked) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardHoleEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mHole.getBoard());
+  return true;
+}
+
 bool CmdBoardHoleEdit::performExecute() {
   performRedo();  // can throw
   return (mNewData != mOldData);
@@ -65,6 +65,10 @@ public:
   void setStopMaskConfig(const MaskConfig& config) noexcept;
   void setLocked(bool locked) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
   // Operator Overloadings
   CmdBoardHoleEdit& operator=(const CmdBoardHoleEdit& rhs) = delete;
 
@@ -22,6 +22,8 @@
  ******************************************************************************/
 #include "cmdboardnetlineedit.h"
 
+#include <librepcb/core/project/board/board.h>
+
 #include <QtCore>
 
 /*******************************************************************************
@@ -64,6 +66,12 @@ void CmdBoardNetLineEdit::setWidth(const PositiveLength& width) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetLineEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetLine.getBoard());
+  return true;
+}
+
 bool CmdBoardNetLineEdit::performExecute() {
   performRedo();  // can throw
 
@@ -58,6 +58,10 @@ public:
   void setLayer(const Layer& layer) noexcept;
   void setWidth(const PositiveLength& width) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:  // Methods
   /// @copydoc ::librepcb::editor::UndoCommand::performExecute()
   bool performExecute() override;
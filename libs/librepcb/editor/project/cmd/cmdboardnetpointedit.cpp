@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardnetpointedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_netpoint.h>
 
 #include <QtCore>
@@ -83,6 +84,12 @@ void CmdBoardNetPointEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetPointEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetPoint.getBoard());
+  return true;
+}
+
 bool CmdBoardNetPointEdit::performExecute() {
   performRedo();  // can throw
 
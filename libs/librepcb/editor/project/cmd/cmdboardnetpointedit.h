@@ -57,6 +57,10 @@ public:
   void snapToGrid(const PositiveLength& gridInterval, bool immediate) noexcept;
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
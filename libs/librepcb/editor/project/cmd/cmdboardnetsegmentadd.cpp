@@ -59,6 +59,12 @@ CmdBoardNetSegmentAdd::~CmdBoardNetSegmentAdd() noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetSegmentAdd::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mBoard);
+  return true;
+}
+
 bool CmdBoardNetSegmentAdd::performExecute() {
   if (!mNetSegment) {
     // create new net segment
@@ -55,6 +55,10 @@ public:
   // Getters
   BI_NetSegment* getNetSegment() const noexcept { return mNetSegment; }
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -22,9 +22,11 @@
  ******************************************************************************/
 #include "cmdboardnetsegmentaddelements.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_netline.h>
 #include <librepcb/core/project/board/items/bi_netpoint.h>
 #include <librepcb/core/project/board/items/bi_netsegment.h>
+#include <librepcb/core/project/board/items/bi_via.h>
 
 #include <QtCore>
 
@@ -89,6 +91,19 @@ BI_NetLine* CmdBoardNetSegmentAddElements::addNetLine(
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetSegmentAddElements::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetSegment.getBoard());
+  return true;
+}
+
+std::size_t CmdBoardNetSegmentAddElements::getMemoryUsage() const noexcept {
+  // Rough estimate since the added elements are kept alive for redo.
+  return UndoCommand::getMemoryUsage() + (mVias.count() * sizeof(BI_Via)) +
+      (mNetPoints.count() * sizeof(BI_NetPoint)) +
+      (mNetLines.count() * sizeof(BI_NetLine));
+}
+
 bool CmdBoardNetSegmentAddElements::performExecute() {
   performRedo();  // can throw
 
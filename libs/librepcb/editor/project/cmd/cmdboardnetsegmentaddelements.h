@@ -66,6 +66,11 @@ public:
                          BI_NetLineAnchor& endPoint, const Layer& layer,
                          const PositiveLength& width);
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+  std::size_t getMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -51,6 +51,12 @@ CmdBoardNetSegmentRemove::~CmdBoardNetSegmentRemove() noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetSegmentRemove::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mBoard);
+  return true;
+}
+
 bool CmdBoardNetSegmentRemove::performExecute() {
   performRedo();  // can throw
 
@@ -50,6 +50,10 @@ public:
   explicit CmdBoardNetSegmentRemove(BI_NetSegment& segment) noexcept;
   ~CmdBoardNetSegmentRemove() noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
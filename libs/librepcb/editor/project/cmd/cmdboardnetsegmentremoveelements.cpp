@@ -67,6 +67,12 @@ void CmdBoardNetSegmentRemoveElements::removeNetLine(BI_NetLine& netline) {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetSegmentRemoveElements::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetSegment.getBoard());
+  return true;
+}
+
 bool CmdBoardNetSegmentRemoveElements::performExecute() {
   performRedo();  // can throw
 
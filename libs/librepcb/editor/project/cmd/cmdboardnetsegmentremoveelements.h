@@ -57,6 +57,10 @@ public:
   void removeNetPoint(BI_NetPoint& netpoint);
   void removeNetLine(BI_NetLine& netline);
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -163,6 +163,18 @@ void CmdBoardPlaneEdit::setLocked(bool locked) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardPlaneEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mPlane.getBoard());
+  return true;
+}
+
+std::size_t CmdBoardPlaneEdit::getMemoryUsage() const noexcept {
+  return UndoCommand::getMemoryUsage() +
+      (mOldOutline.getVertices().count() + mNewOutline.getVertices().count()) *
+      sizeof(Vertex);
+}
+
 bool CmdBoardPlaneEdit::performExecute() {
   performRedo();  // can throw
 
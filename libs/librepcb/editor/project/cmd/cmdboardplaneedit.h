@@ -71,6 +71,11 @@ public:
   void setKeepIslands(bool keep) noexcept;
   void setLocked(bool locked) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+  std::size_t getMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardpolygonedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_polygon.h>
 #include <librepcb/core/types/layer.h>
 
@@ -127,6 +128,19 @@ void CmdBoardPolygonEdit::setLocked(bool locked) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardPolygonEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mPolygon.getBoard());
+  return true;
+}
+
+std::size_t CmdBoardPolygonEdit::getMemoryUsage() const noexcept {
+  return UndoCommand::getMemoryUsage() +
+      (mOldData.getPath().getVertices().count() +
+       mNewData.getPath().getVertices().count()) *
+      sizeof(Vertex);
+}
+
 bool CmdBoardPolygonEdit::performExecute() {
   performRedo();  // can throw
   return (mNewData != mOldData);
@@ -71,6 +71,11 @@ public:
   void mirrorLayer(int innerLayerCount, bool immediate) noexcept;
   void setLocked(bool locked) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+  std::size_t getMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdBoardPolygonEdit& operator=(const CmdBoardPolygonEdit& rhs) = delete;
 
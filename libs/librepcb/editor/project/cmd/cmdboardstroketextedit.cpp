@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardstroketextedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_stroketext.h>
 #include <librepcb/core/types/layer.h>
 
@@ -203,6 +204,12 @@ void CmdBoardStrokeTextEdit::setLocked(bool locked) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardStrokeTextEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mText.getBoard());
+  return true;
+}
+
 bool CmdBoardStrokeTextEdit::performExecute() {
   performRedo();  // can throw
 
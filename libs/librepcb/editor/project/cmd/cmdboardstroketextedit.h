@@ -79,6 +79,10 @@ public:
   void setAutoRotate(bool autoRotate, bool immediate) noexcept;
   void setLocked(bool locked) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:  // Methods
   /// @copydoc ::librepcb::editor::UndoCommand::performExecute()
   bool performExecute() override;
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardviaedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_via.h>
 #include <librepcb/core/types/layer.h>
 
@@ -128,6 +129,12 @@ void CmdBoardViaEdit::setExposureConfig(const MaskConfig& config) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardViaEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mVia.getBoard());
+  return true;
+}
+
 bool CmdBoardViaEdit::performExecute() {
   performRedo();  // can throw
 
@@ -64,6 +64,10 @@ public:
                         bool immediate) noexcept;
   void setExposureConfig(const MaskConfig& config) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmdboardzoneedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_zone.h>
 #include <librepcb/core/types/layer.h>
 
@@ -111,6 +112,19 @@ void CmdBoardZoneEdit::setLocked(bool locked) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardZoneEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mZone.getBoard());
+  return true;
+}
+
+std::size_t CmdBoardZoneEdit::getMemoryUsage() const noexcept {
+  return UndoCommand::getMemoryUsage() +
+      (mOldData.getOutline().getVertices().count() +
+       mNewData.getOutline().getVertices().count()) *
+      sizeof(Vertex);
+}
+
 bool CmdBoardZoneEdit::performExecute() {
   performRedo();  // can throw
   return (mNewData != mOldData);
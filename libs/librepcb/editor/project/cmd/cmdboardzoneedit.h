@@ -66,6 +66,11 @@ public:
   void mirrorLayers(int innerLayers, bool immediate);
   void setLocked(bool locked) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+  std::size_t getMemoryUsage() const noexcept override;
+
   // Operator Overloadings
   CmdBoardZoneEdit& operator=(const CmdBoardZoneEdit& rhs) = delete;
 
@@ -22,6 +22,7 @@
  ******************************************************************************/
 #include "cmddeviceinstanceedit.h"
 
+#include <librepcb/core/project/board/board.h>
 #include <librepcb/core/project/board/items/bi_device.h>
 #include <librepcb/core/utils/scopeguardlist.h>
 
@@ -133,6 +134,12 @@ void CmdDeviceInstanceEdit::setModel(const tl::optional<Uuid>& uuid) noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdDeviceInstanceEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mDevice.getBoard());
+  return true;
+}
+
 bool CmdDeviceInstanceEdit::performExecute() {
   performRedo();  // can throw
 
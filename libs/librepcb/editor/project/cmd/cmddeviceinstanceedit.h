@@ -66,6 +66,10 @@ public:
   void setLocked(bool locked);
   void setModel(const tl::optional<Uuid>& uuid) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -90,6 +90,33 @@ CmdDragSelectedBoardItems::CmdDragSelectedBoardItems(
   query.addSelectedHoles();
 
   // find the center of all elements and create undo commands
+  foreach (BI_Device* device, query.getDeviceInstances()) {
+    mItems.insert(device);
+  }
+  foreach (BI_Via* via, query.getVias()) {
+    mItems.insert(via);
+  }
+  foreach (BI_NetPoint* netpoint, query.getNetPoints()) {
+    mItems.insert(netpoint);
+  }
+  foreach (BI_NetLine* netline, query.getNetLines()) {
+    mItems.insert(netline);
+  }
+  foreach (BI_Plane* plane, query.getPlanes()) {
+    mItems.insert(plane);
+  }
+  foreach (BI_Zone* zone, query.getZones()) {
+    mItems.insert(zone);
+  }
+  foreach (BI_Polygon* polygon, query.getPolygons()) {
+    mItems.insert(polygon);
+  }
+  foreach (BI_StrokeText* text, query.getStrokeTexts()) {
+    mItems.insert(text);
+  }
+  foreach (BI_Hole* hole, query.getHoles()) {
+    mItems.insert(hole);
+  }
   foreach (BI_Device* device, query.getDeviceInstances()) {
     Q_ASSERT(device);
     mCenterPos += device->getPosition();
@@ -358,6 +385,26 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdDragSelectedBoardItems::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mScene.getBoard());
+  return true;
+}
+
+bool CmdDragSelectedBoardItems::mergeWith(UndoCommand& other) noexcept {
+  // Merge consecutive moves of the same items (e.g. when moving them step by
+  // step with the arrow keys) into a single undo step.
+  CmdDragSelectedBoardItems* cmd =
+      dynamic_cast<CmdDragSelectedBoardItems*>(&other);
+  if (cmd && (&cmd->mScene == &mScene) && isMoveOnly() && cmd->isMoveOnly() &&
+      (cmd->mItems == mItems)) {
+    takeChildsFrom(*cmd);
+    mDeltaPos += cmd->mDeltaPos;
+    return true;
+  }
+  return false;
+}
+
 bool CmdDragSelectedBoardItems::performExecute() {
   if (mDeltaPos.isOrigin() && (mDeltaAngle == Angle::deg0()) &&
       (!mSnappedToGrid) && (!mTextsReset) && (!mLockedChanged) &&
@@ -426,6 +473,12 @@ bool CmdDragSelectedBoardItems::performExecute() {
   return UndoCommandGroup::performExecute();  // can throw
 }
 
+bool CmdDragSelectedBoardItems::isMoveOnly() const noexcept {
+  return (!mDeltaPos.isOrigin()) && (mDeltaAngle == Angle::deg0()) &&
+      (!mSnappedToGrid) && (!mTextsReset) && (!mLockedChanged) &&
+      (!mLineWidthChanged);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -34,6 +34,9 @@
  *  Namespace / Forward Declarations
  ******************************************************************************/
 namespace librepcb {
+
+class BI_Base;
+
 namespace editor {
 
 class BoardGraphicsScene;
@@ -77,6 +80,11 @@ public:
   }
   UnsignedLength getMedianLineWidth() const noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+  bool mergeWith(UndoCommand& other) noexcept override;
+
   // General Methods
   void snapToGrid() noexcept;
   void setLocked(bool locked) noexcept;
@@ -92,8 +100,11 @@ private:
   /// @copydoc ::librepcb::editor::UndoCommand::performExecute()
   bool performExecute() override;
 
+  bool isMoveOnly() const noexcept;
+
   // Private Member Variables
   BoardGraphicsScene& mScene;
+  QSet<const BI_Base*> mItems;
   int mItemCount;
   Point mStartPos;
   Point mDeltaPos;
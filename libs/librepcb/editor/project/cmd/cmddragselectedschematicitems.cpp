@@ -214,6 +214,12 @@ void CmdDragSelectedSchematicItems::mirror(
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdDragSelectedSchematicItems::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mScene.getSchematic());
+  return true;
+}
+
 bool CmdDragSelectedSchematicItems::performExecute() {
   if (mDeltaPos.isOrigin() && (mDeltaAngle == Angle::deg0()) && (!mMirrored) &&
       (!mTextsReset)) {
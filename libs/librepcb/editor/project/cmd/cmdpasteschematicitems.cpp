@@ -171,9 +171,9 @@ bool CmdPasteSchematicItems::performExecute() {
     copy->setValue(cmp.value);
     copy->setAttributes(cmp.attributes);
     ComponentAssemblyOptionList assemblyOptions = cmp.assemblyOptions;
-    for (ComponentAssemblyOption& option : assemblyOptions) {
-      option.setAssemblyVariants(
-          convertAssemblyVariants(option.getAssemblyVariants()));
+    for (const auto& option : assemblyOptions.values()) {
+      option->setAssemblyVariants(
+          convertAssemblyVariants(option->getAssemblyVariants()));
     }
     copy->setAssemblyOptions(assemblyOptions);
     copy->setLockAssembly(cmp.lockAssembly);
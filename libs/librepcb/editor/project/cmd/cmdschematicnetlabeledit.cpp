@@ -23,6 +23,7 @@
 #include "cmdschematicnetlabeledit.h"
 
 #include <librepcb/core/project/schematic/items/si_netlabel.h>
+#include <librepcb/core/project/schematic/schematic.h>
 
 #include <QtCore>
 
@@ -119,6 +120,12 @@ void CmdSchematicNetLabelEdit::mirror(Qt::Orientation orientation,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetLabelEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetLabel.getSchematic());
+  return true;
+}
+
 bool CmdSchematicNetLabelEdit::performExecute() {
   performRedo();  // can throw
 
@@ -23,6 +23,7 @@
 #include "cmdschematicnetpointedit.h"
 
 #include <librepcb/core/project/schematic/items/si_netpoint.h>
+#include <librepcb/core/project/schematic/schematic.h>
 
 #include <QtCore>
 
@@ -86,6 +87,12 @@ void CmdSchematicNetPointEdit::mirror(Qt::Orientation orientation,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetPointEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetPoint.getSchematic());
+  return true;
+}
+
 bool CmdSchematicNetPointEdit::performExecute() {
   performRedo();  // can throw
 
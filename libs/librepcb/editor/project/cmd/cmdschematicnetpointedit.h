@@ -58,6 +58,10 @@ public:
   void mirror(Qt::Orientation orientation, const Point& center,
               bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
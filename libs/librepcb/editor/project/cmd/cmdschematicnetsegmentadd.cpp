@@ -60,6 +60,12 @@ CmdSchematicNetSegmentAdd::~CmdSchematicNetSegmentAdd() noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetSegmentAdd::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mSchematic);
+  return true;
+}
+
 bool CmdSchematicNetSegmentAdd::performExecute() {
   if (!mNetSegment) {
     // create new net segment
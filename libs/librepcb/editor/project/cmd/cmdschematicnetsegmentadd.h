@@ -56,6 +56,10 @@ public:
   // Getters
   SI_NetSegment* getNetSegment() const noexcept { return mNetSegment; }
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -25,6 +25,7 @@
 #include <librepcb/core/project/schematic/items/si_netline.h>
 #include <librepcb/core/project/schematic/items/si_netpoint.h>
 #include <librepcb/core/project/schematic/items/si_netsegment.h>
+#include <librepcb/core/project/schematic/schematic.h>
 
 #include <QtCore>
 
@@ -81,6 +82,12 @@ SI_NetLine* CmdSchematicNetSegmentAddElements::addNetLine(
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetSegmentAddElements::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetSegment.getSchematic());
+  return true;
+}
+
 bool CmdSchematicNetSegmentAddElements::performExecute() {
   performRedo();  // can throw
 
@@ -61,6 +61,10 @@ public:
   SI_NetLine* addNetLine(SI_NetLineAnchor& startPoint,
                          SI_NetLineAnchor& endPoint);
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
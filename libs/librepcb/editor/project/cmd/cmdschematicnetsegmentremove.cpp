@@ -51,6 +51,12 @@ CmdSchematicNetSegmentRemove::~CmdSchematicNetSegmentRemove() noexcept {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetSegmentRemove::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mSchematic);
+  return true;
+}
+
 bool CmdSchematicNetSegmentRemove::performExecute() {
   performRedo();  // can throw
 
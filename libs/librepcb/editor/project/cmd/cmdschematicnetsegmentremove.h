@@ -50,6 +50,10 @@ public:
   explicit CmdSchematicNetSegmentRemove(SI_NetSegment& segment) noexcept;
   ~CmdSchematicNetSegmentRemove() noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
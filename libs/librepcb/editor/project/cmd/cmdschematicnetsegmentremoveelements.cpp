@@ -65,6 +65,12 @@ void CmdSchematicNetSegmentRemoveElements::removeNetLine(SI_NetLine& netline) {
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetSegmentRemoveElements::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mNetSegment.getSchematic());
+  return true;
+}
+
 bool CmdSchematicNetSegmentRemoveElements::performExecute() {
   performRedo();  // can throw
 
@@ -55,6 +55,10 @@ public:
   void removeNetPoint(SI_NetPoint& netpoint);
   void removeNetLine(SI_NetLine& netline);
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
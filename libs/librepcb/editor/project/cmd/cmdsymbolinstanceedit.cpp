@@ -23,6 +23,7 @@
 #include "cmdsymbolinstanceedit.h"
 
 #include <librepcb/core/project/schematic/items/si_symbol.h>
+#include <librepcb/core/project/schematic/schematic.h>
 
 #include <QtCore>
 
@@ -108,6 +109,12 @@ void CmdSymbolInstanceEdit::mirror(const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSymbolInstanceEdit::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  documents.insert(&mSymbol.getSchematic());
+  return true;
+}
+
 bool CmdSymbolInstanceEdit::performExecute() {
   performRedo();  // can throw
 
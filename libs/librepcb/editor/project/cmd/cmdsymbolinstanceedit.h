@@ -61,6 +61,10 @@ public:
   void mirror(const Point& center, Qt::Orientation orientation,
               bool immediate) noexcept;
 
+  // Inherited from UndoCommand
+  bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
 private:
   // Private Methods
 
@@ -263,8 +263,8 @@ void OutputJobsDialog::removeClicked() noexcept {
   if ((index >= 0) && (index < mJobs.count())) {
     mUi->lstJobs->setCurrentRow(-1);
     const Uuid uuid = mJobs.at(index)->getUuid();
-    for (auto& job : mJobs) {
-      job.removeDependency(uuid);
+    for (const auto& job : mJobs.values()) {
+      job->removeDependency(uuid);
     }
     mJobs.remove(index);
     updateJobsList();
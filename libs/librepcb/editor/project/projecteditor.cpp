@@ -23,6 +23,7 @@
 #include "projecteditor.h"
 
 #include "../dialogs/filedialog.h"
+#include "../undocommand.h"
 #include "../undostack.h"
 #include "boardeditor/boardeditor.h"
 #include "orderpcbdialog.h"
@@ -30,11 +31,15 @@
 
 #include <librepcb/core/application.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/circuit/circuit.h>
 #include <librepcb/core/project/erc/electricalrulecheck.h>
 #include <librepcb/core/project/project.h>
+#include <librepcb/core/project/schematic/schematic.h>
 #include <librepcb/core/workspace/workspace.h>
 #include <librepcb/core/workspace/workspacesettings.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -94,9 +99,20 @@ ProjectEditor::ProjectEditor(
     throw;  // ...and rethrow the exception
   }
 
-  // Run the ERC after opening and after every modification.
+  // Run the ERC after opening and after modifications. To avoid running the
+  // ERC after each single step of a series of modifications (e.g. while
+  // moving items with the keyboard), it is delayed until no more
+  // modifications were made for a short time.
+  mErcTimer.setSingleShot(true);
+  mErcTimer.setInterval(300);
+  connect(&mErcTimer, &QTimer::timeout, this, &ProjectEditor::runErc);
+  connect(&mErcWatcher, &QFutureWatcherBase::finished, this,
+          &ProjectEditor::ercRunFinished);
   QTimer::singleShot(200, this, &ProjectEditor::runErc);
-  connect(mUndoStack, &UndoStack::stateModified, this, &ProjectEditor::runErc);
+  connect(mUndoStack, &UndoStack::stateModified, this,
+          &ProjectEditor::scheduleErc);
+  connect(mUndoStack, &UndoStack::stateModifiedByCommand, this,
+          &ProjectEditor::undoStackStateModified);
 
   // setup the timer for automatic backups, if enabled in the settings
   int intervalSecs =
@@ -110,8 +126,10 @@ ProjectEditor::ProjectEditor(
 }
 
 ProjectEditor::~ProjectEditor() noexcept {
-  // stop the autosave timer
+  // stop the autosave & ERC timers and wait for a running ERC
   mAutoSaveTimer.stop();
+  mErcTimer.stop();
+  mErcWatcher.waitForFinished();
 
   // abort all active commands!
   mSchematicEditor->abortAllCommands();
@@ -409,6 +427,13 @@ bool ProjectEditor::closeAndDestroy(bool askForSave,
   }
 }
 
+void ProjectEditor::setManualModificationsMade() noexcept {
+  mManualModificationsMade = true;
+
+  // It is not known what has been modified, thus save everything.
+  mProject.setAllDocumentsModified();
+}
+
 void ProjectEditor::setErcMessageApproved(const RuleCheckMessage& msg,
                                           bool approve) noexcept {
   QSet<SExpression> approvals = mProject.getErcMessageApprovals();
@@ -436,23 +461,82 @@ void ProjectEditor::clearHighlightedNetSignals() noexcept {
  *  Private Methods
  ******************************************************************************/
 
+bool ProjectEditor::isSameErcResult(const RuleCheckMessageList& a,
+                                    const RuleCheckMessageList& b) noexcept {
+  if (a.count() != b.count()) {
+    return false;
+  }
+  for (int i = 0; i < a.count(); ++i) {
+    if ((*a.at(i) != *b.at(i)) ||
+        (a.at(i)->getApproval() != b.at(i)->getApproval())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ProjectEditor::undoStackStateModified(const UndoCommand& cmd) noexcept {
+  QSet<const QObject*> documents;
+  if (!cmd.getModifiedDocuments(documents)) {
+    mProject.setAllDocumentsModified();
+    return;
+  }
+  foreach (const QObject* document, documents) {
+    if (document == &mProject.getCircuit()) {
+      mProject.setCircuitModified();
+    } else if (auto schematic = qobject_cast<const Schematic*>(document)) {
+      mProject.setSchematicModified(*schematic);
+    } else if (auto board = qobject_cast<const Board*>(document)) {
+      mProject.setBoardModified(*board);
+    } else {
+      mProject.setAllDocumentsModified();
+    }
+  }
+}
+
+void ProjectEditor::scheduleErc() noexcept {
+  mErcTimer.start();  // Restarts the timer if it is already running.
+}
+
 void ProjectEditor::runErc() noexcept {
+  mErcTimer.stop();  // In case it was triggered by someone else.
+
+  // The constructor copies all the data needed from the project, so the
+  // checks can run in a worker thread while the project is being modified.
+  mErcElapsedTimer.start();
+  auto erc = std::make_shared<ElectricalRuleCheck>(mProject);
+  mErcWatcher.setFuture(
+      QtConcurrent::run([erc]() { return erc->runChecks(); }));
+}
+
+void ProjectEditor::ercRunFinished() noexcept {
+  // If the project was modified in the meantime, another ERC run is already
+  // scheduled, so the result is outdated.
+  if (mErcTimer.isActive()) {
+    return;
+  }
+
   try {
-    QElapsedTimer timer;
-    timer.start();
-    ElectricalRuleCheck erc(mProject);
-    mErcMessages = erc.runChecks();
+    const RuleCheckMessageList messages = mErcWatcher.result();  // can throw
+
+    // Most modifications do not change the ERC result at all, so skip
+    // updating the approvals and the GUI in that case.
+    if (mErcMessages && isSameErcResult(messages, *mErcMessages)) {
+      qDebug() << "ERC succeeded after" << mErcElapsedTimer.elapsed()
+               << "ms (no changes).";
+      return;
+    }
+    mErcMessages = messages;
 
     // Detect disappeared messages & remove their approvals.
-    QSet<SExpression> approvals =
-        RuleCheckMessage::getAllApprovals(mErcMessages);
+    QSet<SExpression> approvals = RuleCheckMessage::getAllApprovals(messages);
     mSupportedErcApprovals |= approvals;
     mDisappearedErcApprovals = mSupportedErcApprovals - approvals;
     approvals = mProject.getErcMessageApprovals() - mDisappearedErcApprovals;
     saveErcMessageApprovals(approvals);
 
-    emit ercFinished(mErcMessages);
-    qDebug() << "ERC succeeded after" << timer.elapsed() << "ms.";
+    emit ercFinished(messages);
+    qDebug() << "ERC succeeded after" << mErcElapsedTimer.elapsed() << "ms.";
   } catch (const Exception& e) {
     qCritical() << "ERC failed:" << e.getMsg();
   }
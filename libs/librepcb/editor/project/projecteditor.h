@@ -50,6 +50,7 @@ namespace editor {
 
 class BoardEditor;
 class SchematicEditor;
+class UndoCommand;
 class UndoStack;
 
 /*******************************************************************************
@@ -225,9 +226,7 @@ public slots:
   /**
    * @brief Set the flag that manual modifications (no undo stack) are made
    */
-  void setManualModificationsMade() noexcept {
-    mManualModificationsMade = true;
-  }
+  void setManualModificationsMade() noexcept;
 
   /**
    * @brief Approve/unapprove an ERC message
@@ -256,7 +255,12 @@ signals:
   void projectEditorClosed();
 
 private:  // Methods
+  void undoStackStateModified(const UndoCommand& cmd) noexcept;
+  void scheduleErc() noexcept;
   void runErc() noexcept;
+  void ercRunFinished() noexcept;
+  static bool isSameErcResult(const RuleCheckMessageList& a,
+                              const RuleCheckMessageList& b) noexcept;
   void saveErcMessageApprovals(const QSet<SExpression>& approvals) noexcept;
   int getCountOfVisibleEditorWindows() const noexcept;
 
@@ -270,9 +274,18 @@ private:  // Data
   /// functionality (see also @ref doc_project_save)
   QTimer mAutoSaveTimer;
 
+  /// Delays the ERC after modifications to run it only once after a series
+  /// of modifications
+  QTimer mErcTimer;
+
+  /// Watches the ERC running in a worker thread. Starting a new run replaces
+  /// the watched future, so results of outdated runs are dropped.
+  QFutureWatcher<RuleCheckMessageList> mErcWatcher;
+  QElapsedTimer mErcElapsedTimer;
+
   QSet<SExpression> mSupportedErcApprovals;
   QSet<SExpression> mDisappearedErcApprovals;
-  RuleCheckMessageList mErcMessages;
+  tl::optional<RuleCheckMessageList> mErcMessages;  ///< Last ERC result
 
   std::shared_ptr<QSet<const NetSignal*>> mHighlightedNetSignals;
 
@@ -144,6 +144,12 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
     posAreaInGrid.addEllipse(pos.toPxQPointF(), gridDistancePx, gridDistancePx);
   }
 
+  // Only process items close to the cursor, determined by the spatial index
+  // of the graphics scene. Checking the exact shape of every item on the
+  // schematic would be way too slow for large schematics.
+  const QSet<QGraphicsItem*> itemsInArea = scene->getItemsInArea(
+      posAreaLarge.boundingRect().united(posAreaInGrid.boundingRect()));
+
   // Note: The order of adding the items is very important (the top most item
   // must appear as the first item in the list)! For that, we work with
   // priorities (0 = highest priority):
@@ -217,16 +223,20 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   };
 
   if (flags.testFlag(FindFlag::NetPoints)) {
-    for (auto it = scene->getNetPoints().begin();
-         it != scene->getNetPoints().end(); it++) {
+    const auto netPoints =
+        GraphicsScene::filterItems(scene->getNetPoints(), itemsInArea,
+                                   &SGI_NetPoint::getNetPoint);
+    for (auto it = netPoints.begin(); it != netPoints.end(); it++) {
       processItem(it.value(), it.key()->getPosition(),
                   it.key()->isVisibleJunction() ? 0 : 10, false);
     }
   }
 
   if (flags.testFlag(FindFlag::NetLines)) {
-    for (auto it = scene->getNetLines().begin();
-         it != scene->getNetLines().end(); it++) {
+    const auto netLines =
+        GraphicsScene::filterItems(scene->getNetLines(), itemsInArea,
+                                   &SGI_NetLine::getNetLine);
+    for (auto it = netLines.begin(); it != netLines.end(); it++) {
       processItem(
           it.value(),
           Toolbox::nearestPointOnLine(pos.mappedToGrid(getGridInterval()),
@@ -237,23 +247,29 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::NetLabels)) {
-    for (auto it = scene->getNetLabels().begin();
-         it != scene->getNetLabels().end(); it++) {
+    const auto netLabels =
+        GraphicsScene::filterItems(scene->getNetLabels(), itemsInArea,
+                                   &SGI_NetLabel::getNetLabel);
+    for (auto it = netLabels.begin(); it != netLabels.end(); it++) {
       processItem(it.value(), it.key()->getPosition(), 30, false);
     }
   }
 
   if (flags.testFlag(FindFlag::Symbols)) {
-    for (auto it = scene->getSymbols().begin(); it != scene->getSymbols().end();
-         it++) {
+    const auto symbols =
+        GraphicsScene::filterItems(scene->getSymbols(), itemsInArea,
+                                   &SGI_Symbol::getSymbol);
+    for (auto it = symbols.begin(); it != symbols.end(); it++) {
       processItem(it.value(), it.key()->getPosition(), 40, false);
     }
   }
 
   if (flags &
       (FindFlag::SymbolPins | FindFlag::SymbolPinsWithComponentSignal)) {
-    for (auto it = scene->getSymbolPins().begin();
-         it != scene->getSymbolPins().end(); it++) {
+    const auto pins =
+        GraphicsScene::filterItems(scene->getSymbolPins(), itemsInArea,
+                                   &SGI_SymbolPin::getPin);
+    for (auto it = pins.begin(); it != pins.end(); it++) {
       if (flags.testFlag(FindFlag::SymbolPins) ||
           (it.key()->getComponentSignalInstance())) {
         processItem(it.value(), it.key()->getPosition(), 50, false);
@@ -262,8 +278,13 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Polygons)) {
+    // Note: PolygonGraphicsItem doesn't know its SI_Polygon, so we have to
+    // check all of them. But usually there are only very few polygons.
     for (auto it = scene->getPolygons().begin();
          it != scene->getPolygons().end(); it++) {
+      if (!itemsInArea.contains(it.value().get())) {
+        continue;
+      }
       processItem(
           it.value(),
           it.key()->getPolygon().getPath().calcNearestPointBetweenVertices(pos),
@@ -273,8 +294,10 @@ QList<std::shared_ptr<QGraphicsItem>> SchematicEditorState::findItemsAtPos(
   }
 
   if (flags.testFlag(FindFlag::Texts)) {
-    for (auto it = scene->getTexts().begin(); it != scene->getTexts().end();
-         it++) {
+    const auto texts =
+        GraphicsScene::filterItems(scene->getTexts(), itemsInArea,
+                                   &SGI_Text::getText);
+    for (auto it = texts.begin(); it != texts.end(); it++) {
       processItem(it.value(), it.key()->getPosition(), 70, false);
     }
   }
@@ -1184,6 +1184,7 @@ void SchematicEditor::setGridProperties(const PositiveLength& interval,
     foreach (Schematic* schematic, mProject.getSchematics()) {
       schematic->setGridInterval(interval);
       schematic->setGridUnit(unit);
+      mProject.setSchematicModified(*schematic);
     }
   }
 }
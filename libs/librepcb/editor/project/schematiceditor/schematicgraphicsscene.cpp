@@ -151,12 +151,31 @@ void SchematicGraphicsScene::selectItemsInRect(const Point& p1,
                                                const Point& p2) noexcept {
   GraphicsScene::setSelectionRect(p1, p2);
   const QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-  foreach (auto item, mSymbols) {
+
+  // Only the items within the rect and the currently selected items need to
+  // be updated, so avoid processing all items of the schematic.
+  QSet<QGraphicsItem*> items = getItemsInArea(rectPx);
+  foreach (QGraphicsItem* item, selectedItems()) {
+    items.insert(item);
+  }
+
+  foreach (auto item, filterItems(mSymbols, items, &SGI_Symbol::getSymbol)) {
     const bool selectSymbol =
         item->mapToScene(item->shape()).intersects(rectPx);
     item->setSelected(selectSymbol);
+    // Pins and texts follow the selection state of their symbol.
+    foreach (SI_SymbolPin* pin, item->getSymbol().getPins()) {
+      if (auto pinItem = mSymbolPins.value(pin)) {
+        items.insert(pinItem.get());
+      }
+    }
+    foreach (SI_Text* text, item->getSymbol().getTexts()) {
+      if (auto textItem = mTexts.value(text)) {
+        items.insert(textItem.get());
+      }
+    }
   }
-  foreach (auto item, mSymbolPins) {
+  foreach (auto item, filterItems(mSymbolPins, items, &SGI_SymbolPin::getPin)) {
     bool symbolSelected = false;
     if (auto symbol = item->getSymbolGraphicsItem().lock()) {
       symbolSelected = symbol->isSelected();
@@ -164,19 +183,25 @@ void SchematicGraphicsScene::selectItemsInRect(const Point& p1,
     item->setSelected(symbolSelected ||
                       item->mapToScene(item->shape()).intersects(rectPx));
   }
-  foreach (auto item, mNetPoints) {
+  foreach (auto item,
+           filterItems(mNetPoints, items, &SGI_NetPoint::getNetPoint)) {
     item->setSelected(item->mapToScene(item->shape()).intersects(rectPx));
   }
-  foreach (auto item, mNetLines) {
+  foreach (auto item, filterItems(mNetLines, items, &SGI_NetLine::getNetLine)) {
     item->setSelected(item->mapToScene(item->shape()).intersects(rectPx));
   }
-  foreach (auto item, mNetLabels) {
+  foreach (auto item,
+           filterItems(mNetLabels, items, &SGI_NetLabel::getNetLabel)) {
     item->setSelected(item->mapToScene(item->shape()).intersects(rectPx));
   }
   foreach (auto item, mPolygons) {
-    item->setSelected(item->mapToScene(item->shape()).intersects(rectPx));
+    // Note: PolygonGraphicsItem doesn't know its SI_Polygon, so we have to
+    // check all of them. But usually there are only very few polygons.
+    if (items.contains(item.get())) {
+      item->setSelected(item->mapToScene(item->shape()).intersects(rectPx));
+    }
   }
-  foreach (auto item, mTexts) {
+  foreach (auto item, filterItems(mTexts, items, &SGI_Text::getText)) {
     if (auto symbol = item->getSymbolGraphicsItem().lock()) {
       item->setSelected(symbol->isSelected());
     } else {
@@ -94,7 +94,7 @@ QList<SchematicNetSegmentSplitter::Segment>
   Q_ASSERT(availableNetLines.isEmpty());
 
   // Add netlabels to their nearest netsegment
-  for (NetLabel& netlabel : mNetLabels) {
+  for (const NetLabel& netlabel : mNetLabels) {
     addNetLabelToNearestNetSegment(netlabel, segments);
   }
 
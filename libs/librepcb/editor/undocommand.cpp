@@ -44,6 +44,20 @@ UndoCommand::~UndoCommand() noexcept {
   Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+std::size_t UndoCommand::getMemoryUsage() const noexcept {
+  return sizeof(UndoCommand) + (mText.capacity() * sizeof(QChar));
+}
+
+bool UndoCommand::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  Q_UNUSED(documents);
+  return false;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -78,6 +92,11 @@ void UndoCommand::redo() {
   mRedoCount++;
 }
 
+bool UndoCommand::mergeWith(UndoCommand& other) noexcept {
+  Q_UNUSED(other);
+  return false;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -74,6 +74,34 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Get the (estimated) amount of memory held by this command
+   *
+   * Used by ::librepcb::editor::UndoStack to limit the memory consumption of
+   * its history. Derived classes holding large data (e.g. copies of paths)
+   * should override this method and add the size of their data to the value
+   * returned by the base class.
+   *
+   * @return Estimated memory usage in bytes
+   */
+  virtual std::size_t getMemoryUsage() const noexcept;
+
+  /**
+   * @brief Get the documents (e.g. boards) modified by this command
+   *
+   * Used to save only the modified documents of a project. Derived classes
+   * which know the modified documents should override this method and add
+   * them to the passed set. The default implementation returns false, i.e.
+   * all documents need to be considered as modified.
+   *
+   * @param documents     The modified documents are added to this set
+   *
+   * @retval true     If all modified documents were added to the set
+   * @retval false    If the modified documents are not known
+   */
+  virtual bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept;
+
   // General Methods
 
   /**
@@ -95,6 +123,22 @@ public:
    */
   virtual void redo() final;
 
+  /**
+   * @brief Try to merge a newer command into this command
+   *
+   * This allows ::librepcb::editor::UndoStack to coalesce consecutive
+   * commands (e.g. moving items step by step with the arrow keys) into a
+   * single undo step. Both commands are already executed when this method
+   * is called. If it returns true, this command took over all changes of the
+   * other command, which then gets deleted without being reverted.
+   *
+   * @param other     The newer command to merge into this command
+   *
+   * @retval true     If the other command was merged into this command
+   * @retval false    If the commands cannot be merged (the default)
+   */
+  virtual bool mergeWith(UndoCommand& other) noexcept;
+
   // Operator Overloadings
   UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
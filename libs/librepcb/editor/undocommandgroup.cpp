@@ -48,6 +48,29 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+std::size_t UndoCommandGroup::getMemoryUsage() const noexcept {
+  std::size_t size =
+      UndoCommand::getMemoryUsage() + (mChilds.count() * sizeof(UndoCommand*));
+  foreach (const UndoCommand* cmd, mChilds) {
+    size += cmd->getMemoryUsage();
+  }
+  return size;
+}
+
+bool UndoCommandGroup::getModifiedDocuments(
+    QSet<const QObject*>& documents) const noexcept {
+  foreach (const UndoCommand* cmd, mChilds) {
+    if (!cmd->getModifiedDocuments(documents)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -142,6 +165,13 @@ void UndoCommandGroup::execNewChildCmd(UndoCommand* cmd) {
   }
 }
 
+void UndoCommandGroup::takeChildsFrom(UndoCommandGroup& other) noexcept {
+  Q_ASSERT(isCurrentlyExecuted() && other.isCurrentlyExecuted());
+  mChilds.append(other.mChilds);
+  other.mChilds.clear();
+  mHasDoneSomething = mHasDoneSomething || other.mHasDoneSomething;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -54,6 +54,13 @@ public:
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
 
+  /// @copydoc ::librepcb::editor::UndoCommand::getMemoryUsage()
+  virtual std::size_t getMemoryUsage() const noexcept override;
+
+  /// @copydoc ::librepcb::editor::UndoCommand::getModifiedDocuments()
+  virtual bool getModifiedDocuments(
+      QSet<const QObject*>& documents) const noexcept override;
+
   // General Methods
 
   /**
@@ -105,6 +112,16 @@ protected:
    */
   void execNewChildCmd(UndoCommand* cmd);
 
+  /**
+   * @brief Helper method for derived classes to implement #mergeWith()
+   *
+   * Moves all child commands of another (executed) command group to the end
+   * of the child commands of this (executed) command group.
+   *
+   * @param other     The command group to take the child commands from
+   */
+  void takeChildsFrom(UndoCommandGroup& other) noexcept;
+
 private:
   /**
    * @brief Memorized return value of #performExecute()
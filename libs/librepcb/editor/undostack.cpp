@@ -79,6 +79,9 @@ bool UndoStackTransaction::commit() {
 
 UndoStack::UndoStack() noexcept
   : QObject(nullptr),
+    mMemoryUsage(0),
+    mMemoryLimit(256 * 1024 * 1024),
+    mMergeCount(0),
     mCurrentIndex(0),
     mCleanIndex(0),
     mActiveCommandGroup(nullptr) {
@@ -121,6 +124,9 @@ uint UndoStack::getUniqueStateId() const noexcept {
   QList<UndoCommand*> commands = mCommands.mid(0, mCurrentIndex);
   uint id = qHashRange(commands.constBegin(), commands.constEnd());
 
+  // Merging commands modifies the state without modifying the command list.
+  id = qHash(mMergeCount, id);
+
   // If there is a command group currently active, we should take it into
   // account as well to avoid ambiguous state IDs.
   if (mActiveCommandGroup) {
@@ -150,6 +156,11 @@ void UndoStack::setClean() noexcept {
   emit cleanChanged(true);
 }
 
+void UndoStack::setMemoryLimit(std::size_t limit) noexcept {
+  mMemoryLimit = limit;
+  applyMemoryLimit();
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -178,14 +189,34 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // impossible)
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
-      delete mCommands.takeLast();
+      deleteLastCommand();
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
 
+    // Try to merge the command into the previous command, unless this would
+    // make the clean state unreachable.
+    if ((!forceKeepCmd) && (mCurrentIndex > 0) &&
+        (mCleanIndex != mCurrentIndex) && mCommands.last()->mergeWith(*cmd)) {
+      mMergeCount++;
+      updateMemoryUsageOfLastCommand();
+      applyMemoryLimit();
+
+      // emit signals (redo commands might have been deleted above)
+      emit undoTextChanged(getUndoText());
+      emit redoTextChanged(tr("Redo"));
+      emit canRedoChanged(false);
+      emit stateModified();
+      emit stateModifiedByCommand(*mCommands.last());
+      return commandHasDoneSomething;
+    }
+
     // add command to the command stack
     mCommands.append(
         cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
+    mCommandSizes.append(cmd->getMemoryUsage());
+    mMemoryUsage += mCommandSizes.last();
     mCurrentIndex++;
+    applyMemoryLimit();
 
     // emit signals
     emit undoTextChanged(tr("Undo: %1").arg(cmd->getText()));
@@ -194,6 +225,7 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     emit canRedoChanged(false);
     emit cleanChanged(false);
     emit stateModified();
+    emit stateModifiedByCommand(*cmd);
   } else {
     // the command has done nothing, so we will just discard it
     cmd->undo();  // only to be sure the command has executed nothing...
@@ -236,6 +268,9 @@ bool UndoStack::appendToCmdGroup(UndoCommand* cmd) {
 
   // emit signals
   emit stateModified();
+  if (commandHasDoneSomething) {
+    emit stateModifiedByCommand(*cmd);  // now owned by the command group
+  }
   return commandHasDoneSomething;
 }
 
@@ -255,6 +290,8 @@ bool UndoStack::commitCmdGroup() {
   // To finish the active command group, we only need to reset the pointer to
   // the currently active command group
   mActiveCommandGroup = nullptr;
+  updateMemoryUsageOfLastCommand();
+  applyMemoryLimit();
 
   // emit signals
   emit canUndoChanged(canUndo());
@@ -272,10 +309,11 @@ void UndoStack::abortCmdGroup() {
 
   try {
     mActiveCommandGroup->undo();  // can throw (but should usually not)
+    emit stateModifiedByCommand(*mActiveCommandGroup);  // before deleting it
     mActiveCommandGroup = nullptr;
     mCurrentIndex--;
-    delete mCommands.takeLast();  // delete and remove the aborted command group
-                                  // from the stack
+    deleteLastCommand();  // delete and remove the aborted command group from
+                          // the stack
   } catch (Exception& e) {
     qCritical() << "Exception thrown in UndoCommand::undo():" << e.getMsg();
     throw;
@@ -311,6 +349,7 @@ void UndoStack::undo() {
   emit canRedoChanged(canRedo());
   emit cleanChanged(isClean());
   emit stateModified();
+  emit stateModifiedByCommand(*mCommands[mCurrentIndex]);
 }
 
 void UndoStack::redo() {
@@ -333,6 +372,7 @@ void UndoStack::redo() {
   emit canRedoChanged(canRedo());
   emit cleanChanged(isClean());
   emit stateModified();
+  emit stateModifiedByCommand(*mCommands[mCurrentIndex - 1]);
 }
 
 void UndoStack::clear() noexcept {
@@ -351,8 +391,9 @@ void UndoStack::clear() noexcept {
   // delete all commands in the stack from top to bottom (newest first, oldest
   // last)!
   while (!mCommands.isEmpty()) {
-    delete mCommands.takeLast();
+    deleteLastCommand();
   }
+  Q_ASSERT(mMemoryUsage == 0);
 
   mCurrentIndex = 0;
   mCleanIndex = 0;
@@ -366,6 +407,42 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void UndoStack::updateMemoryUsageOfLastCommand() noexcept {
+  Q_ASSERT(!mCommands.isEmpty());
+  mMemoryUsage -= mCommandSizes.last();
+  mCommandSizes.last() = mCommands.last()->getMemoryUsage();
+  mMemoryUsage += mCommandSizes.last();
+}
+
+void UndoStack::deleteLastCommand() noexcept {
+  delete mCommands.takeLast();
+  mMemoryUsage -= mCommandSizes.takeLast();
+}
+
+void UndoStack::applyMemoryLimit() noexcept {
+  // Delete the oldest commands, but always keep the last executed command
+  // (which also ensures that an active command group is never deleted).
+  bool modified = false;
+  while ((mMemoryLimit > 0) && (mMemoryUsage > mMemoryLimit) &&
+         (mCurrentIndex > 1)) {
+    delete mCommands.takeFirst();
+    mMemoryUsage -= mCommandSizes.takeFirst();
+    mCurrentIndex--;
+    // If the clean state is deleted, it cannot be restored anymore.
+    mCleanIndex = (mCleanIndex > 0) ? (mCleanIndex - 1) : -1;
+    modified = true;
+  }
+  if (modified) {
+    qDebug() << "Removed oldest commands from undo stack to reduce its memory "
+                "usage to"
+             << mMemoryUsage << "bytes.";
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -100,6 +100,13 @@ private:
  *    QUndoStack#endMacro())</b>: I think we do need this feature (but we have a
  * similar mechanism, see next line)...
  *  - <b>Added support for exclusive macro command creation:</b>
+ *  - <b>Memory limit:</b> If the (estimated) memory usage of all commands
+ *    exceeds #getMemoryLimit(), the oldest commands are removed from the
+ *    stack. This keeps the memory usage bounded even if an editor is kept
+ *    open for a very long time.
+ *  - <b>Merging commands:</b> Like QUndoStack, consecutive commands are
+ *    merged into a single undo step if the previous command accepts it (see
+ *    ::librepcb::editor::UndoCommand::mergeWith()).
  *
  * @see ::librepcb::editor::UndoCommand, ::librepcb::editor::UndoCommandGroup
  */
@@ -177,6 +184,20 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the (estimated) memory usage of all commands in the stack
+   *
+   * @return Memory usage in bytes
+   */
+  std::size_t getMemoryUsage() const noexcept { return mMemoryUsage; }
+
+  /**
+   * @brief Get the maximum memory usage of the stack (see #setMemoryLimit())
+   *
+   * @return Memory limit in bytes (0 means unlimited)
+   */
+  std::size_t getMemoryLimit() const noexcept { return mMemoryLimit; }
+
   // Setters
 
   /**
@@ -184,6 +205,17 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Set the maximum memory usage of the stack
+   *
+   * If the memory usage exceeds this limit, the oldest commands are deleted
+   * until the limit is met again. However, the last executed command is
+   * always kept to allow undoing it.
+   *
+   * @param limit     Memory limit in bytes (0 means unlimited)
+   */
+  void setMemoryLimit(std::size_t limit) noexcept;
+
   // General Methods
 
   /**
@@ -300,7 +332,23 @@ signals:
   void commandGroupAborted();
   void stateModified();
 
-private:
+  /**
+   * @brief A command was executed, undone or redone
+   *
+   * Emitted in addition to #stateModified() to allow determining which
+   * documents were modified (see
+   * ::librepcb::editor::UndoCommand::getModifiedDocuments()).
+   *
+   * @param cmd   The command which was executed, undone or redone
+   */
+  void stateModifiedByCommand(const UndoCommand& cmd);
+
+private:  // Methods
+  void updateMemoryUsageOfLastCommand() noexcept;
+  void deleteLastCommand() noexcept;
+  void applyMemoryLimit() noexcept;
+
+private:  // Data
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -309,6 +357,30 @@ private:
    */
   QList<UndoCommand*> mCommands;
 
+  /**
+   * @brief The (estimated) memory usage of each command in #mCommands
+   *
+   * Memorized when adding the command to the stack (and when finishing a
+   * command group) to keep #mMemoryUsage consistent.
+   */
+  QList<std::size_t> mCommandSizes;
+
+  /**
+   * @brief Sum of #mCommandSizes
+   */
+  std::size_t mMemoryUsage;
+
+  /**
+   * @brief See #setMemoryLimit()
+   */
+  std::size_t mMemoryLimit;
+
+  /**
+   * @brief Count of merged commands, to get a new #getUniqueStateId() after
+   * merging commands
+   */
+  uint mMergeCount;
+
   /**
    * @brief This attribute holds the current position in the undo stack
    * #mCommands
@@ -46,13 +46,19 @@ CategoryTreeModel::CategoryTreeModel(const WorkspaceLibraryDb& library,
     mLibrary(library),
     mLocaleOrder(localeOrder),
     mFilters(filters),
-    mRootItem(new Item{std::weak_ptr<Item>(), tl::nullopt, {}, {}, {}}) {
+    mRootItem(new Item{std::weak_ptr<Item>(), tl::nullopt, {}, {}, {}}),
+    mUpdateInProgress(false),
+    mFuture(),
+    mWatcher() {
+  connect(&mWatcher, &QFutureWatcherBase::finished, this,
+          &CategoryTreeModel::updateFinished);
   update();
   connect(&mLibrary, &WorkspaceLibraryDb::scanSucceeded, this,
           &CategoryTreeModel::update);
 }
 
 CategoryTreeModel::~CategoryTreeModel() noexcept {
+  mFuture.cancel();
 }
 
 /*******************************************************************************
@@ -133,16 +139,57 @@ QVariant CategoryTreeModel::data(const QModelIndex& index,
  ******************************************************************************/
 
 void CategoryTreeModel::update() noexcept {
+  // The database is queried in a worker thread to not block the GUI, e.g.
+  // while the library scan is in progress. A pending update is cancelled
+  // since its result would be outdated anyway.
+  mFuture.cancel();
+  const QStringList localeOrder = mLocaleOrder;
+  const Filters filters = mFilters;
+  mFuture = mLibrary.runAsync<QVector<std::shared_ptr<Item>>>(
+      [localeOrder, filters](const WorkspaceLibraryDb& db) {
+        return getItems(db, localeOrder, filters);  // can throw
+      });
+  mWatcher.setFuture(mFuture);
+  mUpdateInProgress = true;
+}
+
+void CategoryTreeModel::updateFinished() noexcept {
+  mUpdateInProgress = false;
+  if (mWatcher.isCanceled()) {
+    return;
+  }
+
+  QVector<std::shared_ptr<Item>> items;
+  try {
+    items = mFuture.result();  // can throw
+  } catch (const Exception& e) {
+    qCritical() << "Failed to update category tree model:" << e.getMsg();
+    return;
+  }
+
+  // Update tree with new items in a way which keeps the selection in views.
+  updateModelItem(mRootItem, items);
+}
+
+QVector<std::shared_ptr<CategoryTreeModel::Item>> CategoryTreeModel::getItems(
+    const WorkspaceLibraryDb& db, const QStringList& localeOrder,
+    Filters filters) {
   qDebug() << "Update category tree model...";
   QElapsedTimer t;
   t.start();
 
   // Determine new items.
-  QVector<std::shared_ptr<Item>> items = getChilds(nullptr);
+  QVector<std::shared_ptr<Item>> items;
+  try {
+    items = getChilds(db, filters, nullptr,
+                      getCategories(db, localeOrder, filters));  // can throw
+  } catch (const Exception& e) {
+    qCritical() << "Failed to update category tree model items:" << e.getMsg();
+  }
 
   // Add virtual category for library elements with no category assigned.
   try {
-    if (containsItems(tl::nullopt)) {
+    if (containsItems(db, filters, tl::nullopt)) {
       items.append(std::shared_ptr<Item>(
           new Item{std::weak_ptr<Item>(),
                    tl::nullopt,
@@ -154,36 +201,66 @@ void CategoryTreeModel::update() noexcept {
     qCritical() << "Failed to update category tree model:" << e.getMsg();
   }
 
-  // Update tree with new items in a way which keeps the selection in views.
-  updateModelItem(mRootItem, items);
-
   qDebug() << "Finished category tree model update in" << t.elapsed() << "ms.";
+  return items;
+}
+
+CategoryTreeModel::Categories CategoryTreeModel::getCategories(
+    const WorkspaceLibraryDb& db, const QStringList& localeOrder,
+    Filters filters) {
+  // Fetch all categories at once instead of querying each one separately.
+  const QList<WorkspaceLibraryDb::ElementInfo> infos =
+      listPackageCategories(filters)
+      ? db.getAllInfos<PackageCategory>(localeOrder)  // can throw
+      : db.getAllInfos<ComponentCategory>(localeOrder);  // can throw
+  QSet<Uuid> uuids;
+  foreach (const WorkspaceLibraryDb::ElementInfo& info, infos) {
+    uuids.insert(info.uuid);
+  }
+
+  // Note: The hierarchy takes all versions into account, the same way as
+  // WorkspaceLibraryDb::getChilds() does. Texts are taken from the latest
+  // version, like WorkspaceLibraryDb::getLatest() does.
+  Categories categories;
+  QHash<Uuid, Version> versions;
+  foreach (const WorkspaceLibraryDb::ElementInfo& info, infos) {
+    const tl::optional<Uuid> parent = info.categories.isEmpty()
+        ? tl::nullopt
+        : tl::make_optional(*info.categories.begin());
+    if (parent && uuids.contains(*parent)) {
+      categories.childs[*parent].insert(info.uuid);
+    } else {
+      categories.roots.insert(info.uuid);
+    }
+    auto it = versions.find(info.uuid);
+    if ((it == versions.end()) || (info.version > it.value())) {
+      versions.insert(info.uuid, info.version);
+      categories.texts.insert(info.uuid,
+                              std::make_pair(info.name, info.description));
+    }
+  }
+  return categories;
 }
 
 QVector<std::shared_ptr<CategoryTreeModel::Item>> CategoryTreeModel::getChilds(
-    std::shared_ptr<Item> parent) const noexcept {
+    const WorkspaceLibraryDb& db, Filters filters, std::shared_ptr<Item> parent,
+    const Categories& categories) noexcept {
   QVector<std::shared_ptr<Item>> childs;
   tl::optional<Uuid> parentUuid = parent ? parent->uuid : tl::nullopt;
   try {
-    QSet<Uuid> uuids = listPackageCategories()
-        ? mLibrary.getChilds<PackageCategory>(parentUuid)
-        : mLibrary.getChilds<ComponentCategory>(parentUuid);
+    const QSet<Uuid> uuids = parentUuid
+        ? categories.childs.value(*parentUuid)
+        : categories.roots;
     foreach (const Uuid& uuid, uuids) {
       std::shared_ptr<Item> child(
           new Item{parent, uuid, QString(), QString(), {}});
-      child->childs = getChilds(child);
-      if (!child->childs.isEmpty() || listAll() || containsItems(uuid)) {
-        FilePath fp = listPackageCategories()
-            ? mLibrary.getLatest<PackageCategory>(uuid)
-            : mLibrary.getLatest<ComponentCategory>(uuid);
-        if (fp.isValid()) {
-          if (listPackageCategories()) {
-            mLibrary.getTranslations<PackageCategory>(
-                fp, mLocaleOrder, &child->text, &child->tooltip);
-          } else {
-            mLibrary.getTranslations<ComponentCategory>(
-                fp, mLocaleOrder, &child->text, &child->tooltip);
-          }
+      child->childs = getChilds(db, filters, child, categories);
+      if (!child->childs.isEmpty() || listAll(filters) ||
+          containsItems(db, filters, uuid)) {
+        auto it = categories.texts.find(uuid);
+        if (it != categories.texts.end()) {
+          child->text = it->first;
+          child->tooltip = it->second;
         }
         childs.append(child);
       }
@@ -204,36 +281,38 @@ QVector<std::shared_ptr<CategoryTreeModel::Item>> CategoryTreeModel::getChilds(
   return childs;
 }
 
-bool CategoryTreeModel::containsItems(const tl::optional<Uuid>& uuid) const {
-  if (listPackageCategories()) {
-    if (mFilters.testFlag(Filter::PkgCatWithPackages) &&
-        (mLibrary.getByCategory<Package>(uuid, 1).count() > 0)) {
+bool CategoryTreeModel::containsItems(const WorkspaceLibraryDb& db,
+                                      Filters filters,
+                                      const tl::optional<Uuid>& uuid) {
+  if (listPackageCategories(filters)) {
+    if (filters.testFlag(Filter::PkgCatWithPackages) &&
+        (db.getByCategory<Package>(uuid, 1).count() > 0)) {
       return true;
     }
   } else {
-    if (mFilters.testFlag(Filter::CmpCatWithSymbols) &&
-        (mLibrary.getByCategory<Symbol>(uuid, 1).count() > 0)) {
+    if (filters.testFlag(Filter::CmpCatWithSymbols) &&
+        (db.getByCategory<Symbol>(uuid, 1).count() > 0)) {
       return true;
     }
-    if (mFilters.testFlag(Filter::CmpCatWithComponents) &&
-        (mLibrary.getByCategory<Component>(uuid, 1).count() > 0)) {
+    if (filters.testFlag(Filter::CmpCatWithComponents) &&
+        (db.getByCategory<Component>(uuid, 1).count() > 0)) {
       return true;
     }
-    if (mFilters.testFlag(Filter::CmpCatWithDevices) &&
-        (mLibrary.getByCategory<Device>(uuid, 1).count() > 0)) {
+    if (filters.testFlag(Filter::CmpCatWithDevices) &&
+        (db.getByCategory<Device>(uuid, 1).count() > 0)) {
       return true;
     }
   }
   return false;
 }
 
-bool CategoryTreeModel::listAll() const noexcept {
-  return mFilters.testFlag(Filter::PkgCat) || mFilters.testFlag(Filter::CmpCat);
+bool CategoryTreeModel::listAll(Filters filters) noexcept {
+  return filters.testFlag(Filter::PkgCat) || filters.testFlag(Filter::CmpCat);
 }
 
-bool CategoryTreeModel::listPackageCategories() const noexcept {
-  return mFilters.testFlag(Filter::PkgCat) ||
-      mFilters.testFlag(Filter::PkgCatWithPackages);
+bool CategoryTreeModel::listPackageCategories(Filters filters) noexcept {
+  return filters.testFlag(Filter::PkgCat) ||
+      filters.testFlag(Filter::PkgCatWithPackages);
 }
 
 void CategoryTreeModel::updateModelItem(
@@ -54,6 +54,12 @@ class CategoryTreeModel final : public QAbstractItemModel {
     QVector<std::shared_ptr<Item>> childs;
   };
 
+  struct Categories {
+    QSet<Uuid> roots;  ///< Including categories with inexistent parent
+    QHash<Uuid, QSet<Uuid>> childs;
+    QHash<Uuid, std::pair<QString, QString>> texts;  ///< Name & description
+  };
+
 public:
   // Types
   enum class Filter {
@@ -80,6 +86,18 @@ public:
                              Filters filters) noexcept;
   ~CategoryTreeModel() noexcept;
 
+  // Getters
+
+  /**
+   * @brief Check whether the model is currently being updated
+   *
+   * The database is queried in a worker thread, so the model is populated
+   * asynchronously after construction and after each library scan.
+   *
+   * @return Whether an update is pending or not.
+   */
+  bool isUpdateInProgress() const noexcept { return mUpdateInProgress; }
+
   // Setters
   void setLocaleOrder(const QStringList& order) noexcept;
 
@@ -102,11 +120,20 @@ public:
 
 private:  // Methods
   void update() noexcept;
-  QVector<std::shared_ptr<Item>> getChilds(
-      std::shared_ptr<Item> parent) const noexcept;
-  bool containsItems(const tl::optional<Uuid>& uuid) const;
-  bool listAll() const noexcept;
-  bool listPackageCategories() const noexcept;
+  void updateFinished() noexcept;
+  static QVector<std::shared_ptr<Item>> getItems(
+      const WorkspaceLibraryDb& db, const QStringList& localeOrder,
+      Filters filters);
+  static Categories getCategories(const WorkspaceLibraryDb& db,
+                                  const QStringList& localeOrder,
+                                  Filters filters);
+  static QVector<std::shared_ptr<Item>> getChilds(
+      const WorkspaceLibraryDb& db, Filters filters,
+      std::shared_ptr<Item> parent, const Categories& categories) noexcept;
+  static bool containsItems(const WorkspaceLibraryDb& db, Filters filters,
+                            const tl::optional<Uuid>& uuid);
+  static bool listAll(Filters filters) noexcept;
+  static bool listPackageCategories(Filters filters) noexcept;
   void updateModelItem(
       std::shared_ptr<Item> parentItem,
       const QVector<std::shared_ptr<Item>>& newChilds) noexcept;
@@ -118,6 +145,9 @@ private:  // Data
   QStringList mLocaleOrder;
   const Filters mFilters;
   std::shared_ptr<Item> mRootItem;
+  bool mUpdateInProgress;
+  QFuture<QVector<std::shared_ptr<Item>>> mFuture;
+  QFutureWatcher<QVector<std::shared_ptr<Item>>> mWatcher;
 };
 
 }  // namespace editor
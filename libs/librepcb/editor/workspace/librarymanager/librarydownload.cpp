@@ -22,10 +22,13 @@
  ******************************************************************************/
 #include "librarydownload.h"
 
+#include <librepcb/core/exceptions.h>
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/library/library.h>
 #include <librepcb/core/network/filedownload.h>
+#include <librepcb/core/network/networkrequest.h>
 
+#include <QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -43,7 +46,19 @@ LibraryDownload::LibraryDownload(const QUrl& urlToZip,
   : QObject(nullptr),
     mDestDir(destDir),
     mTempDestDir(destDir.toStr() % ".tmp"),
-    mTempZipFile(mDestDir.toStr() % ".zip") {
+    mTempZipFile(mDestDir.toStr() % ".zip"),
+    mStarted(false),
+    mAbortRequested(false),
+    mManifestUrl(),
+    mManifest(),
+    mLocalManifestWatcher(),
+    mModifiedElements(),
+    mRemovedElements(),
+    mPendingElements(),
+    mRunningDownloads(0),
+    mFinishedDownloads(0),
+    mDeltaUpdateFailed(false),
+    mChangedElementDirs() {
   mFileDownload.reset(new FileDownload(urlToZip, mTempZipFile));
   mFileDownload->setZipExtractionDirectory(mTempDestDir);
   connect(mFileDownload.data(), &FileDownload::progressState, this,
@@ -58,10 +73,13 @@ LibraryDownload::LibraryDownload(const QUrl& urlToZip,
           &LibraryDownload::downloadSucceeded, Qt::QueuedConnection);
   connect(this, &LibraryDownload::abortRequested, mFileDownload.data(),
           &FileDownload::abort, Qt::QueuedConnection);
+  connect(&mLocalManifestWatcher, &QFutureWatcher<LibraryManifest>::finished,
+          this, &LibraryDownload::localManifestCalculated);
 }
 
 LibraryDownload::~LibraryDownload() noexcept {
   abort();
+  mLocalManifestWatcher.waitForFinished();
 }
 
 /*******************************************************************************
@@ -88,12 +106,21 @@ void LibraryDownload::setExpectedChecksum(
   }
 }
 
+void LibraryDownload::setManifestUrl(const QUrl& url) noexcept {
+  if (!mStarted) {
+    mManifestUrl = url;
+  } else {
+    qCritical() << "Calling LibraryDownload::setManifestUrl() after "
+                   "start() is not allowed!";
+  }
+}
+
 /*******************************************************************************
  *  Public Slots
  ******************************************************************************/
 
 void LibraryDownload::start() noexcept {
-  if (!mFileDownload) {
+  if (mStarted || (!mFileDownload)) {
     qCritical()
         << "Calling LibraryDownload::start() multiple times is not allowed!";
     return;
@@ -121,12 +148,19 @@ void LibraryDownload::start() noexcept {
     }
   }
 
-  // Release ownership of the FileDownload object because it will be deleted by
-  // itself after the download finished!
-  mFileDownload.take()->start();
+  // If the library is already installed, try to update only the modified
+  // elements instead of downloading the whole library.
+  mStarted = true;
+  if (mManifestUrl.isValid() &&
+      Library::isValidElementDirectory<Library>(mDestDir)) {
+    startDeltaUpdate();
+  } else {
+    startFullDownload();
+  }
 }
 
 void LibraryDownload::abort() noexcept {
+  mAbortRequested = true;
   emit abortRequested();
 }
 
@@ -134,6 +168,241 @@ void LibraryDownload::abort() noexcept {
  *  Private Methods
  ******************************************************************************/
 
+void LibraryDownload::startFullDownload() noexcept {
+  // Release ownership of the FileDownload object because it will be deleted by
+  // itself after the download finished!
+  mFileDownload.take()->start();
+}
+
+void LibraryDownload::startDeltaUpdate() noexcept {
+  emit progressState(tr("Download library manifest..."));
+  NetworkRequest* request = new NetworkRequest(mManifestUrl);
+  connect(request, &NetworkRequest::dataReceived, this,
+          &LibraryDownload::manifestReceived, Qt::QueuedConnection);
+  connect(
+      request, &NetworkRequest::errored, this,
+      [this](const QString& errMsg) {
+        qWarning() << "Failed to download library manifest, downloading the "
+                      "whole library instead:"
+                   << errMsg;
+        startFullDownload();
+      },
+      Qt::QueuedConnection);
+  connect(request, &NetworkRequest::aborted, this,
+          &LibraryDownload::downloadAborted, Qt::QueuedConnection);
+  connect(this, &LibraryDownload::abortRequested, request,
+          &NetworkRequest::abort, Qt::QueuedConnection);
+  request->start();
+}
+
+void LibraryDownload::manifestReceived(const QByteArray& data) noexcept {
+  try {
+    mManifest = LibraryManifest::fromJson(data, mManifestUrl);  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Invalid library manifest, downloading the whole library "
+                  "instead:"
+               << e.getMsg();
+    startFullDownload();
+    return;
+  }
+
+  // Hashing the installed library may take a moment, thus do it in a worker
+  // thread.
+  emit progressState(tr("Compare library elements..."));
+  mLocalManifestWatcher.setFuture(
+      QtConcurrent::run(&LibraryManifest::fromDirectory, mDestDir));
+}
+
+void LibraryDownload::localManifestCalculated() noexcept {
+  if (mAbortRequested) {
+    emit finished(false, QString());
+    return;
+  }
+
+  LibraryManifest installed;
+  try {
+    installed = mLocalManifestWatcher.result();  // can throw
+  } catch (const Exception& e) {
+    qWarning() << "Failed to compare installed library, downloading the "
+                  "whole library instead:"
+               << e.getMsg();
+    startFullDownload();
+    return;
+  }
+
+  mModifiedElements = mManifest.getModifiedElements(installed);
+  mRemovedElements = mManifest.getRemovedElements(installed);
+  mPendingElements = mModifiedElements;
+  qDebug() << "Library delta update:" << mModifiedElements.count()
+           << "modified and" << mRemovedElements.count()
+           << "removed elements.";
+  if (mModifiedElements.isEmpty()) {
+    applyDeltaUpdate();
+  } else {
+    emit progressState(tr("Download library elements..."));
+    startElementDownloads();
+  }
+}
+
+void LibraryDownload::startElementDownloads() noexcept {
+  while ((mRunningDownloads < sMaxParallelDownloads) &&
+         (!mPendingElements.isEmpty())) {
+    const QString element = mPendingElements.takeFirst();
+    const FilePath zipFp = mTempDestDir.getPathTo(
+        QString::number(mFinishedDownloads + mRunningDownloads) % ".zip");
+    FileDownload* dl = new FileDownload(mManifest.getUrl(element), zipFp);
+    dl->setZipExtractionDirectory(getTempElementsDir().getPathTo(element));
+    connect(
+        dl, &FileDownload::succeeded, this,
+        [this, element]() { elementDownloadSucceeded(element); },
+        Qt::QueuedConnection);
+    connect(dl, &FileDownload::errored, this,
+            &LibraryDownload::elementDownloadFailed, Qt::QueuedConnection);
+    connect(
+        dl, &FileDownload::aborted, this,
+        [this]() { elementDownloadFailed(QString()); }, Qt::QueuedConnection);
+    connect(this, &LibraryDownload::abortRequested, dl, &FileDownload::abort,
+            Qt::QueuedConnection);
+    ++mRunningDownloads;
+    dl->start();
+  }
+}
+
+void LibraryDownload::elementDownloadSucceeded(
+    const QString& element) noexcept {
+  --mRunningDownloads;
+  ++mFinishedDownloads;
+  if (mDeltaUpdateFailed) {
+    return;
+  }
+
+  // Verify the downloaded element against the manifest.
+  try {
+    const QByteArray hash = LibraryManifest::calcElementHash(
+        getTempElementsDir().getPathTo(element), element != ".");
+    if (hash != mManifest.getHashes().value(element)) {
+      throw RuntimeError(
+          __FILE__, __LINE__,
+          tr("Checksum verification of library element \"%1\" failed!")
+              .arg(element));
+    }
+  } catch (const Exception& e) {
+    elementDownloadFailed(e.getMsg());
+    return;
+  }
+
+  emit progressPercent((mFinishedDownloads * 100) / mModifiedElements.count());
+  if ((mRunningDownloads == 0) && mPendingElements.isEmpty()) {
+    applyDeltaUpdate();
+  } else {
+    startElementDownloads();
+  }
+}
+
+void LibraryDownload::elementDownloadFailed(const QString& errMsg) noexcept {
+  if (!mDeltaUpdateFailed) {
+    mDeltaUpdateFailed = true;
+    mPendingElements.clear();
+    emit abortRequested();  // Abort all other downloads.
+    try {
+      FileUtils::removeDirRecursively(mTempDestDir);  // can throw
+    } catch (...) {
+    }
+    emit finished(false, errMsg);
+  }
+}
+
+void LibraryDownload::applyDeltaUpdate() noexcept {
+  emit progressState(tr("Replace library elements..."));
+  const FilePath tempDir = getTempElementsDir();
+  const FilePath backupDir(mDestDir.toStr() % ".backup");
+  QList<std::pair<FilePath, FilePath>> movedEntries;
+  auto move = [&movedEntries](const FilePath& src, const FilePath& dst) {
+    FileUtils::move(src, dst);  // can throw
+    movedEntries.append(std::make_pair(src, dst));
+  };
+  // Element paths are validated when loading the manifest, but make sure
+  // nothing outside of the involved directories is ever touched.
+  auto resolve = [](const FilePath& root, const QString& entry) -> FilePath {
+    const FilePath fp = root.getPathTo(entry);
+    if (!fp.isLocatedInDir(root)) {
+      throw RuntimeError(__FILE__, __LINE__,
+                         tr("Invalid library element path: %1").arg(entry));
+    }
+    return fp;
+  };
+  try {
+    // Move outdated entries into the backup directory.
+    FileUtils::removeDirRecursively(backupDir);  // can throw
+    foreach (const QString& element, mModifiedElements + mRemovedElements) {
+      foreach (const QString& entry, getElementEntries(mDestDir, element)) {
+        move(resolve(mDestDir, entry), resolve(backupDir, entry));
+      }
+    }
+
+    // Move downloaded entries into the library.
+    foreach (const QString& element, mModifiedElements) {
+      foreach (const QString& entry, getElementEntries(tempDir, element)) {
+        move(resolve(tempDir, entry), resolve(mDestDir, entry));
+      }
+    }
+  } catch (const Exception& e) {
+    // Restore the original library.
+    for (int i = movedEntries.count() - 1; i >= 0; --i) {
+      try {
+        FileUtils::move(movedEntries.at(i).second, movedEntries.at(i).first);
+      } catch (...) {
+      }
+    }
+    try {
+      FileUtils::removeDirRecursively(mTempDestDir);
+      FileUtils::removeDirRecursively(backupDir);
+    } catch (...) {
+    }
+    emit finished(false, e.getMsg());
+    return;
+  }
+
+  // clean up
+  try {
+    FileUtils::removeDirRecursively(mTempDestDir);  // can throw
+    FileUtils::removeDirRecursively(backupDir);  // can throw
+  } catch (...) {
+  }
+
+  // Note: The library itself (element ".") is not a library element, the
+  // library scanner updates it anyway.
+  QSet<FilePath> changedDirs;
+  foreach (const QString& element, mModifiedElements + mRemovedElements) {
+    if (element != ".") {
+      changedDirs.insert(mDestDir.getPathTo(element));
+    }
+  }
+  mChangedElementDirs = changedDirs;
+  emit finished(true, QString());
+}
+
+FilePath LibraryDownload::getTempElementsDir() const noexcept {
+  return mTempDestDir.getPathTo("elements");
+}
+
+QStringList LibraryDownload::getElementEntries(
+    const FilePath& root, const QString& element) noexcept {
+  QStringList entries;
+  if (element == ".") {
+    // Only the files located directly in the library root.
+    const QDir::Filters filter = QDir::Files | QDir::Hidden;
+    foreach (const QString& fileName, QDir(root.toStr()).entryList(filter)) {
+      if (fileName != ".lock") {
+        entries.append(fileName);
+      }
+    }
+  } else if (root.getPathTo(element).isExistingDir()) {
+    entries.append(element);
+  }
+  return entries;
+}
+
 void LibraryDownload::downloadErrored(const QString& errMsg) noexcept {
   emit LibraryDownload::finished(false, errMsg);
 }
@@ -24,6 +24,8 @@
  *  Includes
  ******************************************************************************/
 #include <librepcb/core/fileio/filepath.h>
+#include <librepcb/core/library/librarymanifest.h>
+#include <optional.hpp>
 
 #include <QtCore>
 
@@ -56,6 +58,17 @@ public:
   // Getters
   const FilePath& getDestinationDir() const noexcept { return mDestDir; }
 
+  /**
+   * @brief Get the library elements changed by a delta update
+   *
+   * @return Directories of all added, modified or removed library elements
+   *         if the library was updated by a delta update, or `tl::nullopt`
+   *         if the whole library was downloaded.
+   */
+  const tl::optional<QSet<FilePath>>& getChangedElementDirs() const noexcept {
+    return mChangedElementDirs;
+  }
+
   // Setters
 
   /**
@@ -69,6 +82,18 @@ public:
   void setExpectedChecksum(QCryptographicHash::Algorithm algorithm,
                            const QByteArray& checksum) noexcept;
 
+  /**
+   * @brief Enable delta updates by specifying the URL to the library manifest
+   *
+   * If set and the library is already installed, only the elements which
+   * differ from the manifest (see ::librepcb::LibraryManifest) are
+   * downloaded and replaced, instead of the whole library. If the manifest
+   * is not available, the whole library is downloaded as usual.
+   *
+   * @param url     URL to the JSON manifest of the library to download.
+   */
+  void setManifestUrl(const QUrl& url) noexcept;
+
   // Operator Overloadings
   LibraryDownload& operator=(const LibraryDownload& rhs) = delete;
 
@@ -92,6 +117,17 @@ signals:
   void abortRequested();  // internal signal!
 
 private:  // Methods
+  void startFullDownload() noexcept;
+  void startDeltaUpdate() noexcept;
+  void manifestReceived(const QByteArray& data) noexcept;
+  void localManifestCalculated() noexcept;
+  void startElementDownloads() noexcept;
+  void elementDownloadSucceeded(const QString& element) noexcept;
+  void elementDownloadFailed(const QString& errMsg) noexcept;
+  void applyDeltaUpdate() noexcept;
+  FilePath getTempElementsDir() const noexcept;
+  static QStringList getElementEntries(const FilePath& root,
+                                       const QString& element) noexcept;
   void downloadErrored(const QString& errMsg) noexcept;
   void downloadAborted() noexcept;
   void downloadSucceeded() noexcept;
@@ -102,6 +138,23 @@ private:  // Data
   FilePath mDestDir;
   FilePath mTempDestDir;
   FilePath mTempZipFile;
+  bool mStarted;
+  bool mAbortRequested;
+
+  // Delta update
+  QUrl mManifestUrl;
+  LibraryManifest mManifest;
+  QFutureWatcher<LibraryManifest> mLocalManifestWatcher;
+  QStringList mModifiedElements;
+  QStringList mRemovedElements;
+  QStringList mPendingElements;  ///< Modified elements not downloaded yet
+  int mRunningDownloads;
+  int mFinishedDownloads;
+  bool mDeltaUpdateFailed;
+  tl::optional<QSet<FilePath>> mChangedElementDirs;
+
+  /// Maximum number of element downloads running in parallel
+  static constexpr int sMaxParallelDownloads = 4;
 };
 
 /*******************************************************************************
@@ -130,6 +130,7 @@ void OnlineLibraryListWidgetItem::startDownloadIfSelected() noexcept {
     qint64 zipSize = mJsonObject.value("download_size").toInt(-1);
     QByteArray zipSha256 =
         mJsonObject.value("download_sha256").toString().toUtf8();
+    QUrl manifestUrl = QUrl(mJsonObject.value("manifest_url").toString());
 
     // determine destination directory
     QString libDirName = mUuid->toStr() % ".lplib";
@@ -145,6 +146,9 @@ void OnlineLibraryListWidgetItem::startDownloadIfSelected() noexcept {
       mLibraryDownload->setExpectedChecksum(QCryptographicHash::Sha256,
                                             QByteArray::fromHex(zipSha256));
     }
+    if (manifestUrl.isValid()) {
+      mLibraryDownload->setManifestUrl(manifestUrl);
+    }
     connect(mLibraryDownload.data(), &LibraryDownload::progressPercent,
             mUi->prgProgress, &QProgressBar::setValue, Qt::QueuedConnection);
     connect(mLibraryDownload.data(), &LibraryDownload::finished, this,
@@ -172,11 +176,19 @@ void OnlineLibraryListWidgetItem::downloadFinished(
   // new library is indexed.
   mUi->prgProgress->setVisible(false);
 
+  // After a delta update, only the changed elements need to be rescanned
+  const tl::optional<QSet<FilePath>> changedElementDirs =
+      mLibraryDownload->getChangedElementDirs();
+
   // delete download helper
   mLibraryDownload.reset();
 
   // start library scanner to index the new library
-  mWorkspace.getLibraryDb().startLibraryRescan();
+  if (changedElementDirs) {
+    mWorkspace.getLibraryDb().startLibraryElementsRescan(*changedElementDirs);
+  } else {
+    mWorkspace.getLibraryDb().startLibraryRescan();
+  }
 }
 
 void OnlineLibraryListWidgetItem::iconReceived(
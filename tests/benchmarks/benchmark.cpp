@@ -0,0 +1,196 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+
+#include <QtCore>
+
+#include <algorithm>
+#include <numeric>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Local Functions
+ ******************************************************************************/
+
+static qint64 median(const QVector<qint64>& sorted) noexcept {
+  if (sorted.isEmpty()) {
+    return 0;
+  }
+  const int n = sorted.count();
+  return (n % 2) ? sorted.at(n / 2)
+                 : ((sorted.at(n / 2 - 1) + sorted.at(n / 2)) / 2);
+}
+
+static qint64 mean(const QVector<qint64>& samples) noexcept {
+  if (samples.isEmpty()) {
+    return 0;
+  }
+  return std::accumulate(samples.begin(), samples.end(), qint64(0)) /
+      samples.count();
+}
+
+static QString formatTime(qint64 ns) noexcept {
+  if (ns >= 1000000000) {
+    return QString::number(ns / 1e9, 'f', 3) % " s";
+  } else if (ns >= 1000000) {
+    return QString::number(ns / 1e6, 'f', 3) % " ms";
+  } else {
+    return QString::number(ns / 1e3, 'f', 3) % " us";
+  }
+}
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+Benchmark::Benchmark(const char* suite, const char* name,
+                     Function func) noexcept
+  : mSuite(suite), mName(name), mFunction(func) {
+  registry().append(this);
+}
+
+QList<const Benchmark*>& Benchmark::registry() noexcept {
+  // Function-local static to not depend on the initialization order of
+  // static objects across translation units.
+  static QList<const Benchmark*> list;
+  return list;
+}
+
+/*******************************************************************************
+ *  Class BenchmarkRunner
+ ******************************************************************************/
+
+BenchmarkRunner::BenchmarkRunner(int iterations, int scale) noexcept
+  : mIterations(iterations), mScale(scale), mResults() {
+}
+
+void BenchmarkRunner::run(const Benchmark& benchmark) noexcept {
+  const FilePath tmpDir = FilePath::getRandomTempPath();
+  Result result;
+  result.name = benchmark.getFullName();
+  try {
+    FileUtils::makePath(tmpDir);  // can throw
+    BenchmarkState state(mIterations, mScale, tmpDir);
+    benchmark.getFunction()(state);  // can throw
+    result.samples = state.getSamples();
+    result.counters = state.getCounters();
+    std::sort(result.samples.begin(), result.samples.end());
+    if (result.samples.isEmpty()) {
+      result.error = "Benchmark did not measure anything.";
+    }
+  } catch (const Exception& e) {
+    result.error = e.getMsg();
+  } catch (const std::exception& e) {
+    result.error = e.what();
+  }
+  QDir(tmpDir.toStr()).removeRecursively();
+  mResults.append(result);
+}
+
+void BenchmarkRunner::printSummary(QTextStream& stream) const noexcept {
+  int nameWidth = 10;
+  foreach (const Result& result, mResults) {
+    nameWidth = std::max(nameWidth, result.name.length());
+  }
+  stream << QString("Benchmark").leftJustified(nameWidth) << "  "
+         << QString("Min").rightJustified(12) << "  "
+         << QString("Median").rightJustified(12) << "  "
+         << QString("Mean").rightJustified(12) << "  "
+         << QString("Max").rightJustified(12) << endl;
+  foreach (const Result& result, mResults) {
+    stream << result.name.leftJustified(nameWidth) << "  ";
+    if (result.error.isEmpty()) {
+      stream << formatTime(result.samples.first()).rightJustified(12) << "  "
+             << formatTime(median(result.samples)).rightJustified(12) << "  "
+             << formatTime(mean(result.samples)).rightJustified(12) << "  "
+             << formatTime(result.samples.last()).rightJustified(12);
+      for (auto it = result.counters.begin(); it != result.counters.end();
+           ++it) {
+        stream << "  " << it.key() << "=" << it.value();
+      }
+    } else {
+      stream << "ERROR: " << result.error;
+    }
+    stream << endl;
+  }
+}
+
+void BenchmarkRunner::writeJson(const FilePath& fp) const {
+  QJsonObject context;
+  context["version"] = Application::getVersion();
+  context["git_revision"] = Application::getGitRevision();
+  context["date"] = QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+  context["qt_version"] = QString(qVersion());
+  context["os"] = QSysInfo::prettyProductName();
+  context["cpu_architecture"] = QSysInfo::currentCpuArchitecture();
+  context["cpu_count"] = QThread::idealThreadCount();
+  context["iterations"] = mIterations;
+  context["scale"] = mScale;
+
+  QJsonArray benchmarks;
+  foreach (const Result& result, mResults) {
+    QJsonObject obj;
+    obj["name"] = result.name;
+    if (result.error.isEmpty()) {
+      QJsonArray samples;
+      foreach (qint64 ns, result.samples) {
+        samples.append(static_cast<double>(ns));
+      }
+      obj["min_ns"] = static_cast<double>(result.samples.first());
+      obj["median_ns"] = static_cast<double>(median(result.samples));
+      obj["mean_ns"] = static_cast<double>(mean(result.samples));
+      obj["max_ns"] = static_cast<double>(result.samples.last());
+      obj["samples_ns"] = samples;
+      QJsonObject counters;
+      for (auto it = result.counters.begin(); it != result.counters.end();
+           ++it) {
+        counters[it.key()] = it.value();
+      }
+      obj["counters"] = counters;
+    } else {
+      obj["error"] = result.error;
+    }
+    benchmarks.append(obj);
+  }
+
+  QJsonObject root;
+  root["context"] = context;
+  root["benchmarks"] = benchmarks;
+  FileUtils::writeFile(fp, QJsonDocument(root).toJson());  // can throw
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
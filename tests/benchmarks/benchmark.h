@@ -0,0 +1,237 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_BENCHMARK_H
+#define BENCHMARKS_BENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/fileio/filepath.h>
+
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BenchmarkState
+ ******************************************************************************/
+
+/**
+ * @brief State passed to a benchmark function while it is executed
+ *
+ * A benchmark function prepares its (untimed) input data, then passes the
+ * code to be timed to #measure(). Additional metrics (e.g. the number of
+ * processed objects) can be reported with #setCounter().
+ */
+class BenchmarkState final {
+public:
+  // Constructors / Destructor
+  BenchmarkState() = delete;
+  BenchmarkState(const BenchmarkState& other) = delete;
+  BenchmarkState(int iterations, int scale, const FilePath& tmpDir) noexcept
+    : mIterations(iterations), mScale(scale), mTmpDir(tmpDir) {}
+  ~BenchmarkState() noexcept {}
+
+  // Getters
+
+  /**
+   * @brief Get the size factor of the generated input data
+   *
+   * Benchmarks shall scale their synthetic input data linearly with this
+   * factor, so the same benchmark can be run on small and large designs.
+   */
+  int getScale() const noexcept { return mScale; }
+
+  /**
+   * @brief Get an empty temporary directory exclusively for this benchmark
+   *
+   * The directory is removed after the benchmark has been executed.
+   */
+  const FilePath& getTmpDir() const noexcept { return mTmpDir; }
+
+  const QVector<qint64>& getSamples() const noexcept { return mSamples; }
+  const QMap<QString, qreal>& getCounters() const noexcept { return mCounters; }
+
+  // General Methods
+
+  /**
+   * @brief Measure the execution time of a function
+   *
+   * The function is executed once for warmup (not timed), then the configured
+   * number of iterations are timed individually.
+   *
+   * @param func    The function to measure. It must be repeatable, i.e.
+   *                every call must perform the same work.
+   */
+  template <typename Func>
+  void measure(Func func) {
+    func();  // warmup
+    QElapsedTimer timer;
+    for (int i = 0; i < mIterations; ++i) {
+      timer.start();
+      func();
+      mSamples.append(timer.nsecsElapsed());
+    }
+  }
+
+  /**
+   * @brief Report an additional metric of the benchmark
+   *
+   * @param name    Name of the metric, e.g. "vias".
+   * @param value   Value of the metric.
+   */
+  void setCounter(const QString& name, qreal value) noexcept {
+    mCounters[name] = value;
+  }
+
+  // Operator Overloadings
+  BenchmarkState& operator=(const BenchmarkState& rhs) = delete;
+
+private:  // Data
+  const int mIterations;
+  const int mScale;
+  const FilePath mTmpDir;
+  QVector<qint64> mSamples;  ///< Execution times [ns]
+  QMap<QString, qreal> mCounters;
+};
+
+/*******************************************************************************
+ *  Class Benchmark
+ ******************************************************************************/
+
+/**
+ * @brief A registered benchmark
+ *
+ * Benchmarks are not instantiated directly, use the ::LIBREPCB_BENCHMARK
+ * macro to define and register them.
+ */
+class Benchmark final {
+public:
+  // Types
+  typedef std::function<void(BenchmarkState&)> Function;
+
+  // Constructors / Destructor
+  Benchmark() = delete;
+  Benchmark(const Benchmark& other) = delete;
+  Benchmark(const char* suite, const char* name, Function func) noexcept;
+  ~Benchmark() noexcept {}
+
+  // Getters
+  const QString& getSuite() const noexcept { return mSuite; }
+  const QString& getName() const noexcept { return mName; }
+  QString getFullName() const noexcept { return mSuite % "." % mName; }
+  const Function& getFunction() const noexcept { return mFunction; }
+
+  // Static Methods
+  static const QList<const Benchmark*>& getAll() noexcept {
+    return registry();
+  }
+
+  // Operator Overloadings
+  Benchmark& operator=(const Benchmark& rhs) = delete;
+
+private:  // Methods
+  static QList<const Benchmark*>& registry() noexcept;
+
+private:  // Data
+  const QString mSuite;
+  const QString mName;
+  const Function mFunction;
+};
+
+/*******************************************************************************
+ *  Class BenchmarkRunner
+ ******************************************************************************/
+
+/**
+ * @brief Executes benchmarks and collects their results
+ */
+class BenchmarkRunner final {
+public:
+  // Types
+  struct Result {
+    QString name;
+    QVector<qint64> samples;  ///< Sorted execution times [ns]
+    QMap<QString, qreal> counters;
+    QString error;  ///< Empty on success
+  };
+
+  // Constructors / Destructor
+  BenchmarkRunner() = delete;
+  BenchmarkRunner(const BenchmarkRunner& other) = delete;
+  BenchmarkRunner(int iterations, int scale) noexcept;
+  ~BenchmarkRunner() noexcept {}
+
+  // Getters
+  const QList<Result>& getResults() const noexcept { return mResults; }
+
+  // General Methods
+  void run(const Benchmark& benchmark) noexcept;
+  void printSummary(QTextStream& stream) const noexcept;
+  void writeJson(const FilePath& fp) const;
+
+  // Operator Overloadings
+  BenchmarkRunner& operator=(const BenchmarkRunner& rhs) = delete;
+
+private:  // Data
+  const int mIterations;
+  const int mScale;
+  QList<Result> mResults;
+};
+
+/*******************************************************************************
+ *  Macros
+ ******************************************************************************/
+
+/**
+ * @brief Define and register a benchmark
+ *
+ * Usage:
+ *
+ * @code
+ * LIBREPCB_BENCHMARK(SExpression, Parse) {
+ *   const QByteArray content = ...;  // prepare input data (not timed)
+ *   state.measure([&]() { SExpression::parse(content, FilePath()); });
+ * }
+ * @endcode
+ */
+#define LIBREPCB_BENCHMARK(suite, name)                                   \
+  static void benchmark_##suite##_##name(                                 \
+      ::librepcb::benchmarks::BenchmarkState& state);                     \
+  static const ::librepcb::benchmarks::Benchmark                          \
+      sBenchmark_##suite##_##name(#suite, #name,                          \
+                                  &benchmark_##suite##_##name);           \
+  static void benchmark_##suite##_##name(                                 \
+      ::librepcb::benchmarks::BenchmarkState& state)
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
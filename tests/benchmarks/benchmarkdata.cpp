@@ -0,0 +1,179 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmarkdata.h"
+
+#include <librepcb/core/fileio/transactionaldirectory.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/geometry/via.h>
+#include <librepcb/core/library/library.h>
+#include <librepcb/core/library/sym/symbol.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardpolygondata.h>
+#include <librepcb/core/project/board/items/bi_netline.h>
+#include <librepcb/core/project/board/items/bi_netpoint.h>
+#include <librepcb/core/project/board/items/bi_netsegment.h>
+#include <librepcb/core/project/board/items/bi_plane.h>
+#include <librepcb/core/project/board/items/bi_polygon.h>
+#include <librepcb/core/project/board/items/bi_via.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/netclass.h>
+#include <librepcb/core/project/circuit/netsignal.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/types/layer.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+Uuid BenchmarkData::uuid(quint32 type, quint64 index) {
+  return Uuid::fromString(QString("%1-0000-4000-8000-%2")
+                              .arg(type, 8, 16, QChar('0'))
+                              .arg(index, 12, 16, QChar('0')));  // can throw
+}
+
+std::unique_ptr<Project> BenchmarkData::createBoardProject(const FilePath& dir,
+                                                           int scale) {
+  enum UuidType : quint32 {
+    BoardUuid = 1,
+    OutlineUuid,
+    NetSignalUuid,
+    NetSegmentUuid,
+    ViaUuid,
+    NetPointUuid,
+    NetLineUuid,
+    PlaneUuid,
+  };
+
+  std::unique_ptr<Project> project = Project::create(
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+          TransactionalFileSystem::openRW(dir))),
+      getProjectFileName());  // can throw
+
+  Board* board = new Board(
+      *project,
+      std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory()),
+      "default", uuid(BoardUuid, 0), ElementName("Benchmark"));  // can throw
+  project->addBoard(*board);  // can throw
+
+  // Board outline.
+  const int columns = 20 * scale;
+  const int rows = 16 * scale;
+  const Length pitch(5000000);
+  const Path outline =
+      Path::rect(Point(0, 0), Point(pitch * columns, pitch * rows));
+  board->addPolygon(*new BI_Polygon(
+      *board,
+      BoardPolygonData(uuid(OutlineUuid, 0), Layer::boardOutlines(),
+                       UnsignedLength(0), outline, false, false, false)));
+
+  // Nets.
+  Circuit& circuit = project->getCircuit();
+  NetClass* netclass = circuit.getNetClasses().first();
+  QVector<NetSignal*> netsignals;
+  for (int i = 0; i < 8 * scale; ++i) {
+    NetSignal* netsignal =
+        new NetSignal(circuit, uuid(NetSignalUuid, i), *netclass,
+                      CircuitIdentifier(QString("N%1").arg(i)), false);
+    circuit.addNetSignal(*netsignal);  // can throw
+    netsignals.append(netsignal);
+  }
+
+  // Traces & vias.
+  const PositiveLength viaSize(600000);
+  const PositiveLength viaDrill(300000);
+  const PositiveLength traceWidth(200000);
+  for (int y = 0; y < rows; ++y) {
+    for (int x = 0; x < columns; ++x) {
+      const int i = y * columns + x;
+      const Point center(pitch * x + pitch / 2, pitch * y + pitch / 2);
+      NetSignal* netsignal = netsignals.at(i % netsignals.count());
+      BI_NetSegment* segment =
+          new BI_NetSegment(*board, uuid(NetSegmentUuid, i), netsignal);
+      BI_Via* via = new BI_Via(
+          *segment,
+          Via(uuid(ViaUuid, i), Layer::topCopper(), Layer::botCopper(),
+              center, viaSize, viaDrill, MaskConfig::off()));
+      BI_NetPoint* netpoint =
+          new BI_NetPoint(*segment, uuid(NetPointUuid, i),
+                          center + Point(pitch / 4, pitch / 4));
+      BI_NetLine* netline =
+          new BI_NetLine(*segment, uuid(NetLineUuid, i), *via, *netpoint,
+                         Layer::topCopper(), traceWidth);
+      segment->addElements({via}, {netpoint}, {netline});  // can throw
+      board->addNetSegment(*segment);  // can throw
+    }
+  }
+
+  // Planes.
+  board->addPlane(*new BI_Plane(*board, uuid(PlaneUuid, 0), Layer::topCopper(),
+                                netsignals.first(), outline));  // can throw
+  board->addPlane(*new BI_Plane(*board, uuid(PlaneUuid, 1), Layer::botCopper(),
+                                netsignals.first(), outline));  // can throw
+
+  project->save();  // can throw
+  project->getDirectory().getFileSystem()->save();  // can throw
+  return project;
+}
+
+int BenchmarkData::createWorkspaceLibraries(const FilePath& librariesDir,
+                                            int scale) {
+  enum UuidType : quint32 {
+    LibraryUuid = 1,
+    SymbolUuid,
+  };
+
+  const Version version = Version::fromString("0.1");
+  std::shared_ptr<TransactionalFileSystem> fs = TransactionalFileSystem::openRW(
+      librariesDir.getPathTo("local/Benchmark.lplib"));  // can throw
+  TransactionalDirectory libDir(fs);
+  Library lib(uuid(LibraryUuid, 0), version, "LibrePCB",
+              ElementName("Benchmark"), "Benchmark library", "");
+  lib.saveTo(libDir);  // can throw
+
+  TransactionalDirectory symDir(libDir, "sym");
+  const int symbolCount = 200 * scale;
+  for (int i = 0; i < symbolCount; ++i) {
+    Symbol sym(uuid(SymbolUuid, i), version, "LibrePCB",
+               ElementName(QString("Symbol %1").arg(i)),
+               QString("Description of symbol %1").arg(i),
+               QString("benchmark,symbol%1").arg(i));
+    sym.saveIntoParentDirectory(symDir);  // can throw
+  }
+  fs->save();  // can throw
+  return 1 + symbolCount;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
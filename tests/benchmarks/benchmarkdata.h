@@ -0,0 +1,121 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARKS_BENCHMARKDATA_H
+#define BENCHMARKS_BENCHMARKDATA_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/core/types/uuid.h>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+class Board;
+class FilePath;
+class Project;
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class BenchmarkData
+ ******************************************************************************/
+
+/**
+ * @brief Generators for synthetic, deterministic benchmark input data
+ *
+ * All generated data only depends on the passed scale factor (UUIDs are
+ * derived from a counter, not randomly generated), so results of different
+ * runs and different revisions are comparable.
+ */
+class BenchmarkData final {
+public:
+  // Constructors / Destructor
+  BenchmarkData() = delete;
+  BenchmarkData(const BenchmarkData& other) = delete;
+  ~BenchmarkData() = delete;
+
+  // Operator Overloadings
+  BenchmarkData& operator=(const BenchmarkData& rhs) = delete;
+
+  // Static Methods
+
+  /**
+   * @brief Create a deterministic UUID
+   *
+   * @param type    Object type discriminator (to avoid collisions between
+   *                different kinds of objects).
+   * @param index   Object index within its type.
+   *
+   * @return A valid UUID.
+   */
+  static Uuid uuid(quint32 type, quint64 index);
+
+  /**
+   * @brief Create a project containing a large routed board
+   *
+   * The board has a grid of (20 * scale) x (16 * scale) cells with a pitch of
+   * 5mm. Each cell contains a net segment consisting of a through-hole via
+   * and a trace on the top layer. The net segments are assigned round-robin
+   * to (8 * scale) nets, and both outer layers are covered by a plane
+   * connected to the first net.
+   *
+   * The project is saved to disk.
+   *
+   * @param dir     The (not yet existing) project directory.
+   * @param scale   Size factor.
+   *
+   * @return The opened project. Its file system is writable.
+   */
+  static std::unique_ptr<Project> createBoardProject(const FilePath& dir,
+                                                     int scale);
+
+  /**
+   * @brief Get the project filename used by #createBoardProject()
+   */
+  static QString getProjectFileName() noexcept { return "benchmark.lpp"; }
+
+  /**
+   * @brief Create a workspace libraries directory with a large local library
+   *
+   * Creates `local/Benchmark.lplib` containing (200 * scale) symbols.
+   *
+   * @param librariesDir  The (not yet existing) libraries directory.
+   * @param scale         Size factor.
+   *
+   * @return Number of created library elements (including the library).
+   */
+  static int createWorkspaceLibraries(const FilePath& librariesDir, int scale);
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif
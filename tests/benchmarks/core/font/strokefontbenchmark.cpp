@@ -0,0 +1,70 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/font/strokefont.h>
+#include <librepcb/core/font/stroketextpathbuilder.h>
+#include <librepcb/core/types/alignment.h>
+#include <librepcb/core/types/stroketextspacing.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(StrokeFont, BuildDeviceTexts) {
+  // Like the name and value texts of all devices on a board.
+  const StrokeFont& font = Application::getDefaultStrokeFont();
+  const int count = 500 * state.getScale();
+  QStringList texts;
+  for (int i = 0; i < count; ++i) {
+    texts.append(QString("R%1").arg(i));
+    texts.append(QString("%1k").arg(i % 100));
+  }
+  const StrokeTextSpacing spacing;
+  const PositiveLength height(1000000);
+  const UnsignedLength strokeWidth(200000);
+  const Alignment align(HAlign::left(), VAlign::bottom());
+  state.setCounter("texts", texts.count());
+  state.measure([&]() {
+    foreach (const QString& text, texts) {
+      StrokeTextPathBuilder::build(font, spacing, spacing, height, strokeWidth,
+                                   align, Angle::deg0(), true, text);
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
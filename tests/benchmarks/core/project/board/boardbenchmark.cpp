@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../../benchmark.h"
+#include "../../../benchmarkdata.h"
+
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/boardairwiresbuilder.h>
+#include <librepcb/core/project/board/boardfabricationoutputsettings.h>
+#include <librepcb/core/project/board/boardgerberexport.h>
+#include <librepcb/core/project/board/boardplanefragmentsbuilder.h>
+#include <librepcb/core/project/board/drc/boarddesignrulecheck.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(BoardPlaneFragmentsBuilder, RunSynchronously) {
+  std::unique_ptr<Project> project = BenchmarkData::createBoardProject(
+      state.getTmpDir().getPathTo("project"), state.getScale());
+  Board& board = *project->getBoards().first();
+  state.setCounter("planes", board.getPlanes().count());
+  state.setCounter("netsegments", board.getNetSegments().count());
+  state.measure([&]() {
+    BoardPlaneFragmentsBuilder builder;
+    builder.runSynchronously(board);
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardDesignRuleCheck, Execute) {
+  std::unique_ptr<Project> project = BenchmarkData::createBoardProject(
+      state.getTmpDir().getPathTo("project"), state.getScale());
+  Board& board = *project->getBoards().first();
+  state.setCounter("netsegments", board.getNetSegments().count());
+  state.measure([&]() {
+    BoardDesignRuleCheck drc(board, board.getDrcSettings());
+    drc.execute(false);
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardDesignRuleCheck, ExecuteQuick) {
+  std::unique_ptr<Project> project = BenchmarkData::createBoardProject(
+      state.getTmpDir().getPathTo("project"), state.getScale());
+  Board& board = *project->getBoards().first();
+  BoardPlaneFragmentsBuilder().runSynchronously(board);
+  state.measure([&]() {
+    BoardDesignRuleCheck drc(board, board.getDrcSettings());
+    drc.execute(true);
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardGerberExport, ExportPcbLayers) {
+  std::unique_ptr<Project> project = BenchmarkData::createBoardProject(
+      state.getTmpDir().getPathTo("project"), state.getScale());
+  Board& board = *project->getBoards().first();
+  BoardPlaneFragmentsBuilder().runSynchronously(board);
+  BoardFabricationOutputSettings settings =
+      board.getFabricationOutputSettings();
+  settings.setOutputBasePath(state.getTmpDir().getPathTo("gerber").toStr() %
+                             "/board");
+  state.measure([&]() {
+    BoardGerberExport gerberExport(board);
+    gerberExport.exportPcbLayers(settings);
+  });
+}
+
+LIBREPCB_BENCHMARK(BoardAirWiresBuilder, BuildAirWires) {
+  std::unique_ptr<Project> project = BenchmarkData::createBoardProject(
+      state.getTmpDir().getPathTo("project"), state.getScale());
+  const Board& board = *project->getBoards().first();
+  const QList<NetSignal*> netsignals =
+      project->getCircuit().getNetSignals().values();
+  state.setCounter("nets", netsignals.count());
+  state.measure([&]() {
+    foreach (const NetSignal* netsignal, netsignals) {
+      BoardAirWiresBuilder builder(board, *netsignal);
+      builder.buildAirWires();
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,64 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+#include "../../benchmarkdata.h"
+
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/serialization/sexpression.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(SExpression, ParseBoard) {
+  const FilePath dir = state.getTmpDir().getPathTo("project");
+  BenchmarkData::createBoardProject(dir, state.getScale());
+  const FilePath fp = dir.getPathTo("boards/default/board.lp");
+  const QByteArray content = FileUtils::readFile(fp);
+  state.setCounter("bytes", content.size());
+  state.measure([&]() { SExpression::parse(content, fp); });
+}
+
+LIBREPCB_BENCHMARK(SExpression, SerializeBoard) {
+  const FilePath dir = state.getTmpDir().getPathTo("project");
+  BenchmarkData::createBoardProject(dir, state.getScale());
+  const FilePath fp = dir.getPathTo("boards/default/board.lp");
+  const SExpression root = SExpression::parse(FileUtils::readFile(fp), fp);
+  state.measure([&]() { root.toByteArray(); });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,81 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../../benchmark.h"
+#include "../../benchmarkdata.h"
+
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/workspace/workspacelibrarydb.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Benchmarks
+ ******************************************************************************/
+
+LIBREPCB_BENCHMARK(WorkspaceLibraryDb, FullRescan) {
+  const FilePath librariesDir = state.getTmpDir().getPathTo("libraries");
+  const int elementCount =
+      BenchmarkData::createWorkspaceLibraries(librariesDir, state.getScale());
+  state.setCounter("elements", elementCount);
+  state.measure([&]() {
+    // Start with an empty cache to measure the initial scan, not only the
+    // detection of unmodified libraries.
+    QDir cacheDir(librariesDir.toStr());
+    foreach (const QString& fileName,
+             cacheDir.entryList({"cache_v*.sqlite"}, QDir::Files)) {
+      cacheDir.remove(fileName);
+    }
+    WorkspaceLibraryDb db(librariesDir);
+    QString error;
+    QEventLoop loop;
+    QObject::connect(&db, &WorkspaceLibraryDb::scanFinished, &loop,
+                     &QEventLoop::quit);
+    QObject::connect(&db, &WorkspaceLibraryDb::scanFailed, &loop,
+                     [&](const QString& msg) {
+                       error = "Library scan failed: " % msg;
+                       loop.quit();
+                     });
+    QTimer::singleShot(300000, &loop, [&]() {
+      error = "Library scan timed out.";
+      loop.quit();
+    });
+    db.startLibraryRescan();
+    loop.exec();
+    if (!error.isEmpty()) {
+      throw RuntimeError(__FILE__, __LINE__, error);
+    }
+  });
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,137 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "benchmark.h"
+
+#include <librepcb/core/application.h>
+#include <librepcb/core/debug.h>
+#include <librepcb/core/exceptions.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // initialize a common locale for all benchmarks
+  QLocale::setDefault(QLocale(QLocale::English, QLocale::UnitedStates));
+
+  // many classes rely on a QApplication instance, so we create it here
+  QApplication app(argc, argv);
+  QApplication::setOrganizationName("LibrePCB");
+  QApplication::setOrganizationDomain("librepcb.org");
+  QApplication::setApplicationName("LibrePCB-Benchmarks");
+
+  // disable the whole debug output (it would distort the measurements)
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+  // Perform global initialization tasks.
+  Application::loadBundledFonts();
+
+  // Parse command line arguments.
+  QCommandLineParser parser;
+  parser.setApplicationDescription("LibrePCB performance benchmarks");
+  parser.addHelpOption();
+  QCommandLineOption listOption("list", "List all benchmarks and exit.");
+  QCommandLineOption filterOption(
+      "filter", "Only run benchmarks whose name matches a regular expression.",
+      "regex");
+  QCommandLineOption iterationsOption(
+      "iterations", "Number of timed iterations per benchmark (default: 5).",
+      "n", "5");
+  QCommandLineOption scaleOption(
+      "scale", "Size factor of the generated input data (default: 1).", "n",
+      "1");
+  QCommandLineOption jsonOption(
+      "json", "Write the results in JSON format to a file.", "file");
+  parser.addOption(listOption);
+  parser.addOption(filterOption);
+  parser.addOption(iterationsOption);
+  parser.addOption(scaleOption);
+  parser.addOption(jsonOption);
+  parser.process(app);
+
+  QTextStream out(stdout);
+  QTextStream err(stderr);
+  bool ok = false;
+  const int iterations = parser.value(iterationsOption).toInt(&ok);
+  if ((!ok) || (iterations < 1)) {
+    err << "ERROR: Invalid number of iterations." << endl;
+    return 1;
+  }
+  const int scale = parser.value(scaleOption).toInt(&ok);
+  if ((!ok) || (scale < 1)) {
+    err << "ERROR: Invalid scale." << endl;
+    return 1;
+  }
+  const QRegularExpression filter(parser.value(filterOption));
+  if (!filter.isValid()) {
+    err << "ERROR: Invalid filter: " << filter.errorString() << endl;
+    return 1;
+  }
+
+  // Run the benchmarks.
+  BenchmarkRunner runner(iterations, scale);
+  foreach (const Benchmark* benchmark, Benchmark::getAll()) {
+    const QString name = benchmark->getFullName();
+    if (!filter.match(name).hasMatch()) {
+      continue;
+    }
+    if (parser.isSet(listOption)) {
+      out << name << endl;
+    } else {
+      err << "Run " << name << "..." << endl;
+      runner.run(*benchmark);
+    }
+  }
+  if (parser.isSet(listOption)) {
+    return 0;
+  }
+  runner.printSummary(out);
+
+  // Write the JSON report.
+  if (parser.isSet(jsonOption)) {
+    try {
+      const FilePath fp(QFileInfo(parser.value(jsonOption)).absoluteFilePath());
+      runner.writeJson(fp);  // can throw
+    } catch (const Exception& e) {
+      err << "ERROR: " << e.getMsg() << endl;
+      return 1;
+    }
+  }
+
+  foreach (const BenchmarkRunner::Result& result, runner.getResults()) {
+    if (!result.error.isEmpty()) {
+      return 1;
+    }
+  }
+  return 0;
+}
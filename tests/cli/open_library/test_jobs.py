@@ -0,0 +1,59 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import params
+import pytest
+import shutil
+
+"""
+Test command "open-library --jobs"
+"""
+
+
+@pytest.mark.parametrize("library", [
+    params.EMPTY_LIBRARY_PARAM,
+    params.POPULATED_LIBRARY_PARAM,
+])
+def test_open_library_all_parallel(cli, library):
+    cli.add_library(library.dir)
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--jobs', '4', library.dir)
+    assert stderr == ''
+    assert stdout == \
+        "Open library '{library.dir}'...\n" \
+        "Process {library.cmpcat} component categories...\n" \
+        "Process {library.pkgcat} package categories...\n" \
+        "Process {library.sym} symbols...\n" \
+        "Process {library.pkg} packages...\n" \
+        "Process {library.cmp} components...\n" \
+        "Process {library.dev} devices...\n" \
+        "SUCCESS\n".format(library=library)
+    assert code == 0
+
+
+def test_messages_deterministic_order(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    for subdir in ['sym', 'pkg', 'cmp']:
+        shutil.rmtree(cli.abspath(os.path.join(library.dir, subdir)))
+    code, stdout_seq, stderr_seq = cli.run('open-library', '--all', '--check',
+                                           library.dir)
+    assert code == 1
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--jobs', '8', library.dir)
+    assert stderr == stderr_seq
+    assert stdout == stdout_seq
+    assert code == 1
+
+
+@pytest.mark.parametrize("jobs", ['0', '-1', 'foo'])
+def test_invalid_number_of_jobs(cli, jobs):
+    library = params.EMPTY_LIBRARY
+    cli.add_library(library.dir)
+    code, stdout, stderr = cli.run('open-library', '--all', '--jobs', jobs,
+                                   library.dir)
+    assert stderr == \
+        "ERROR: Number of jobs '{jobs}' is invalid.\n".format(jobs=jobs)
+    assert stdout == "Finished with errors!\n"
+    assert code == 1
@@ -10,25 +10,28 @@ Usage: {executable} [options] open-library [command_options] library
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
-  --all          Perform the selected action(s) on all elements contained in
-                 the opened library.
-  --check        Run the library element check, print all non-approved messages
-                 and report failure (exit code = 1) if there are non-approved
-                 messages.
-  --minify-step  Minify the STEP models of all packages. Only works in
-                 conjunction with '--all'. Pass '--save' to write the minified
-                 files to disk.
-  --save         Save library (and contained elements if '--all' is given)
-                 before closing them (useful to upgrade file format).
-  --strict       Fail if the opened files are not strictly canonical, i.e.
-                 there would be changes when saving the library elements.
+  -h, --help        Print this message.
+  -V, --version     Displays version information.
+  -v, --verbose     Verbose output.
+  --profile <file>  Write a profiling report (Chrome trace format) to a file.
+  --all             Perform the selected action(s) on all elements contained in
+                    the opened library.
+  --check           Run the library element check, print all non-approved
+                    messages and report failure (exit code = 1) if there are
+                    non-approved messages.
+  --minify-step     Minify the STEP models of all packages. Only works in
+                    conjunction with '--all'. Pass '--save' to write the
+                    minified files to disk.
+  --save            Save library (and contained elements if '--all' is given)
+                    before closing them (useful to upgrade file format).
+  --strict          Fail if the opened files are not strictly canonical, i.e.
+                    there would be changes when saving the library elements.
+  --jobs <n>        Number of library elements to process in parallel when
+                    '--all' is given. Defaults to 1.
 
 Arguments:
-  open-library   Open a library to execute library-related tasks.
-  library        Path to library directory (*.lplib).
+  open-library      Open a library to execute library-related tasks.
+  library           Path to library directory (*.lplib).
 """
 
 ERROR_TEXT = """\
@@ -63,3 +66,13 @@ def test_invalid_argument(cli):
     )
     assert stdout == ''
     assert code == 1
+
+
+def test_jobs_without_all(cli):
+    code, stdout, stderr = cli.run('open-library', '--jobs', '4', 'foo.lplib')
+    assert stderr == ERROR_TEXT.format(
+        executable=cli.executable,
+        error="The option '--jobs' requires '--all'.",
+    )
+    assert stdout == ''
+    assert code == 1
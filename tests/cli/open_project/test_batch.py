@@ -0,0 +1,72 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import params
+import pytest
+
+"""
+Test command "open-project" with multiple projects (batch mode)
+"""
+
+PROJECTS = [
+    params.EMPTY_PROJECT_LPP,
+    params.PROJECT_WITH_TWO_BOARDS_LPP,
+    params.PROJECT_WITH_TWO_BOARDS_LPPZ,
+]
+
+
+@pytest.mark.parametrize("parallel", [[], ['--parallel', '4']])
+def test_multiple_projects(cli, parallel):
+    for project in PROJECTS:
+        cli.add_project(project.dir, as_lppz=project.is_lppz)
+    args = ['open-project'] + parallel + [p.path for p in PROJECTS]
+    code, stdout, stderr = cli.run(*args)
+    assert stderr == ''
+    assert stdout == \
+        "Open project '{}'...\n" \
+        "Open project '{}'...\n" \
+        "Open project '{}'...\n" \
+        "SUCCESS\n".format(*[p.path for p in PROJECTS])
+    assert code == 0
+
+
+def test_projects_file(cli):
+    for project in PROJECTS:
+        cli.add_project(project.dir, as_lppz=project.is_lppz)
+    with open(cli.abspath('projects.txt'), 'w') as f:
+        f.write('# Comment\n')
+        f.write('\n'.join([p.path for p in PROJECTS[1:]]))
+    code, stdout, stderr = cli.run('open-project', '--projects-file',
+                                   'projects.txt', PROJECTS[0].path)
+    assert stderr == ''
+    assert stdout == \
+        "Open project '{}'...\n" \
+        "Open project '{}'...\n" \
+        "Open project '{}'...\n" \
+        "SUCCESS\n".format(*[p.path for p in PROJECTS])
+    assert code == 0
+
+
+def test_failure_does_not_abort_batch(cli):
+    project = params.EMPTY_PROJECT_LPP
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--parallel', '2',
+                                   'nonexistent.lpp', project.path)
+    assert stderr.startswith('ERROR: ')
+    assert stdout == \
+        "Open project 'nonexistent.lpp'...\n" \
+        "Open project '{project.path}'...\n" \
+        "Finished with errors!\n".format(project=project)
+    assert code == 1
+
+
+@pytest.mark.parametrize("parallel", ['0', 'foo'])
+def test_invalid_parallel(cli, parallel):
+    project = params.EMPTY_PROJECT_LPP
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--parallel', parallel,
+                                   project.path)
+    assert stderr == "ERROR: Number of parallel projects '{}' is invalid.\n" \
+        .format(parallel)
+    assert stdout == "Finished with errors!\n"
+    assert code == 1
@@ -15,6 +15,8 @@ Options:
   -h, --help                         Print this message.
   -V, --version                      Displays version information.
   -v, --verbose                      Verbose output.
+  --profile <file>                   Write a profiling report (Chrome trace
+                                     format) to a file.
   --erc                              Run the electrical rule check, print all
                                      non-approved warnings/errors and report
                                      failure (exit code = 1) if there are
@@ -95,11 +97,19 @@ Options:
                                      canonical, i.e. there would be changes when
                                      saving the project. Note that this option
                                      is not available for *.lppz files.
+  --projects-file <file>             Process all projects listed in the given
+                                     file (one path per line, relative to that
+                                     file) in addition to the projects passed as
+                                     arguments.
+  --parallel <n>                     Number of projects to process in parallel
+                                     (default: 1).
 
 Arguments:
   open-project                       Open a project to execute project-related
                                      tasks.
-  project                            Path to project file (*.lpp[z]).
+  project                            Path to project file (*.lpp[z]). Can be
+                                     given multiple times to process several
+                                     projects in one run.
 """
 
 ERROR_TEXT = """\
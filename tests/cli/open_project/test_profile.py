@@ -0,0 +1,37 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import json
+import params
+import pytest
+
+"""
+Test command "open-project --profile"
+"""
+
+
+@pytest.mark.parametrize("project", [params.PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM])
+def test_profile(cli, project):
+    cli.add_project(project.dir, as_lppz=project.is_lppz)
+    code, stdout, stderr = cli.run('open-project', '--profile', 'trace.json',
+                                   '--drc', '--board=copy', project.path)
+    assert stderr == ''
+    assert stdout == \
+        "Open project '{project.path}'...\n" \
+        "Run DRC...\n" \
+        "  Board 'copy':\n" \
+        "    Approved messages: 0\n" \
+        "    Non-approved messages: 0\n" \
+        "SUCCESS\n".format(project=project)
+    assert code == 0
+    with open(cli.abspath('trace.json'), 'r') as f:
+        events = json.load(f)['traceEvents']
+    spans = [e for e in events if e['ph'] == 'X']
+    names = set([e['name'] for e in spans])
+    assert 'CommandLineInterface::openProject' in names
+    assert 'ProjectLoader::open' in names
+    assert 'ProjectLoader::loadBoard' in names
+    assert 'BoardDesignRuleCheck::execute' in names
+    assert 'BoardDesignRuleCheck::checkCopperCopperClearances' in names
+    assert 'BoardPlaneFragmentsBuilder::run' in names
+    assert all([e['dur'] >= 0 for e in spans])
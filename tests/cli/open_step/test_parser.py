@@ -13,6 +13,7 @@ Options:
   -h, --help        Print this message.
   -V, --version     Displays version information.
   -v, --verbose     Verbose output.
+  --profile <file>  Write a profiling report (Chrome trace format) to a file.
   --minify          Minify the STEP model before validating it. Use in
                     conjunction with '--save-to' to save the output of the
                     operation.
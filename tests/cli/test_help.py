@@ -14,12 +14,13 @@ Usage: {executable} [options] command
 LibrePCB Command Line Interface
 
 Options:
-  -h, --help     Print this message.
-  -V, --version  Displays version information.
-  -v, --verbose  Verbose output.
+  -h, --help        Print this message.
+  -V, --version     Displays version information.
+  -v, --verbose     Verbose output.
+  --profile <file>  Write a profiling report (Chrome trace format) to a file.
 
 Arguments:
-  command        The command to execute (see list below).
+  command           The command to execute (see list below).
 
 Commands:
   open-library   Open a library to execute library-related tasks.
@@ -72,6 +72,31 @@ TEST_P(AttributeSubstitutorTest, testData) {
       << "Actual value: '" << qPrintable(output) << "'";
 }
 
+TEST(AttributeSubstitutorCompileTest, testSegments) {
+  using Segment = AttributeSubstitutor::Segment;
+  AttributeSubstitutor::Template expected{
+      Segment{"Foo ", QStringList()},
+      Segment{QString(), QStringList{"KEY_1", "'literal'"}},
+      Segment{" {{\n}} ", QStringList()},
+      Segment{QString(), QStringList{"'}}'"}},
+  };
+  EXPECT_EQ(expected, AttributeSubstitutor::compile(
+                          "Foo {{ KEY_1 or 'literal' }} {{\n}} {{ '}}' }}"));
+}
+
+TEST(AttributeSubstitutorCompileTest, testEvaluateCallsLookupOncePerKey) {
+  int calls = 0;
+  auto countingLookup = [&calls](const QString& key) {
+    ++calls;
+    return lookup(key);
+  };
+  const QString output = AttributeSubstitutor::evaluate(
+      AttributeSubstitutor::compile("{{KEY_4}} {{KEY_1}} {{KEY or KEY_1}}"),
+      countingLookup);
+  EXPECT_EQ("Recursive Normal value value Normal value Normal value", output);
+  EXPECT_EQ(3, calls);  // KEY_4, KEY_1, KEY
+}
+
 /*******************************************************************************
  *  Test Data
  ******************************************************************************/
@@ -85,7 +110,7 @@ INSTANTIATE_TEST_SUITE_P(AttributeSubstitutorTest, AttributeSubstitutorTest, ::t
     ASTD({"{{NONEXISTENT}}",                    ""}),
     ASTD({"{{KEY}}",                            ""}),
     ASTD({"{{KEY_1}}",                          "Normal value"}),
-    //ASTD({"{{KEY_1}} {{KEY_1}}",                "Normal value Normal value"}),
+    ASTD({"{{KEY_1}} {{KEY_1}}",                "Normal value Normal value"}),
     ASTD({"some {}}}{{ noise",                  "some {}}}{{ noise"}),
     ASTD({"{{KEY_2}}",                          "Value with {}}}{{ noise"}),
     ASTD({"{{KEY_3}}",                          "Recursive  value"}),
@@ -96,9 +121,9 @@ INSTANTIATE_TEST_SUITE_P(AttributeSubstitutorTest, AttributeSubstitutorTest, ::t
     ASTD({"Foo {KEY_7 }}{{KEY_7}} {{KEYY}}",    "Foo {KEY_7 }}Endless Endless  part 1 part 2 "}),
     ASTD({"{{KEY_3}} foo{ { KEY_5}} {{KEY}}",   "Recursive  value foo{ { KEY_5}} "}),
     ASTD({"{{KEY_1}} {{KEY_2 or KEY_3}} foo",   "Normal value Value with {}}}{{ noise foo"}),
-    //ASTD({"{{KEY_8 or KEY_1}}",                 "Normal value"}),
-    //ASTD({"{{KEY or KEY_4 or KEY_3}} {{KEY_1}}","Recursive Normal value value Normal value"}),
-    //ASTD({"{{KEY_1}} {{FOO or KEY or KEY_5}}!", "Normal value Recursive Recursive Normal value value value!"}),
+    ASTD({"{{KEY_8 or KEY_1}}",                 "Normal value"}),
+    ASTD({"{{KEY or KEY_4 or KEY_3}} {{KEY_1}}","Recursive Normal value value Normal value"}),
+    ASTD({"{{KEY_1}} {{FOO or KEY or KEY_5}}!", "Normal value Recursive Recursive Normal value value value!"}),
     ASTD({"{{FOO or BAR or BAR or FOO}}",       ""}),
     ASTD({"{{FOO or BAR or KEY or KEY_1}}",     "Normal value"}),
     ASTD({"{{FOO or 'a literal!' or KEY_1}}",   "a literal!"}),
@@ -110,9 +135,6 @@ INSTANTIATE_TEST_SUITE_P(AttributeSubstitutorTest, AttributeSubstitutorTest, ::t
 ));
 // clang-format on
 
-// TODO: disabled test cases fail because of bugs in the
-// librepcb::AttributeSubstitutor!
-
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -162,6 +162,22 @@ TEST_F(TransactionalFileSystemTest, testWriteIsDelayedUntilSave) {
   EXPECT_EQ("content", FileUtils::readFile(fp));
 }
 
+TEST_F(TransactionalFileSystemTest, testWriteUnmodifiedContent) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+  ASSERT_EQ("1", fs.read("1.txt"));
+  ASSERT_EQ("2", fs.read("2.txt"));
+  fs.write("1.txt", "1");  // same content as on disk
+  fs.write("2.txt", "new 2");  // modified content
+  fs.write("2.txt", "2");  // reverted content
+  fs.write(".dot/file.txt", "new file");  // modified content
+  fs.autosave();
+  const QByteArray diff = FileUtils::readFile(
+      mPopulatedDir.getPathTo(".autosave/autosave.lp"));
+  EXPECT_FALSE(diff.contains("\"1.txt\"")) << diff.toStdString();
+  EXPECT_FALSE(diff.contains("\"2.txt\"")) << diff.toStdString();
+  EXPECT_TRUE(diff.contains("\".dot/file.txt\"")) << diff.toStdString();
+}
+
 TEST_F(TransactionalFileSystemTest, testRemoveExistingFile) {
   FilePath fp = mPopulatedDir.getPathTo("1/1a.txt");
   TransactionalFileSystem fs(mPopulatedDir, true);
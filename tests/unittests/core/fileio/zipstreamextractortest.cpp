@@ -0,0 +1,197 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/zipstreamextractor.h>
+#include <quazip/JlCompress.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class ZipStreamExtractorTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+  FilePath mSourceDir;
+  FilePath mDestDir;
+  QMap<QString, QByteArray> mFiles;
+  QByteArray mZip;
+
+  ZipStreamExtractorTest() {
+    mTmpDir = FilePath::getRandomTempPath();
+    mSourceDir = mTmpDir.getPathTo("source");
+    mDestDir = mTmpDir.getPathTo("dest dir");
+
+    // Create a ZIP with small files, a compressible file spanning multiple
+    // inflate chunks and an incompressible file.
+    QByteArray random;
+    for (int i = 0; i < 100000; ++i) {
+      random.append(static_cast<char>(qrand()));
+    }
+    mFiles.insert("library.lp", "(librepcb_library)\n");
+    mFiles.insert("sym/a/symbol.lp", "(librepcb_symbol a)\n");
+    mFiles.insert("sym/b/symbol.lp", "(librepcb_symbol b)\n");
+    mFiles.insert("pkg/c/empty.txt", QByteArray());
+    mFiles.insert("pkg/c/model.step", QByteArray(500000, 'x'));
+    mFiles.insert("pkg/c/random.bin", random);
+    for (auto it = mFiles.begin(); it != mFiles.end(); ++it) {
+      FileUtils::writeFile(mSourceDir.getPathTo(it.key()), it.value());
+    }
+    const FilePath zipFp = mTmpDir.getPathTo("test.zip");
+    JlCompress::compressDir(zipFp.toStr(), mSourceDir.toStr(), true);
+    mZip = FileUtils::readFile(zipFp);
+  }
+
+  virtual ~ZipStreamExtractorTest() {
+    QDir(mTmpDir.toStr()).removeRecursively();
+  }
+
+  void extractInChunks(ZipStreamExtractor& extractor, const QByteArray& zip,
+                       int chunkSize) {
+    for (int i = 0; i < zip.size(); i += chunkSize) {
+      extractor.addData(zip.mid(i, chunkSize));
+    }
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(ZipStreamExtractorTest, testExtractInChunks) {
+  for (int chunkSize : {1, 7, 4096, mZip.size()}) {
+    FileUtils::removeDirRecursively(mDestDir);
+    ZipStreamExtractor extractor(mDestDir);
+    extractInChunks(extractor, mZip, chunkSize);
+    extractor.finish();
+    EXPECT_TRUE(extractor.isSupported()) << chunkSize;
+    EXPECT_EQ(mFiles.count(), extractor.getExtractedFiles().count())
+        << chunkSize;
+    for (auto it = mFiles.begin(); it != mFiles.end(); ++it) {
+      EXPECT_EQ(it.value(), FileUtils::readFile(mDestDir.getPathTo(it.key())))
+          << qPrintable(it.key()) << " " << chunkSize;
+    }
+  }
+}
+
+TEST_F(ZipStreamExtractorTest, testFilesLargerThanWriteBudget) {
+  // Exceed the max. size of pending writes to make the extractor wait for
+  // them while extracting.
+  const FilePath sourceDir = mTmpDir.getPathTo("large");
+  QMap<QString, QByteArray> files;
+  for (int i = 0; i < 3; ++i) {
+    files.insert(QString("file%1.bin").arg(i),
+                 QByteArray(20 * 1024 * 1024, static_cast<char>('a' + i)));
+  }
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    FileUtils::writeFile(sourceDir.getPathTo(it.key()), it.value());
+  }
+  const FilePath zipFp = mTmpDir.getPathTo("large.zip");
+  JlCompress::compressDir(zipFp.toStr(), sourceDir.toStr(), true);
+
+  ZipStreamExtractor extractor(mDestDir);
+  extractInChunks(extractor, FileUtils::readFile(zipFp), 4096);
+  extractor.finish();
+  EXPECT_EQ(files.count(), extractor.getExtractedFiles().count());
+  for (auto it = files.begin(); it != files.end(); ++it) {
+    EXPECT_EQ(it.value(), FileUtils::readFile(mDestDir.getPathTo(it.key())))
+        << qPrintable(it.key());
+  }
+}
+
+TEST_F(ZipStreamExtractorTest, testIncompleteFile) {
+  ZipStreamExtractor extractor(mDestDir);
+  extractor.addData(mZip.left(mZip.size() / 2));
+  EXPECT_THROW(extractor.finish(), Exception);
+  extractor.removeExtractedFiles();
+  EXPECT_FALSE(mDestDir.isExistingDir());
+}
+
+TEST_F(ZipStreamExtractorTest, testRemoveExtractedFilesKeepsOtherFiles) {
+  const FilePath otherFile = mDestDir.getPathTo("other.txt");
+  FileUtils::writeFile(otherFile, "other");
+  ZipStreamExtractor extractor(mDestDir);
+  extractor.addData(mZip);
+  extractor.finish();
+  EXPECT_TRUE(mDestDir.getPathTo("library.lp").isExistingFile());
+  extractor.removeExtractedFiles();
+  EXPECT_FALSE(mDestDir.getPathTo("library.lp").isExistingFile());
+  EXPECT_TRUE(otherFile.isExistingFile());
+}
+
+TEST_F(ZipStreamExtractorTest, testRemoveExtractedFilesInSharedDir) {
+  // Another extraction writes into the same, initially non-existent
+  // directory (like library element downloads do), so removing the files of
+  // the first extraction must not remove the files of the second one.
+  const FilePath otherDir = mTmpDir.getPathTo("other");
+  FileUtils::writeFile(otherDir.getPathTo("sym/d/symbol.lp"), "d");
+  FileUtils::writeFile(otherDir.getPathTo("other.txt"), "other");
+  const FilePath otherZipFp = mTmpDir.getPathTo("other.zip");
+  JlCompress::compressDir(otherZipFp.toStr(), otherDir.toStr(), true);
+  ASSERT_FALSE(mDestDir.isExistingDir());
+  ZipStreamExtractor extractor(mDestDir);
+  ZipStreamExtractor otherExtractor(mDestDir);
+  otherExtractor.addData(FileUtils::readFile(otherZipFp));
+  otherExtractor.finish();
+  extractor.addData(mZip);
+  extractor.finish();
+  extractor.removeExtractedFiles();
+  EXPECT_FALSE(mDestDir.getPathTo("library.lp").isExistingFile());
+  EXPECT_FALSE(mDestDir.getPathTo("sym/a").isExistingDir());
+  EXPECT_FALSE(mDestDir.getPathTo("pkg").isExistingDir());
+  EXPECT_EQ("d", FileUtils::readFile(mDestDir.getPathTo("sym/d/symbol.lp")));
+  EXPECT_EQ("other", FileUtils::readFile(mDestDir.getPathTo("other.txt")));
+
+  // Once the other files are removed too, nothing is left.
+  otherExtractor.removeExtractedFiles();
+  EXPECT_FALSE(mDestDir.isExistingDir());
+}
+
+TEST_F(ZipStreamExtractorTest, testCrcError) {
+  // Modify the CRC-32 field of the first local file header.
+  QByteArray zip = mZip;
+  zip[14] = static_cast<char>(zip.at(14) ^ 0xFF);
+  ZipStreamExtractor extractor(mDestDir);
+  EXPECT_THROW(extractor.addData(zip), Exception);
+}
+
+TEST_F(ZipStreamExtractorTest, testInvalidFile) {
+  ZipStreamExtractor extractor(mDestDir);
+  EXPECT_THROW(extractor.addData("<html>Not Found</html>"), Exception);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,125 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/application.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/font/strokefont.h>
+
+#include <QtConcurrent>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class StrokeFontTest : public ::testing::Test {
+protected:
+  static QByteArray readDefaultFont() {
+    const FilePath fp = Application::getResourcesDir().getPathTo(
+        "fontobene/" % Application::getDefaultStrokeFontName());
+    return FileUtils::readFile(fp);  // can throw
+  }
+
+  static QVector<Path> strokeText(const StrokeFont& font, const QString& text) {
+    Point bottomLeft, topRight;
+    return font.stroke(text, PositiveLength(1000000), Length(0), Length(0),
+                       Alignment(), bottomLeft, topRight);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(StrokeFontTest, testConcurrentStrokeWhileLoading) {
+  const FilePath fp("/font.bene");
+  const QByteArray content = readDefaultFont();
+
+  // Reference result from a font which is loaded in the current thread.
+  StrokeFont reference(fp, content);
+  QStringList texts;
+  for (int i = 0; i < 64; ++i) {
+    texts.append(QString("R%1 {{NAME}} µΩ").arg(i));
+  }
+  QList<QVector<Path>> expected;
+  foreach (const QString& text, texts) {
+    expected.append(strokeText(reference, text));
+  }
+
+  // Stroke the texts in parallel on a fresh font, so that the first calls
+  // race on the lazy font initialization.
+  StrokeFont font(fp, content);
+  QList<QFuture<QVector<Path>>> futures;
+  foreach (const QString& text, texts) {
+    futures.append(
+        QtConcurrent::run([&font, text]() { return strokeText(font, text); }));
+  }
+  QList<QVector<Path>> actual;
+  foreach (QFuture<QVector<Path>> future, futures) {
+    actual.append(future.result());
+  }
+  ASSERT_EQ(expected.count(), actual.count());
+  for (int i = 0; i < expected.count(); ++i) {
+    EXPECT_FALSE(actual.at(i).isEmpty());
+    EXPECT_EQ(expected.at(i), actual.at(i)) << qPrintable(texts.at(i));
+  }
+}
+
+TEST_F(StrokeFontTest, testConcurrentStrokeOfCachedText) {
+  const FilePath fp("/font.bene");
+  const QString text = "R1 {{NAME}} µΩ.:";
+  StrokeFont font(fp, readDefaultFont());
+  const QVector<Path> expected = strokeText(font, text);  // fills the cache
+
+  // Stroke the same text in parallel, so all threads get the cached paths
+  // and access their painter paths concurrently.
+  QList<QFuture<QList<QPainterPath>>> futures;
+  for (int i = 0; i < 64; ++i) {
+    futures.append(QtConcurrent::run([&font, text]() -> QList<QPainterPath> {
+      QList<QPainterPath> painterPaths;
+      foreach (const Path& path, strokeText(font, text)) {
+        painterPaths.append(path.toQPainterPathPx());
+      }
+      return painterPaths;
+    }));
+  }
+  foreach (QFuture<QList<QPainterPath>> future, futures) {
+    const QList<QPainterPath> actual = future.result();
+    ASSERT_EQ(expected.count(), actual.count());
+    for (int i = 0; i < expected.count(); ++i) {
+      EXPECT_EQ(expected.at(i).toQPainterPathPx(), actual.at(i));
+    }
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -413,6 +413,12 @@ TEST_F(PathTest, testFlatArc) {
   EXPECT_EQ(str(expected), str(actual));
 }
 
+TEST_F(PathTest, testToQPainterPathPxSingleVertex) {
+  const Path path({Vertex(Point(1000000, 2000000))});
+  EXPECT_EQ(1, path.toQPainterPathPx().elementCount());
+  EXPECT_EQ(1, path.toQPainterPathPx().elementCount());  // not appended again
+}
+
 /*******************************************************************************
  *  Parametrized obround(width, height) Tests
  ******************************************************************************/
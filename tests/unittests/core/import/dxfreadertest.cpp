@@ -524,6 +524,172 @@ TEST_F(DxfReaderTest, testLwPolylineClosed) {
   EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
 }
 
+TEST_F(DxfReaderTest, testLayerFilter) {
+  reader.setLayerFilter({"outline"});
+  parse(
+      "0\nSECTION\n"
+      "2\nHEADER\n"
+      "9\n$INSUNITS\n"
+      "70\n13\n"  // UNIT = micrometers
+      "0\nENDSEC\n"
+      "2\nENTITIES\n"
+      "0\nLINE\n"
+      "8\nDimensions\n"  // LAYER
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nLINE\n"
+      "8\nOUTLINE\n"  // LAYER
+      "10\n4.0\n"  // X1
+      "20\n5.0\n"  // Y1
+      "11\n8.0\n"  // X2
+      "21\n10.0\n"  // Y2
+      "0\nCIRCLE\n"
+      "8\nDimensions\n"  // LAYER
+      "10\n4.0\n"  // CX
+      "20\n5.0\n"  // CY
+      "40\n8.0\n"  // RADIUS
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Assert(!) for number of elements to avoid illegal list item access below.
+  ASSERT_EQ(0, reader.getPoints().count());
+  ASSERT_EQ(1, reader.getPolygons().count());
+  ASSERT_EQ(0, reader.getCircles().count());
+
+  Path expected({
+      Vertex(Point(Length(4000), Length(5000)), Angle(0)),
+      Vertex(Point(Length(8000), Length(10000)), Angle(0)),
+  });
+  EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
+}
+
+TEST_F(DxfReaderTest, testMergePolylines) {
+  reader.setMergePolylines(true);
+  parse(
+      "0\nSECTION\n"
+      "2\nHEADER\n"
+      "9\n$INSUNITS\n"
+      "70\n13\n"  // UNIT = micrometers
+      "0\nENDSEC\n"
+      "2\nENTITIES\n"
+      "0\nLINE\n"
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nLINE\n"
+      "10\n2.0\n"  // X1 (reversed direction)
+      "20\n0.0\n"  // Y1
+      "11\n1.0\n"  // X2
+      "21\n0.0\n"  // Y2
+      "0\nARC\n"
+      "10\n2.0\n"  // CX
+      "20\n1.0\n"  // CY
+      "40\n1.0\n"  // RADIUS
+      "50\n-90.0\n"  // START ANGLE
+      "51\n90.0\n"  // END ANGLE
+      "0\nLINE\n"
+      "10\n5.0\n"  // X1 (not connected)
+      "20\n5.0\n"  // Y1
+      "11\n6.0\n"  // X2
+      "21\n6.0\n"  // Y2
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Assert(!) for number of elements to avoid illegal list item access below.
+  ASSERT_EQ(0, reader.getPoints().count());
+  ASSERT_EQ(2, reader.getPolygons().count());
+  ASSERT_EQ(0, reader.getCircles().count());
+
+  Path expected1({
+      Vertex(Point(Length(0), Length(0)), Angle(0)),
+      Vertex(Point(Length(1000), Length(0)), Angle(0)),
+      Vertex(Point(Length(2000), Length(0)), Angle::deg180()),
+      Vertex(Point(Length(2000), Length(2000)), Angle(0)),
+  });
+  Path expected2({
+      Vertex(Point(Length(5000), Length(5000)), Angle(0)),
+      Vertex(Point(Length(6000), Length(6000)), Angle(0)),
+  });
+  EXPECT_EQ(str(expected1), str(reader.getPolygons().at(0)));
+  EXPECT_EQ(str(expected2), str(reader.getPolygons().at(1)));
+}
+
+TEST_F(DxfReaderTest, testArcTolerance) {
+  reader.setArcTolerance(UnsignedLength(10));
+  parse(
+      "0\nSECTION\n"
+      "2\nHEADER\n"
+      "9\n$INSUNITS\n"
+      "70\n13\n"  // UNIT = micrometers
+      "0\nENDSEC\n"
+      "2\nENTITIES\n"
+      "0\nLWPOLYLINE\n"
+      "90\n5\n"  // NUMBER OF VERTICES
+      "70\n0\n"  // FLAGS (0=open, 1=closed)
+      "10\n0.0\n"  // X1
+      "20\n0.0\n"  // Y1
+      "10\n1.0\n"  // X2 (deviates 1nm from straight line)
+      "20\n0.001\n"  // Y2
+      "10\n2.0\n"  // X3 (on straight line)
+      "20\n0.0\n"  // Y3
+      "10\n3.0\n"  // X4 (corner)
+      "20\n0.0\n"  // Y4
+      "10\n3.0\n"  // X5
+      "20\n3.0\n"  // Y5
+      "0\nENDSEC\n"
+      "0\nEOF\n");
+
+  // Assert(!) for number of elements to avoid illegal list item access below.
+  ASSERT_EQ(0, reader.getPoints().count());
+  ASSERT_EQ(1, reader.getPolygons().count());
+  ASSERT_EQ(0, reader.getCircles().count());
+
+  Path expected({
+      Vertex(Point(Length(0), Length(0)), Angle(0)),
+      Vertex(Point(Length(3000), Length(0)), Angle(0)),
+      Vertex(Point(Length(3000), Length(3000)), Angle(0)),
+  });
+  EXPECT_EQ(str(expected), str(reader.getPolygons().first()));
+}
+
+TEST_F(DxfReaderTest, testParseWithSink) {
+  FilePath fp = FilePath::getRandomTempPath();
+  FileUtils::writeFile(fp,
+                       "0\nSECTION\n"
+                       "2\nENTITIES\n"
+                       "0\nPOINT\n"
+                       "10\n-4.0\n"  // X
+                       "20\n-5.0\n"  // Y
+                       "0\nLINE\n"
+                       "10\n4.0\n"  // X1
+                       "20\n5.0\n"  // Y1
+                       "11\n8.0\n"  // X2
+                       "21\n10.0\n"  // Y2
+                       "0\nENDSEC\n"
+                       "0\nEOF\n");
+
+  QList<Point> points;
+  QList<Path> polygons;
+  QList<int> progress;
+  DxfReader::Sink sink;
+  sink.point = [&points](const Point& p) { points.append(p); };
+  sink.polygon = [&polygons](const Path& p) { polygons.append(p); };
+  sink.progress = [&progress](int percent) { progress.append(percent); };
+  reader.parse(fp, sink);
+  FileUtils::removeFile(fp);
+
+  // Objects are passed to the sink only, not stored in the reader.
+  EXPECT_EQ(1, points.count());
+  EXPECT_EQ(1, polygons.count());
+  EXPECT_EQ(0, reader.getPoints().count());
+  EXPECT_EQ(0, reader.getPolygons().count());
+  ASSERT_FALSE(progress.isEmpty());
+  EXPECT_EQ(100, progress.last());
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -0,0 +1,169 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/exceptions.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/library/librarymanifest.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class LibraryManifestTest : public ::testing::Test {
+protected:
+  FilePath mTmpDir;
+
+  LibraryManifestTest() {
+    mTmpDir = FilePath::getRandomTempPath().getPathTo("test dir.lplib");
+    FileUtils::writeFile(mTmpDir.getPathTo("library.lp"), "lib");
+    FileUtils::writeFile(mTmpDir.getPathTo(".librepcb-lib"), "1");
+    FileUtils::writeFile(mTmpDir.getPathTo("sym/a/symbol.lp"), "a");
+    FileUtils::writeFile(mTmpDir.getPathTo("sym/a/.librepcb-sym"), "1");
+    FileUtils::writeFile(mTmpDir.getPathTo("pkg/b/package.lp"), "b");
+  }
+
+  virtual ~LibraryManifestTest() {
+    QDir(mTmpDir.getParentDir().toStr()).removeRecursively();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(LibraryManifestTest, testFromDirectory) {
+  const LibraryManifest manifest = LibraryManifest::fromDirectory(mTmpDir);
+  EXPECT_EQ((QStringList{".", "pkg/b", "sym/a"}), manifest.getHashes().keys());
+  EXPECT_EQ(LibraryManifest::calcElementHash(mTmpDir, false),
+            manifest.getHashes().value("."));
+  EXPECT_EQ(LibraryManifest::calcElementHash(mTmpDir.getPathTo("sym/a"), true),
+            manifest.getHashes().value("sym/a"));
+  EXPECT_EQ(32, manifest.getHashes().value("pkg/b").size());
+}
+
+TEST_F(LibraryManifestTest, testHashIgnoresSubdirsOfRootAndLockFile) {
+  const QByteArray root = LibraryManifest::calcElementHash(mTmpDir, false);
+  const QByteArray sym =
+      LibraryManifest::calcElementHash(mTmpDir.getPathTo("sym/a"), true);
+  FileUtils::writeFile(mTmpDir.getPathTo("sym/a/.lock"), "lock");
+  FileUtils::writeFile(mTmpDir.getPathTo("sym/c/symbol.lp"), "c");
+  EXPECT_EQ(root, LibraryManifest::calcElementHash(mTmpDir, false));
+  EXPECT_EQ(sym,
+            LibraryManifest::calcElementHash(mTmpDir.getPathTo("sym/a"), true));
+}
+
+TEST_F(LibraryManifestTest, testHashDependsOnContentAndPath) {
+  const FilePath dir = mTmpDir.getPathTo("sym/a");
+  const QByteArray original = LibraryManifest::calcElementHash(dir, true);
+  FileUtils::writeFile(dir.getPathTo("symbol.lp"), "modified");
+  const QByteArray modified = LibraryManifest::calcElementHash(dir, true);
+  FileUtils::move(dir.getPathTo("symbol.lp"), dir.getPathTo("renamed.lp"));
+  const QByteArray renamed = LibraryManifest::calcElementHash(dir, true);
+  EXPECT_NE(original, modified);
+  EXPECT_NE(modified, renamed);
+}
+
+TEST_F(LibraryManifestTest, testModifiedAndRemovedElements) {
+  const LibraryManifest installed = LibraryManifest::fromDirectory(mTmpDir);
+  FileUtils::writeFile(mTmpDir.getPathTo("sym/a/symbol.lp"), "modified");
+  FileUtils::writeFile(mTmpDir.getPathTo("sym/c/symbol.lp"), "new");
+  FileUtils::removeDirRecursively(mTmpDir.getPathTo("pkg/b"));
+  const LibraryManifest latest = LibraryManifest::fromDirectory(mTmpDir);
+  EXPECT_EQ((QStringList{"sym/a", "sym/c"}),
+            latest.getModifiedElements(installed));
+  EXPECT_EQ((QStringList{"pkg/b"}), latest.getRemovedElements(installed));
+  EXPECT_EQ(QStringList(), latest.getModifiedElements(latest));
+  EXPECT_EQ(QStringList(), latest.getRemovedElements(latest));
+}
+
+TEST_F(LibraryManifestTest, testJsonRoundTrip) {
+  LibraryManifest manifest = LibraryManifest::fromDirectory(mTmpDir);
+  manifest.setUrl(".", QUrl("library.zip"));
+  manifest.setUrl("pkg/b", QUrl("pkg/b.zip"));
+  manifest.setUrl("sym/a", QUrl("https://example.com/a.zip"));
+
+  const QUrl baseUrl("https://librepcb.org/libs/test/manifest.json");
+  const LibraryManifest loaded =
+      LibraryManifest::fromJson(manifest.toJson(), baseUrl);
+  EXPECT_EQ(manifest.getHashes(), loaded.getHashes());
+  EXPECT_EQ(QUrl("https://librepcb.org/libs/test/library.zip"),
+            loaded.getUrl("."));
+  EXPECT_EQ(QUrl("https://librepcb.org/libs/test/pkg/b.zip"),
+            loaded.getUrl("pkg/b"));
+  EXPECT_EQ(QUrl("https://example.com/a.zip"), loaded.getUrl("sym/a"));
+}
+
+TEST_F(LibraryManifestTest, testInvalidJson) {
+  EXPECT_THROW(LibraryManifest::fromJson("foo", QUrl()), Exception);
+  EXPECT_THROW(LibraryManifest::fromJson("{}", QUrl()), Exception);
+  EXPECT_THROW(LibraryManifest::fromJson(
+                   R"({"elements": {"sym/a": {"sha256": "00", "url": "a"}}})",
+                   QUrl()),
+               Exception);
+}
+
+TEST_F(LibraryManifestTest, testMaliciousElementPaths) {
+  const QStringList elements = {
+      "",
+      "..",
+      "../lib",
+      "sym/..",
+      "sym/../../x",
+      "sym/a/b",
+      "/sym",
+      "sym/",
+      "/etc/passwd",
+      "sym\\..\\x",
+      "sym/a\\b",
+      "C:/Windows",
+      "sym/C:",
+  };
+  foreach (const QString& element, elements) {
+    EXPECT_FALSE(LibraryManifest::isValidElement(element))
+        << element.toStdString();
+    LibraryManifest manifest;
+    manifest.setHash(element, QByteArray(32, 'x'));
+    manifest.setUrl(element, QUrl("a.zip"));
+    const QUrl baseUrl("https://librepcb.org/libs/test/manifest.json");
+    EXPECT_THROW(LibraryManifest::fromJson(manifest.toJson(), baseUrl),
+                 Exception)
+        << element.toStdString();
+  }
+  EXPECT_TRUE(LibraryManifest::isValidElement("."));
+  EXPECT_TRUE(LibraryManifest::isValidElement("sym/a"));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -24,6 +24,8 @@
 #include <librepcb/core/application.h>
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/circuit/circuit.h>
+#include <librepcb/core/project/circuit/netclass.h>
 #include <librepcb/core/project/project.h>
 #include <librepcb/core/project/projectloader.h>
 
@@ -176,6 +178,30 @@ TEST_F(ProjectTest, testSave) {
   }
 }
 
+TEST_F(ProjectTest, testSaveOnlyModifiedDocuments) {
+  // create and save new project
+  std::unique_ptr<Project> project =
+      Project::create(createDir(), mProjectFile.getFilename());
+  project->save();
+  project->getDirectory().getFileSystem()->save();
+
+  // modify the circuit without marking it as modified -> not serialized
+  Circuit& circuit = project->getCircuit();
+  circuit.addNetClass(*new NetClass(circuit, Uuid::createRandom(),
+                                    ElementName("my netclass")));
+  project->save();
+  EXPECT_FALSE(project->getDirectory()
+                   .read("circuit/circuit.lp")
+                   .contains("my netclass"));
+
+  // mark the circuit as modified -> serialized
+  project->setCircuitModified();
+  project->save();
+  EXPECT_TRUE(project->getDirectory()
+                  .read("circuit/circuit.lp")
+                  .contains("my netclass"));
+}
+
 TEST_F(ProjectTest, testIfDateTimeIsUpdatedOnSave) {
   // create new project
   std::unique_ptr<Project> project =
@@ -161,6 +161,41 @@ TEST_F(SerializableObjectListTest, testIndexOfName) {
   EXPECT_EQ(2, l.indexOf(mMocks[2]->mName));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfInLargeList) {
+  // Large enough to make use of the hash index.
+  List l;
+  for (int i = 0; i < 100; ++i) {
+    l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+  }
+  l.append(std::make_shared<Mock>(Uuid::createRandom(), "1"));  // duplicate
+  EXPECT_EQ(42, l.indexOf(l[42]->mUuid));
+  EXPECT_EQ(1, l.indexOf(QString("1")));
+  EXPECT_EQ(-1, l.indexOf(mMocks[0]->mUuid));
+
+  // Insert & remove elements.
+  l.insert(10, mMocks[0]);
+  EXPECT_EQ(10, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(43, l.indexOf(l[43]->mUuid));
+  l.remove(1);
+  EXPECT_EQ(100, l.indexOf(QString("1")));
+  EXPECT_EQ(100, l.indexOf(l[100]->mUuid));
+  l.remove(mMocks[0]->mUuid);
+  EXPECT_EQ(-1, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(99, l.indexOf(QString("1")));
+
+  // Modify elements.
+  const Uuid uuid = Uuid::createRandom();
+  l[50]->mUuid = uuid;
+  l[50]->mName = "foo";
+  l[50]->onEdited.notify();
+  EXPECT_EQ(50, l.indexOf(uuid));
+  EXPECT_EQ(50, l.indexOf(QString("foo")));
+  EXPECT_EQ(-1, l.indexOf(QString("51")));
+  l[20]->mName = "1";
+  l[20]->onEdited.notify();
+  EXPECT_EQ(20, l.indexOf(QString("1")));
+}
+
 TEST_F(SerializableObjectListTest, testContainsPointer) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   EXPECT_TRUE(l.contains(mMocks[0].get()));
@@ -214,11 +249,11 @@ TEST_F(SerializableObjectListTest, testConstIterator) {
   EXPECT_EQ(3, i);
 }
 
-TEST_F(SerializableObjectListTest, testMutableIterator) {
+TEST_F(SerializableObjectListTest, testMutableValues) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   int i = 0;
-  for (auto& mock : l) {
-    mock.mName = QString::number(i++);
+  for (const auto& mock : l.values()) {
+    mock->mName = QString::number(i++);
   }
   EXPECT_EQ("0", l[0]->mName);
   EXPECT_EQ("1", l[1]->mName);
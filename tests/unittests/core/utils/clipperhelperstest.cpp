@@ -59,6 +59,25 @@ TEST_F(ClipperHelpersTest, testConvertPathWithApproximate) {
       outputStr.toStdString());
 }
 
+TEST_F(ClipperHelpersTest, testConvertOutlineStrokes) {
+  const PositiveLength maxArcTolerance(5000);
+  const QVector<Path> inputs = {
+      Path({Vertex(Point(1000000, 2000000))}),
+      Path({Vertex(Point(0, 0)), Vertex(Point(1234567, -7654321))}),
+      Path({Vertex(Point(0, 0), Angle::deg90()),
+            Vertex(Point(3000000, 1000000), -Angle(45123456)),
+            Vertex(Point(3000000, 1000000)), Vertex(Point(-500000, 0))}),
+  };
+  const PositiveLength width(333333);
+  for (const Path& input : inputs) {
+    const ClipperLib::Paths expected = ClipperHelpers::convert(
+        input.toOutlineStrokes(width), maxArcTolerance);
+    const ClipperLib::Paths actual =
+        ClipperHelpers::convertOutlineStrokes(input, width, maxArcTolerance);
+    EXPECT_EQ(expected, actual);
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
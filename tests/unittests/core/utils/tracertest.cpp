@@ -0,0 +1,121 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/utils/tracer.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class TracerTest : public ::testing::Test {
+protected:
+  TracerTest() { Tracer::clear(); }
+  virtual ~TracerTest() {
+    Tracer::setEnabled(false);
+    Tracer::clear();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(TracerTest, testDisabled) {
+  Tracer::setEnabled(false);
+  {
+    LIBREPCB_TRACE_SCOPE("span");
+    LIBREPCB_TRACE_COUNTER("counter", 42);
+  }
+  EXPECT_EQ(0, Tracer::getEvents().count());
+}
+
+TEST_F(TracerTest, testCounterNotEvaluatedIfDisabled) {
+  Tracer::setEnabled(false);
+  int evaluated = 0;
+  LIBREPCB_TRACE_COUNTER("counter", ++evaluated);
+  EXPECT_EQ(0, evaluated);
+}
+
+TEST_F(TracerTest, testNestedSpans) {
+  Tracer::setEnabled(true);
+  {
+    LIBREPCB_TRACE_SCOPE("outer");
+    {
+      LIBREPCB_TRACE_SCOPE("inner");
+      LIBREPCB_TRACE_COUNTER("counter", 42);
+    }
+  }
+  const QVector<Tracer::Event> events = Tracer::getEvents();
+  ASSERT_EQ(3, events.count());
+  EXPECT_STREQ("counter", events.at(0).name);
+  EXPECT_EQ('C', events.at(0).phase);
+  EXPECT_EQ(2, events.at(0).depth);
+  EXPECT_EQ(42, events.at(0).value);
+  EXPECT_STREQ("inner", events.at(1).name);
+  EXPECT_EQ('X', events.at(1).phase);
+  EXPECT_EQ(1, events.at(1).depth);
+  EXPECT_STREQ("outer", events.at(2).name);
+  EXPECT_EQ('X', events.at(2).phase);
+  EXPECT_EQ(0, events.at(2).depth);
+  EXPECT_LE(events.at(2).timestampNs, events.at(1).timestampNs);
+  EXPECT_GE(events.at(2).durationNs, events.at(1).durationNs);
+}
+
+TEST_F(TracerTest, testChromeTraceJson) {
+  Tracer::setEnabled(true);
+  { LIBREPCB_TRACE_SCOPE("span"); }
+  LIBREPCB_TRACE_COUNTER("counter", 3.5);
+  QJsonParseError error;
+  const QJsonDocument doc =
+      QJsonDocument::fromJson(Tracer::toChromeTraceJson(), &error);
+  ASSERT_EQ(QJsonParseError::NoError, error.error);
+  const QJsonArray events = doc.object().value("traceEvents").toArray();
+  ASSERT_EQ(3, events.count());  // span, counter, thread name
+  EXPECT_EQ("span", events.at(0).toObject().value("name").toString());
+  EXPECT_EQ("X", events.at(0).toObject().value("ph").toString());
+  EXPECT_TRUE(events.at(0).toObject().contains("dur"));
+  EXPECT_EQ("counter", events.at(1).toObject().value("name").toString());
+  EXPECT_EQ("C", events.at(1).toObject().value("ph").toString());
+  EXPECT_EQ(3.5, events.at(1)
+                     .toObject()
+                     .value("args")
+                     .toObject()
+                     .value("value")
+                     .toDouble());
+  EXPECT_EQ("M", events.at(2).toObject().value("ph").toString());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
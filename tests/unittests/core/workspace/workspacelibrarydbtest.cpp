@@ -651,6 +651,103 @@ TEST_F(WorkspaceLibraryDbTest, testGetMetadataNullptr) {
   EXPECT_TRUE(retDeprecated);
 }
 
+/*******************************************************************************
+ *  Tests for getAllInfos() and getLatestInfos()
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllInfosEmptyDb) {
+  EXPECT_EQ(0, mWsDb->getAllInfos<Library>({}).count());
+  EXPECT_EQ(0, mWsDb->getAllInfos<ComponentCategory>({}).count());
+  EXPECT_EQ(0, mWsDb->getAllInfos<Symbol>({}, toAbs("lib")).count());
+  EXPECT_EQ(0, mWsDb->getAllInfos<Device>({}, toAbs("lib")).count());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllInfosWithLibrary) {
+  int lib1 = mWriter->addLibrary(toAbs("lib1"), uuid(), version("0.1"), false,
+                                 QByteArray(), QString());
+  int lib2 = mWriter->addLibrary(toAbs("lib2"), uuid(), version("0.1"), false,
+                                 QByteArray(), QString());
+  int id = mWriter->addElement<Symbol>(lib1, toAbs("lib1/sym1"), uuid(1),
+                                       version("1.1"), true);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("_n"), "_d", "_k");
+  mWriter->addTranslation<Symbol>(id, "de_DE", ElementName("de_n"), "de_d",
+                                  tl::nullopt);
+  mWriter->addToCategory<Symbol>(id, uuid(10));
+  mWriter->addToCategory<Symbol>(id, uuid(11));
+  mWriter->addElement<Symbol>(lib1, toAbs("lib1/sym2"), uuid(2),
+                              version("2.2"), false);
+  mWriter->addElement<Symbol>(lib2, toAbs("lib2/sym3"), uuid(3),
+                              version("3.3"), false);
+
+  QList<WorkspaceLibraryDb::ElementInfo> infos =
+      mWsDb->getAllInfos<Symbol>({"de_DE"}, toAbs("lib1"));
+  std::sort(infos.begin(), infos.end(),
+            [](const WorkspaceLibraryDb::ElementInfo& a,
+               const WorkspaceLibraryDb::ElementInfo& b) {
+              return a.filePath < b.filePath;
+            });
+  ASSERT_EQ(2, infos.count());
+  EXPECT_EQ(str(toAbs("lib1/sym1")), str(infos[0].filePath));
+  EXPECT_EQ(str(uuid(1)), str(infos[0].uuid));
+  EXPECT_EQ("1.1", str(infos[0].version));
+  EXPECT_TRUE(infos[0].deprecated);
+  EXPECT_EQ("de_n", infos[0].name.toStdString());
+  EXPECT_EQ("de_d", infos[0].description.toStdString());
+  EXPECT_EQ("_k", infos[0].keywords.toStdString());
+  EXPECT_EQ(str(QSet<Uuid>{uuid(10), uuid(11)}), str(infos[0].categories));
+  EXPECT_FALSE(infos[0].componentUuid);
+  EXPECT_FALSE(infos[0].packageUuid);
+  EXPECT_EQ(str(toAbs("lib1/sym2")), str(infos[1].filePath));
+  EXPECT_EQ(str(uuid(2)), str(infos[1].uuid));
+  EXPECT_EQ("2.2", str(infos[1].version));
+  EXPECT_FALSE(infos[1].deprecated);
+  EXPECT_EQ("", infos[1].name.toStdString());
+  EXPECT_EQ(str(QSet<Uuid>{}), str(infos[1].categories));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetAllInfosCategoriesAndDevices) {
+  mWriter->addCategory<ComponentCategory>(0, toAbs("cat"), uuid(1),
+                                          version("0.1"), false, uuid(2));
+  mWriter->addDevice(0, toAbs("dev"), uuid(3), version("0.1"), false, uuid(4),
+                     uuid(5));
+
+  QList<WorkspaceLibraryDb::ElementInfo> categories =
+      mWsDb->getAllInfos<ComponentCategory>({});
+  ASSERT_EQ(1, categories.count());
+  EXPECT_EQ(str(QSet<Uuid>{uuid(2)}), str(categories[0].categories));
+
+  QList<WorkspaceLibraryDb::ElementInfo> devices =
+      mWsDb->getAllInfos<Device>({});
+  ASSERT_EQ(1, devices.count());
+  ASSERT_TRUE(devices[0].componentUuid);
+  ASSERT_TRUE(devices[0].packageUuid);
+  EXPECT_EQ(str(uuid(4)), str(*devices[0].componentUuid));
+  EXPECT_EQ(str(uuid(5)), str(*devices[0].packageUuid));
+}
+
+TEST_F(WorkspaceLibraryDbTest, testGetLatestInfos) {
+  int id = mWriter->addElement<Symbol>(0, toAbs("sym1"), uuid(1),
+                                       version("0.1"), false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("sym1"), "", "");
+  id = mWriter->addElement<Symbol>(0, toAbs("sym2"), uuid(1), version("0.2"),
+                                   false);
+  mWriter->addTranslation<Symbol>(id, "", ElementName("sym2"), "", "");
+  mWriter->addElement<Symbol>(0, toAbs("sym3"), uuid(2), version("0.1"),
+                              false);
+  mWriter->addElement<Symbol>(0, toAbs("sym4"), uuid(3), version("0.1"),
+                              false);
+
+  EXPECT_EQ(0, mWsDb->getLatestInfos<Symbol>({}, {}).count());
+  const QHash<Uuid, WorkspaceLibraryDb::ElementInfo> infos =
+      mWsDb->getLatestInfos<Symbol>({uuid(1), uuid(2), uuid(4)}, {});
+  EXPECT_EQ(str(QSet<Uuid>{uuid(1), uuid(2)}),
+            str(Toolbox::toSet(infos.keys())));
+  auto it = infos.find(uuid(1));
+  ASSERT_TRUE(it != infos.end());
+  EXPECT_EQ(str(toAbs("sym2")), str(it.value().filePath));
+  EXPECT_EQ("sym2", it.value().name.toStdString());
+}
+
 /*******************************************************************************
  *  Tests for getLibraryMetadata()
  ******************************************************************************/
@@ -1012,6 +1109,33 @@ TEST_F(WorkspaceLibraryDbTest, testGetComponentDevicesDuplicates) {
   EXPECT_EQ(str(QSet<Uuid>{uuid(1)}), str(mWsDb->getComponentDevices(uuid(0))));
 }
 
+/*******************************************************************************
+ *  Tests for runAsync()
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryDbTest, testRunAsync) {
+  mWriter->addElement<Symbol>(0, toAbs("sym1"), uuid(1), version("0.1"), false);
+  mWriter->addElement<Symbol>(0, toAbs("sym2"), uuid(2), version("0.1"), false);
+
+  QFuture<QList<WorkspaceLibraryDb::ElementInfo>> future =
+      mWsDb->runAsync<QList<WorkspaceLibraryDb::ElementInfo>>(
+          [](const WorkspaceLibraryDb& db) {
+            return db.getAllInfos<Symbol>({});
+          });
+  EXPECT_EQ(2, future.result().count());
+}
+
+TEST_F(WorkspaceLibraryDbTest, testRunAsyncException) {
+  mDb->exec("DROP TABLE symbols_tr");
+
+  QFuture<QList<WorkspaceLibraryDb::ElementInfo>> future =
+      mWsDb->runAsync<QList<WorkspaceLibraryDb::ElementInfo>>(
+          [](const WorkspaceLibraryDb& db) {
+            return db.getAllInfos<Symbol>({});
+          });
+  EXPECT_THROW(future.result(), Exception);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -21,6 +21,12 @@
  *  Includes
  ******************************************************************************/
 #include <gtest/gtest.h>
+#include <librepcb/core/fileio/fileutils.h>
+#include <librepcb/core/fileio/transactionaldirectory.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/library/cmp/component.h>
+#include <librepcb/core/library/dev/device.h>
+#include <librepcb/core/library/pkg/package.h>
 #include <librepcb/eagleimport/eaglelibraryimport.h>
 
 #include <QtCore>
@@ -36,7 +42,27 @@ namespace tests {
  *  Test Class
  ******************************************************************************/
 
-class EagleLibraryImportTest : public ::testing::Test {};
+class EagleLibraryImportTest : public ::testing::Test {
+protected:
+  static std::unique_ptr<TransactionalDirectory> openDir(const QDir& dir,
+                                                         const QString& name) {
+    return std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
+        TransactionalFileSystem::openRO(FilePath(dir.filePath(name)))));
+  }
+
+  template <typename T>
+  static QHash<QString, Uuid> getElementUuids(const FilePath& lib) {
+    QHash<QString, Uuid> uuids;
+    const QDir dir(lib.getPathTo(T::getShortElementName()).toStr());
+    foreach (const QString& name,
+             dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+      std::unique_ptr<T> element = T::open(openDir(dir, name));  // can throw
+      uuids.insert(*element->getNames().getDefaultValue(),
+                   element->getUuid());
+    }
+    return uuids;
+  }
+};
 
 /*******************************************************************************
  *  Test Methods
@@ -68,6 +94,134 @@ TEST_F(EagleLibraryImportTest, testImport) {
   EXPECT_TRUE(import.wait(10000));
   EXPECT_EQ(1, signalFinished);
   EXPECT_EQ(0, importErrors.count());
+
+  // Elements are converted concurrently, check that all of them were written.
+  for (const char* type : {"sym", "pkg", "cmp", "dev"}) {
+    const QDir dir(dst.getPathTo(type).toStr());
+    EXPECT_EQ(1, dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot).count())
+        << type;
+  }
+}
+
+TEST_F(EagleLibraryImportTest, testImportMultipleElements) {
+  // Three devices, each with its own symbol and package. The symbols and
+  // packages contain a rectangle on an unsupported layer to get one import
+  // error per element. Another device refers to non-existent elements.
+  QString symbols, packages, deviceSets;
+  for (int i = 1; i <= 3; ++i) {
+    symbols += QString(
+                   "<symbol name=\"SYM%1\">"
+                   "<pin name=\"P\" x=\"0\" y=\"0\"/>"
+                   "<rectangle x1=\"0\" y1=\"0\" x2=\"1\" y2=\"1\" "
+                   "layer=\"23\"/>"
+                   "</symbol>")
+                   .arg(i);
+    packages += QString(
+                    "<package name=\"PKG%1\">"
+                    "<smd name=\"1\" x=\"0\" y=\"0\" dx=\"1\" "
+                    "dy=\"1\" layer=\"1\"/>"
+                    "<rectangle x1=\"0\" y1=\"0\" x2=\"1\" y2=\"1\" "
+                    "layer=\"23\"/>"
+                    "</package>")
+                    .arg(i);
+    deviceSets += QString(
+                      "<deviceset name=\"DS%1\" prefix=\"U\">"
+                      "<gates><gate name=\"G$1\" symbol=\"SYM%1\" "
+                      "x=\"0\" y=\"0\"/></gates>"
+                      "<devices><device name=\"\" package=\"PKG%1\">"
+                      "<connects><connect gate=\"G$1\" pin=\"P\" "
+                      "pad=\"1\"/></connects>"
+                      "<technologies><technology name=\"\"/></technologies>"
+                      "</device></devices>"
+                      "</deviceset>")
+                      .arg(i);
+  }
+  deviceSets +=
+      "<deviceset name=\"DS4\" prefix=\"U\">"
+      "<gates><gate name=\"G$1\" symbol=\"MISSING\" x=\"0\" y=\"0\"/>"
+      "</gates>"
+      "<devices><device name=\"\" package=\"MISSING\">"
+      "<technologies><technology name=\"\"/></technologies>"
+      "</device></devices>"
+      "</deviceset>";
+  const QString lbr =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<eagle version=\"9.6.2\"><drawing>"
+      "<layers>"
+      "<layer number=\"1\" name=\"Top\" color=\"4\" fill=\"1\"/>"
+      "<layer number=\"23\" name=\"tOrigins\" color=\"15\" fill=\"1\"/>"
+      "<layer number=\"94\" name=\"Symbols\" color=\"4\" fill=\"1\"/>"
+      "</layers>"
+      "<library>"
+      "<packages>" %
+      packages %
+      "</packages>"
+      "<symbols>" %
+      symbols %
+      "</symbols>"
+      "<devicesets>" %
+      deviceSets %
+      "</devicesets>"
+      "</library>"
+      "</drawing></eagle>\n";
+  const FilePath tmpDir = FilePath::getRandomTempPath();
+  const FilePath src = tmpDir.getPathTo("test.lbr");
+  const FilePath dst = tmpDir.getPathTo("lib");
+  FileUtils::writeFile(src, lbr.toUtf8());
+
+  QStringList importErrors;
+  {
+    EagleLibraryImport import(dst);
+    QObject::connect(&import, &EagleLibraryImport::finished,
+                     [&importErrors](const QStringList& e) {
+                       importErrors = e;
+                     });
+    EXPECT_EQ(0, import.open(src).count());
+    ASSERT_EQ(3, import.getSymbols().count());
+    ASSERT_EQ(3, import.getPackages().count());
+    ASSERT_EQ(4, import.getComponents().count());
+    ASSERT_EQ(4, import.getDevices().count());
+    foreach (const auto& dev, import.getDevices()) {
+      import.setDeviceChecked(dev.displayName, true);
+    }
+    import.start();
+    EXPECT_TRUE(import.wait(30000));
+  }
+
+  // Errors are reported in the order of the elements, no matter in which
+  // order their conversion has finished.
+  const QStringList expectedErrorPrefixes = {
+      "[SYM1] ", "[SYM2] ", "[SYM3] ", "[PKG1] ",
+      "[PKG2] ", "[PKG3] ", "[DS4] ",  "[DS4] ",
+  };
+  ASSERT_EQ(expectedErrorPrefixes.count(), importErrors.count())
+      << qPrintable(importErrors.join("\n"));
+  for (int i = 0; i < importErrors.count(); ++i) {
+    EXPECT_TRUE(importErrors.at(i).startsWith(expectedErrorPrefixes.at(i)))
+        << qPrintable(importErrors.at(i));
+  }
+  EXPECT_TRUE(importErrors.at(6).contains("MISSING"));
+
+  // Each device must refer to its own component and package.
+  const QHash<QString, Uuid> components = getElementUuids<Component>(dst);
+  const QHash<QString, Uuid> packages = getElementUuids<Package>(dst);
+  const QDir devDir(dst.getPathTo(Device::getShortElementName()).toStr());
+  const QStringList devDirs =
+      devDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+  ASSERT_EQ(3, devDirs.count());
+  foreach (const QString& dirName, devDirs) {
+    std::unique_ptr<Device> device = Device::open(openDir(devDir, dirName));
+    const QString name = *device->getNames().getDefaultValue();
+    const QString pkgName = "PKG" % name.mid(2);
+    ASSERT_TRUE(components.contains(name)) << qPrintable(name);
+    ASSERT_TRUE(packages.contains(pkgName)) << qPrintable(name);
+    EXPECT_EQ(*components.find(name), device->getComponentUuid())
+        << qPrintable(name);
+    EXPECT_EQ(*packages.find(pkgName), device->getPackageUuid())
+        << qPrintable(name);
+  }
+
+  QDir(tmpDir.toStr()).removeRecursively();
 }
 
 /*******************************************************************************
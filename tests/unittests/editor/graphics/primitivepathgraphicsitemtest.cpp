@@ -0,0 +1,138 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/editor/graphics/graphicslayer.h>
+#include <librepcb/editor/graphics/primitivepathgraphicsitem.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PrimitivePathGraphicsItemTest : public ::testing::Test {
+protected:
+  // Paint engine which only counts the drawn primitives.
+  class CountingPaintEngine final : public QPaintEngine {
+  public:
+    CountingPaintEngine() noexcept
+      : QPaintEngine(QPaintEngine::AllFeatures), paths(0), rects(0) {}
+    bool begin(QPaintDevice*) noexcept override { return true; }
+    bool end() noexcept override { return true; }
+    void updateState(const QPaintEngineState&) noexcept override {}
+    void drawPath(const QPainterPath&) noexcept override { ++paths; }
+    void drawRects(const QRectF*, int count) noexcept override {
+      rects += count;
+    }
+    void drawPixmap(const QRectF&, const QPixmap&,
+                    const QRectF&) noexcept override {}
+    Type type() const noexcept override { return QPaintEngine::User; }
+    int paths;
+    int rects;
+  };
+
+  class CountingPaintDevice final : public QPaintDevice {
+  public:
+    QPaintEngine* paintEngine() const noexcept override { return &mEngine; }
+    const CountingPaintEngine& getEngine() const noexcept { return mEngine; }
+
+  protected:
+    int metric(PaintDeviceMetric metric) const noexcept override {
+      switch (metric) {
+        case PdmWidth:
+        case PdmHeight:
+          return 1000;
+        case PdmDevicePixelRatioScaled:
+          return static_cast<int>(devicePixelRatioFScale());
+        case PdmDepth:
+          return 32;
+        default:
+          return (metric == PdmDevicePixelRatio) ? 1 : 96;
+      }
+    }
+
+  private:
+    mutable CountingPaintEngine mEngine;
+  };
+
+  // Paint the item with the given scale factor and return the counts of
+  // drawn paths and rects.
+  static std::pair<int, int> paint(PrimitivePathGraphicsItem& item,
+                                   qreal scale) {
+    CountingPaintDevice device;
+    QStyleOptionGraphicsItem option;
+    {
+      QPainter painter(&device);
+      painter.scale(scale, scale);
+      item.paint(&painter, &option);
+    }
+    return std::make_pair(device.getEngine().paths, device.getEngine().rects);
+  }
+
+  PrimitivePathGraphicsItemTest()
+    : mLayer(std::make_shared<GraphicsLayer>("test", "Test", Qt::red,
+                                             Qt::red)) {
+    QPainterPath path;
+    path.addEllipse(QPointF(0, 0), 10, 10);  // 20px diameter
+    mItem.setPath(path);
+    mItem.setFillLayer(mLayer);
+  }
+
+  std::shared_ptr<GraphicsLayer> mLayer;
+  PrimitivePathGraphicsItem mItem;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PrimitivePathGraphicsItemTest, testLevelOfDetailDisabledByDefault) {
+  EXPECT_EQ(std::make_pair(1, 0), paint(mItem, 1));
+  EXPECT_EQ(std::make_pair(1, 0), paint(mItem, 0.01));
+}
+
+TEST_F(PrimitivePathGraphicsItemTest, testLevelOfDetailThreshold) {
+  mItem.setLevelOfDetailEnabled(true);
+  // Large enough to be drawn exactly (20px * 0.2 = 4 device pixels).
+  EXPECT_EQ(std::make_pair(1, 0), paint(mItem, 0.2));
+  EXPECT_EQ(std::make_pair(1, 0), paint(mItem, 0.11));
+  // Smaller than two device pixels, thus drawn as bounding rect.
+  EXPECT_EQ(std::make_pair(0, 1), paint(mItem, 0.05));
+  EXPECT_EQ(std::make_pair(0, 1), paint(mItem, 0.001));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
@@ -192,13 +192,18 @@ TEST_F(AddComponentDialogTest, testChooseComponentDevice) {
       TestHelpers::getChild<QComboBox>(dialog, "cbxSymbVar");
   QLabel& lblDevName = TestHelpers::getChild<QLabel>(dialog, "lblDeviceName");
 
+  // Wait until the category tree is populated
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return catView.model()->rowCount() == 1; }));
+
   // Select cat 2
   QModelIndex cat1Index = catView.model()->index(0, 0);
   EXPECT_EQ("cat 1", cat1Index.data().toString().toStdString());
   QModelIndex cat2Index = catView.model()->index(0, 0, cat1Index);
   EXPECT_EQ("cat 2", cat2Index.data().toString().toStdString());
   catView.setCurrentIndex(cat2Index);
-  EXPECT_EQ(2, cmpView.model()->rowCount());
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return cmpView.model()->rowCount() == 2; }));
 
   // Select cmp 2
   QModelIndex cmp2Index = cmpView.model()->index(1, 0);
@@ -265,8 +270,14 @@ TEST_F(AddComponentDialogTest, testSetNormOrder) {
   QComboBox& cbxSymbVar =
       TestHelpers::getChild<QComboBox>(dialog, "cbxSymbVar");
 
+  // Wait until the category tree is populated
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return catView.model()->rowCount() == 1; }));
+
   // Select cmp 1 and check selected symbol variant
   catView.setCurrentIndex(catView.model()->index(0, 0));
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return cmpView.model()->rowCount() == 1; }));
   cmpView.setCurrentIndex(cmpView.model()->index(0, 0));
   EXPECT_EQ("var 2 [NORM]", cbxSymbVar.currentText().toStdString());
 
@@ -276,6 +287,8 @@ TEST_F(AddComponentDialogTest, testSetNormOrder) {
   // Update selection and check selected symbol variant again
   catView.setCurrentIndex(QModelIndex());
   catView.setCurrentIndex(catView.model()->index(0, 0));
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return cmpView.model()->rowCount() == 1; }));
   cmpView.setCurrentIndex(cmpView.model()->index(0, 0));
   EXPECT_EQ("var 1", cbxSymbVar.currentText().toStdString());
 }
@@ -298,7 +311,8 @@ TEST_F(AddComponentDialogTest, testSearch) {
 
   // Search "cmp" -> 2 results
   edtSearch.setText("cmp");
-  EXPECT_EQ(2, cmpView.model()->rowCount());
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return cmpView.model()->rowCount() == 2; }));
   EXPECT_EQ("cmp 1",
             cmpView.model()->index(0, 0).data().toString().toStdString());
   EXPECT_EQ("cmp 2",
@@ -306,11 +320,15 @@ TEST_F(AddComponentDialogTest, testSearch) {
 
   // Search "foo" -> 0 results
   edtSearch.setText("foo");
+  EXPECT_TRUE(dialog.isQueryInProgress());
+  EXPECT_TRUE(
+      TestHelpers::waitFor([&]() { return !dialog.isQueryInProgress(); }));
   EXPECT_EQ(0, cmpView.model()->rowCount());
 
   // Search "key" -> 1 results
   edtSearch.setText("key");
-  EXPECT_EQ(1, cmpView.model()->rowCount());
+  EXPECT_TRUE(TestHelpers::waitFor(
+      [&]() { return cmpView.model()->rowCount() == 1; }));
   EXPECT_EQ("cmp 1",
             cmpView.model()->index(0, 0).data().toString().toStdString());
 }
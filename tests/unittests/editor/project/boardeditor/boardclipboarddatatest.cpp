@@ -41,6 +41,19 @@ namespace tests {
 
 class BoardClipboardDataTest : public ::testing::Test {};
 
+// Simulates the MIME data as seen by another application instance, i.e. only
+// the serialized data of all formats not matching the passed pattern.
+static std::unique_ptr<QMimeData> serialize(const QMimeData& mime,
+                                            const QString& skipPattern) {
+  std::unique_ptr<QMimeData> copy(new QMimeData());
+  foreach (const QString& format, mime.formats()) {
+    if (!format.contains(QRegularExpression(skipPattern))) {
+      copy->setData(format, mime.data(format));
+    }
+  }
+  return copy;
+}
+
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
@@ -238,6 +251,50 @@ TEST(BoardClipboardDataTest, testToFromMimeDataPopulated) {
   EXPECT_EQ(obj1.getStrokeTexts(), obj2->getStrokeTexts());
   EXPECT_EQ(obj1.getHoles(), obj2->getHoles());
   EXPECT_EQ(obj1.getPadPositions(), obj2->getPadPositions());
+
+  // Load from binary and ZIP formats (as from another application instance)
+  // and validate
+  for (const char* skipPattern : {"instance", "instance|bin"}) {
+    std::unique_ptr<QMimeData> mime3 = serialize(*mime1, skipPattern);
+    std::unique_ptr<BoardClipboardData> obj3 =
+        BoardClipboardData::fromMimeData(mime3.get());
+    EXPECT_EQ(uuid, obj3->getBoardUuid());
+    EXPECT_EQ(pos, obj3->getCursorPos());
+    EXPECT_EQ(obj1.getDevices(), obj3->getDevices());
+    EXPECT_EQ(obj1.getNetSegments(), obj3->getNetSegments());
+    EXPECT_EQ(obj1.getPlanes(), obj3->getPlanes());
+    EXPECT_EQ(obj1.getZones(), obj3->getZones());
+    EXPECT_EQ(obj1.getPolygons(), obj3->getPolygons());
+    EXPECT_EQ(obj1.getStrokeTexts(), obj3->getStrokeTexts());
+    EXPECT_EQ(obj1.getHoles(), obj3->getHoles());
+    EXPECT_EQ(obj1.getPadPositions(), obj3->getPadPositions());
+  }
+}
+
+TEST(BoardClipboardDataTest, testToFromMimeDataWithFiles) {
+  BoardClipboardData obj1(Uuid::createRandom(), Point(1, 2));
+  obj1.getDirectory("dev/foo")->write("device.lp", "device");
+  obj1.getDirectory("pkg/bar")->write("package.lp", "package");
+
+  std::unique_ptr<QMimeData> mime1 = obj1.toMimeData();
+  obj1.getDirectory("dev/foo")->write("device.lp", "modified");
+  for (const char* skipPattern : {"^$", "instance", "instance|bin"}) {
+    std::unique_ptr<QMimeData> mime2 = serialize(*mime1, skipPattern);
+    std::unique_ptr<BoardClipboardData> obj2 =
+        BoardClipboardData::fromMimeData(mime2.get());
+    EXPECT_EQ(QByteArray("device"),
+              obj2->getDirectory("dev/foo")->read("device.lp"));
+    EXPECT_EQ(QByteArray("package"),
+              obj2->getDirectory("pkg/bar")->read("package.lp"));
+  }
+}
+
+TEST(BoardClipboardDataTest, testFromMimeDataAfterReleased) {
+  BoardClipboardData obj1(Uuid::createRandom(), Point(1, 2));
+  std::unique_ptr<QMimeData> mime1 = obj1.toMimeData();
+  std::unique_ptr<QMimeData> mime2 = serialize(*mime1, "^(?!.*instance)");
+  mime1.reset();  // Clipboard content replaced.
+  EXPECT_EQ(nullptr, BoardClipboardData::fromMimeData(mime2.get()).get());
 }
 
 /*******************************************************************************
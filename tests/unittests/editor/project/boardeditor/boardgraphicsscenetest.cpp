@@ -0,0 +1,117 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/core/fileio/transactionaldirectory.h>
+#include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/project/board/board.h>
+#include <librepcb/core/project/board/items/bi_device.h>
+#include <librepcb/core/project/circuit/componentinstance.h>
+#include <librepcb/core/project/project.h>
+#include <librepcb/core/project/projectloader.h>
+#include <librepcb/core/workspace/theme.h>
+#include <librepcb/editor/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/editor/graphics/graphicslayer.h>
+#include <librepcb/editor/project/boardeditor/boardgraphicsscene.h>
+#include <librepcb/editor/project/boardeditor/graphicsitems/bgi_device.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardGraphicsSceneTest : public ::testing::Test {
+protected:
+  static std::unique_ptr<Project> openProject() {
+    FilePath projectFp(TEST_DATA_DIR "/projects/Gerber Test/project.lpp");
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    ProjectLoader loader;
+    return loader.open(std::unique_ptr<TransactionalDirectory>(
+                           new TransactionalDirectory(projectFs)),
+                       projectFp.getFilename());  // can throw
+  }
+
+  static QRectF areaAround(const Point& pos) {
+    const QPointF posPx = pos.toPxQPointF();
+    return QRectF(posPx - QPointF(1, 1), posPx + QPointF(1, 1));
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardGraphicsSceneTest, testGetDevicesInAreaWithHiddenGrabAreas) {
+  std::unique_ptr<Project> project = openProject();
+  Board* board = project->getBoards().first();
+  Theme theme;
+  DefaultGraphicsLayerProvider layerProvider(theme);
+  layerProvider.getLayer(Theme::Color::sBoardGrabAreasTop)->setVisible(false);
+  layerProvider.getLayer(Theme::Color::sBoardGrabAreasBot)->setVisible(false);
+  BoardGraphicsScene scene(*board, layerProvider,
+                           std::make_shared<QSet<const NetSignal*>>());
+  ASSERT_FALSE(scene.getDevices().isEmpty());
+
+  // The origin cross is still visible, so the device must be found and
+  // grabbable at its position.
+  foreach (BI_Device* device, scene.getDevices().keys()) {
+    const QString name = *device->getComponentInstance().getName();
+    const QRectF area = areaAround(device->getPosition());
+    const auto devices = scene.getDevicesInArea(area);
+    ASSERT_TRUE(devices.contains(device)) << qPrintable(name);
+    std::shared_ptr<BGI_Device> item = devices.value(device);
+    EXPECT_TRUE(item->mapToScene(item->shape()).intersects(area))
+        << qPrintable(name);
+  }
+
+  // Devices must still be found even if none of their children is visible.
+  foreach (const std::shared_ptr<GraphicsLayer>& layer,
+           layerProvider.getAllLayers()) {
+    layer->setVisible(false);
+  }
+  foreach (BI_Device* device, scene.getDevices().keys()) {
+    const QRectF area = areaAround(device->getPosition());
+    EXPECT_TRUE(scene.getDevicesInArea(area).contains(device))
+        << qPrintable(*device->getComponentInstance().getName());
+  }
+
+  // But not far away from them.
+  EXPECT_TRUE(scene.getDevicesInArea(areaAround(Point(-1000000000, 0)))
+                  .isEmpty());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
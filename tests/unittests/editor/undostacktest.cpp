@@ -0,0 +1,189 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/editor/undocommand.h>
+#include <librepcb/editor/undostack.h>
+
+#include <QtTest>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace editor {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Command
+ ******************************************************************************/
+
+/**
+ * @brief Command adding a delta to an integer, mergeable if requested
+ */
+class UndoStackTestCommand final : public UndoCommand {
+public:
+  UndoStackTestCommand(int& value, int delta, bool mergeable,
+                       std::size_t size = 0) noexcept
+    : UndoCommand("Test"),
+      mValue(value),
+      mDelta(delta),
+      mMergeable(mergeable),
+      mSize(size) {}
+
+  std::size_t getMemoryUsage() const noexcept override {
+    return UndoCommand::getMemoryUsage() + mSize;
+  }
+
+  bool mergeWith(UndoCommand& other) noexcept override {
+    UndoStackTestCommand* cmd = dynamic_cast<UndoStackTestCommand*>(&other);
+    if (mMergeable && cmd && cmd->mMergeable && (&cmd->mValue == &mValue)) {
+      mDelta += cmd->mDelta;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  bool performExecute() override {
+    performRedo();
+    return (mDelta != 0);
+  }
+  void performUndo() override { mValue -= mDelta; }
+  void performRedo() override { mValue += mDelta; }
+
+  int& mValue;
+  int mDelta;
+  bool mMergeable;
+  std::size_t mSize;
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST(UndoStackTest, testMergeWith) {
+  int value = 0;
+  UndoStack stack;
+  stack.execCmd(new UndoStackTestCommand(value, 1, true));
+  stack.execCmd(new UndoStackTestCommand(value, 2, true));
+  EXPECT_EQ(3, value);
+
+  // Both commands are reverted with a single undo step.
+  stack.undo();
+  EXPECT_EQ(0, value);
+  EXPECT_FALSE(stack.canUndo());
+  stack.redo();
+  EXPECT_EQ(3, value);
+}
+
+TEST(UndoStackTest, testNoMergeWithCleanState) {
+  int value = 0;
+  UndoStack stack;
+  stack.execCmd(new UndoStackTestCommand(value, 1, true));
+  stack.setClean();
+  stack.execCmd(new UndoStackTestCommand(value, 2, true));
+  EXPECT_EQ(3, value);
+
+  // Merging would make the clean state unreachable.
+  stack.undo();
+  EXPECT_EQ(1, value);
+  EXPECT_TRUE(stack.isClean());
+}
+
+TEST(UndoStackTest, testMergedExecClearsRedo) {
+  int value = 0;
+  UndoStack stack;
+  stack.execCmd(new UndoStackTestCommand(value, 1, true));
+  stack.execCmd(new UndoStackTestCommand(value, 2, false));
+  stack.undo();
+  EXPECT_EQ(1, value);
+  EXPECT_TRUE(stack.canRedo());
+
+  QSignalSpy redoTextSpy(&stack, &UndoStack::redoTextChanged);
+  QSignalSpy canRedoSpy(&stack, &UndoStack::canRedoChanged);
+  stack.execCmd(new UndoStackTestCommand(value, 4, true));
+  EXPECT_EQ(5, value);
+  EXPECT_FALSE(stack.canRedo());
+  ASSERT_EQ(1, redoTextSpy.count());
+  EXPECT_EQ(stack.getRedoText(), redoTextSpy.last().at(0).toString());
+  ASSERT_EQ(1, canRedoSpy.count());
+  EXPECT_FALSE(canRedoSpy.last().at(0).toBool());
+
+  // The new command was merged into the first one.
+  stack.undo();
+  EXPECT_EQ(0, value);
+  EXPECT_FALSE(stack.canUndo());
+}
+
+TEST(UndoStackTest, testApplyMemoryLimit) {
+  int value = 0;
+  UndoStack stack;
+  stack.execCmd(new UndoStackTestCommand(value, 1, false, 1000));
+  stack.execCmd(new UndoStackTestCommand(value, 2, false, 1000));
+  stack.execCmd(new UndoStackTestCommand(value, 4, false, 1000));
+  EXPECT_EQ(7, value);
+
+  // Exceeding the limit evicts the oldest command.
+  stack.setMemoryLimit(stack.getMemoryUsage() - 1);
+  EXPECT_LE(stack.getMemoryUsage(), stack.getMemoryLimit());
+  EXPECT_FALSE(stack.isClean());
+  stack.undo();
+  stack.undo();
+  EXPECT_EQ(1, value);
+  EXPECT_FALSE(stack.canUndo());
+
+  // The last executed command is always kept, even if exceeding the limit.
+  stack.redo();
+  stack.redo();
+  stack.setMemoryLimit(1);
+  EXPECT_GT(stack.getMemoryUsage(), stack.getMemoryLimit());
+  stack.undo();
+  EXPECT_EQ(3, value);
+  EXPECT_FALSE(stack.canUndo());
+}
+
+TEST(UndoStackTest, testGetUniqueStateId) {
+  int value = 0;
+  UndoStack stack;
+  const uint initialId = stack.getUniqueStateId();
+  stack.execCmd(new UndoStackTestCommand(value, 1, true));
+  const uint executedId = stack.getUniqueStateId();
+  EXPECT_NE(initialId, executedId);
+
+  stack.undo();
+  EXPECT_EQ(initialId, stack.getUniqueStateId());
+  stack.redo();
+  EXPECT_EQ(executedId, stack.getUniqueStateId());
+
+  // Merging modifies the state without adding a command.
+  stack.execCmd(new UndoStackTestCommand(value, 2, true));
+  EXPECT_NE(executedId, stack.getUniqueStateId());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace editor
+}  // namespace librepcb
@@ -20,6 +20,8 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
+#include "../../testhelpers.h"
+
 #include <gtest/gtest.h>
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/library/cat/componentcategory.h>
@@ -39,6 +41,8 @@ namespace librepcb {
 namespace editor {
 namespace tests {
 
+using ::librepcb::tests::TestHelpers;
+
 /*******************************************************************************
  *  Test Class
  ******************************************************************************/
@@ -78,8 +82,17 @@ protected:
     return s + "]";
   }
 
+  void waitForUpdate(const CategoryTreeModel& model) {
+    EXPECT_TRUE(TestHelpers::waitFor([&]() {
+      return !model.isUpdateInProgress();
+    }));
+  }
+
   QVector<Item> getItems(const CategoryTreeModel& model,
                          const QModelIndex& index = QModelIndex()) {
+    if (!index.isValid()) {
+      waitForUpdate(model);  // The model is populated asynchronously.
+    }
     QVector<Item> items;
     for (int i = 0; i < model.rowCount(index); ++i) {
       QModelIndex child = model.index(i, 0, index);
@@ -142,6 +155,7 @@ TEST_F(CategoryTreeModelTest, testData) {
                                              tl::nullopt, tl::nullopt);
 
   CategoryTreeModel model(*mWsDb, {}, CategoryTreeModel::Filter::CmpCat);
+  waitForUpdate(model);
   QModelIndex i1 = model.index(0, 0);
   EXPECT_EQ("cat 1", str(i1.data(Qt::DisplayRole)));
   EXPECT_EQ("desc 1", str(i1.data(Qt::ToolTipRole)));
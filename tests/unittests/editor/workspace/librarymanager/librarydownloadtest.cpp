@@ -23,6 +23,7 @@
 #include <gtest/gtest.h>
 #include <librepcb/core/fileio/fileutils.h>
 #include <librepcb/core/fileio/transactionalfilesystem.h>
+#include <librepcb/core/library/librarymanifest.h>
 #include <librepcb/core/network/networkaccessmanager.h>
 #include <librepcb/editor/workspace/librarymanager/librarydownload.h>
 
@@ -52,6 +53,24 @@ public:
     fs->exportToZip(zip);
   }
 
+  // Simulates a server providing delta updates of the passed library.
+  static QUrl createManifest(const FilePath& libDir, const FilePath& dir) {
+    LibraryManifest manifest = LibraryManifest::fromDirectory(libDir);
+    foreach (const QString& element, manifest.getHashes().keys()) {
+      const QString zipName = QString(element).replace("/", "_") % ".zip";
+      if (element == ".") {
+        TransactionalFileSystem::openRO(libDir)->exportToZip(
+            dir.getPathTo(zipName),
+            [](const QString& fp) { return !fp.contains("/"); });
+      } else {
+        createZip(libDir.getPathTo(element), dir.getPathTo(zipName));
+      }
+      manifest.setUrl(element, QUrl(zipName));
+    }
+    FileUtils::writeFile(dir.getPathTo("manifest.json"), manifest.toJson());
+    return QUrl::fromLocalFile(dir.getPathTo("manifest.json").toStr());
+  }
+
 protected:
   static NetworkAccessManager* sDownloadManager;
 };
@@ -216,6 +235,60 @@ TEST_F(LibraryDownloadTest, testDownloadValidLibraryDestinationAlreadyExists) {
   EXPECT_FALSE(dstZip.isExistingFile());
 }
 
+TEST_F(LibraryDownloadTest, testDeltaUpdate) {
+  // create temporary directory
+  FilePath dstDir = FilePath::getRandomTempPath();
+  FilePath dstLibDir = dstDir.getPathTo("my library");
+  FilePath serverDir = dstDir.getPathTo("server");
+  FileUtils::makePath(serverDir);
+
+  // prepare manifest and element ZIPs of the latest library
+  FilePath srcLibDir(TEST_DATA_DIR "/libraries/Populated Library.lplib");
+  const LibraryManifest latest = LibraryManifest::fromDirectory(srcLibDir);
+  QUrl manifestUrl = createManifest(srcLibDir, serverDir);
+
+  // install an outdated library: one element modified, one added
+  ASSERT_GE(latest.getHashes().count(), 2);
+  const QString modifiedElement = latest.getHashes().keys().last();
+  FileUtils::copyDirRecursively(srcLibDir, dstLibDir);
+  FileUtils::writeFile(dstLibDir.getPathTo(modifiedElement % "/foo"), "foo");
+  FileUtils::writeFile(dstLibDir.getPathTo("sym/obsolete/bar"), "bar");
+
+  // start the delta update, with an invalid ZIP URL to make sure the whole
+  // library is not downloaded
+  LibraryDownload* dl = new LibraryDownload(
+      QUrl::fromLocalFile(serverDir.getPathTo("nonexistent.zip").toStr()),
+      dstLibDir);
+  dl->setManifestUrl(manifestUrl);
+  QSignalSpy spyFinished(dl, SIGNAL(finished(bool, QString)));
+  dl->start();
+
+  // wait until download finished (with timeout)
+  qint64 start = QDateTime::currentDateTime().toMSecsSinceEpoch();
+  auto currentTime = []() {
+    return QDateTime::currentDateTime().toMSecsSinceEpoch();
+  };
+  while ((spyFinished.isEmpty()) && (currentTime() - start < 30000)) {
+    QThread::msleep(100);
+    qApp->processEvents();
+  }
+
+  // check result
+  ASSERT_EQ(1, spyFinished.count());
+  EXPECT_TRUE(spyFinished.first()[0].toBool());  // success
+  EXPECT_TRUE(spyFinished.first()[1].toString().isNull())
+      << spyFinished.first()[1].toString().toStdString();  // error message
+  ASSERT_TRUE(dl->getChangedElementDirs().has_value());
+  EXPECT_EQ((QSet<FilePath>{dstLibDir.getPathTo(modifiedElement),
+                            dstLibDir.getPathTo("sym/obsolete")}),
+            *dl->getChangedElementDirs());
+  EXPECT_EQ(latest.getHashes(),
+            LibraryManifest::fromDirectory(dstLibDir).getHashes());
+  EXPECT_FALSE(FilePath(dstLibDir.toStr() % ".tmp").isExistingDir());
+  EXPECT_FALSE(FilePath(dstLibDir.toStr() % ".backup").isExistingDir());
+  delete dl;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/